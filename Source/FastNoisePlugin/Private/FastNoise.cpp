@@ -27,13 +27,21 @@
 //
 
 #include "FastNoise.h"
+#include "FastNoiseLUT.h"
+#include "SIMD/FastNoiseSIMD.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
 
 #include <math.h>
 #include <assert.h>
 
 #include <algorithm>
 #include <random>
+#include <type_traits>
 
+DEFINE_LOG_CATEGORY_STATIC(LogFastNoise, Log, All);
 
 const float GRAD_X[] =
 {
@@ -195,6 +203,213 @@ static float CubicLerp(float a, float b, float c, float d, float t)
 	return t * t * t * p + t * t * ((a - b) - p) + t * (c - a) + b;
 }
 
+static float InterpHermiteDerivFunc(float t) { return 6 * t * (1 - t); }
+static float InterpQuinticDerivFunc(float t) { return 30 * t * t * (t * (t - 2) + 1); }
+
+// Interpolation
+// Passed to the Value, Perlin and GradientPerturb kernels as a template argument, so the method is picked once per call
+// Derivative(t) is the slope of Apply(t), used by the derivative kernels
+struct FInterpLinear { static FORCEINLINE float Apply(float t) { return t; } static FORCEINLINE float Derivative(float t) { return 1; } };
+struct FInterpHermite { static FORCEINLINE float Apply(float t) { return InterpHermiteFunc(t); } static FORCEINLINE float Derivative(float t) { return InterpHermiteDerivFunc(t); } };
+struct FInterpQuintic { static FORCEINLINE float Apply(float t) { return InterpQuinticFunc(t); } static FORCEINLINE float Derivative(float t) { return InterpQuinticDerivFunc(t); } };
+
+// Passes func an instance of the interpolation type selected by interp
+template <typename FFunc>
+static FORCEINLINE void DispatchInterp(EFNInterp interp, FFunc func)
+{
+	switch (interp)
+	{
+	case EFNInterp::Linear:
+		func(FInterpLinear());
+		break;
+	case EFNInterp::Hermite:
+		func(FInterpHermite());
+		break;
+	case EFNInterp::Quintic:
+		func(FInterpQuintic());
+		break;
+	}
+}
+
+// Hash types, passed to every kernel that hashes lattice coordinates as a template argument, so the type is picked once per call instead of per corner
+struct FHashPermutation { static constexpr bool Integer = false; };
+struct FHashInteger { static constexpr bool Integer = true; };
+
+// Passes func an instance of the hash type policy selected by hashType
+template <typename FFunc>
+static FORCEINLINE void DispatchHash(EFNHashType hashType, FFunc func)
+{
+	switch (hashType)
+	{
+	case EFNHashType::Permutation:
+		func(FHashPermutation());
+		break;
+	case EFNHashType::Integer:
+		func(FHashInteger());
+		break;
+	}
+}
+
+// Cellular distance functions, passed to the cellular kernels as a template argument
+struct FCellularEuclidean
+{
+	static FORCEINLINE float Distance(float vecX, float vecY) { return vecX * vecX + vecY * vecY; }
+	static FORCEINLINE float Distance(float vecX, float vecY, float vecZ) { return vecX * vecX + vecY * vecY + vecZ * vecZ; }
+};
+
+struct FCellularManhattan
+{
+	static FORCEINLINE float Distance(float vecX, float vecY) { return FastAbs(vecX) + FastAbs(vecY); }
+	static FORCEINLINE float Distance(float vecX, float vecY, float vecZ) { return FastAbs(vecX) + FastAbs(vecY) + FastAbs(vecZ); }
+};
+
+struct FCellularNatural
+{
+	static FORCEINLINE float Distance(float vecX, float vecY) { return (FastAbs(vecX) + FastAbs(vecY)) + (vecX * vecX + vecY * vecY); }
+	static FORCEINLINE float Distance(float vecX, float vecY, float vecZ) { return (FastAbs(vecX) + FastAbs(vecY) + FastAbs(vecZ)) + (vecX * vecX + vecY * vecY + vecZ * vecZ); }
+};
+
+// Passes func an instance of the distance function type selected by distanceFunction
+template <typename FFunc>
+static FORCEINLINE void DispatchCellularDistance(EFNCellularDistanceFunction distanceFunction, FFunc func)
+{
+	switch (distanceFunction)
+	{
+	case EFNCellularDistanceFunction::Euclidean:
+		func(FCellularEuclidean());
+		break;
+	case EFNCellularDistanceFunction::Manhattan:
+		func(FCellularManhattan());
+		break;
+	case EFNCellularDistanceFunction::Natural:
+		func(FCellularNatural());
+		break;
+	}
+}
+
+// Passes func distanceIndex1 as an std::integral_constant, so the 2Edge kernels only track as many distances as they return
+template <typename FFunc>
+static FORCEINLINE void DispatchCellularIndex(int32 distanceIndex1, FFunc func)
+{
+	switch (distanceIndex1)
+	{
+	case 0:
+		func(std::integral_constant<int32, 0>());
+		break;
+	case 1:
+		func(std::integral_constant<int32, 1>());
+		break;
+	case 2:
+		func(std::integral_constant<int32, 2>());
+		break;
+	default:
+		func(std::integral_constant<int32, FN_CELLULAR_INDEX_MAX>());
+		break;
+	}
+}
+
+// Cellular search pruning
+// A jittered point lies at most |CellularJitter| from its cell along each axis, so Distance() of the per axis gaps
+// between the sample and that reach is a lower bound of the distance to any point of the cell, whatever the distance function
+
+// The 3 cells of the search along one axis, the 2 around x first and then the one FastRound(x) adds to them,
+// along with the gap between x and the points each of them can hold
+static FORCEINLINE void CellularAxis(float x, float reach, int32 (&cells)[3], float (&gaps)[3])
+{
+	int32 x0 = FastFloor(x);
+
+	cells[0] = x0;
+	cells[1] = x0 + 1;
+	cells[2] = FastRound(x) == x0 ? x0 - 1 : x0 + 2;
+
+	for (int32 i = 0; i < 3; i++)
+		gaps[i] = FMath::Max(FastAbs(cells[i] - x) - reach, 0.0f);
+}
+
+// Calls cellFunc(xi, yi) for the cells of the 3x3 search that may hold a point closer than limit, which cellFunc lowers as it finds them
+// The 2x2 block around the sample goes first, the outer row and column are then usually skipped whole
+template <typename TDistance, typename FCellFunc>
+static FORCEINLINE void ForEachCellularCell(float x, float y, float jitter, const float& limit, FCellFunc cellFunc)
+{
+	float reach = FastAbs(jitter) + CELLULAR_BOUND_MARGIN;
+
+	int32 xs[3], ys[3];
+	float xg[3], yg[3];
+	CellularAxis(x, reach, xs, xg);
+	CellularAxis(y, reach, ys, yg);
+
+	// The 2x2 block nearly always holds the closest points in 2D, testing its cells costs more than it skips
+	for (int32 i = 0; i < 2; i++)
+		for (int32 j = 0; j < 2; j++)
+			cellFunc(xs[i], ys[j]);
+
+	// Every outer cell is at least the smaller outer gap away along one axis
+	if (TDistance::Distance(FMath::Min(xg[2], yg[2]), 0.0f) > limit)
+		return;
+
+	for (int32 i = 0; i < 3; i++)
+		for (int32 j = 0; j < 3; j++)
+			if ((i == 2 || j == 2) && TDistance::Distance(xg[i], yg[j]) <= limit)
+				cellFunc(xs[i], ys[j]);
+}
+
+template <typename TDistance, typename FCellFunc>
+static FORCEINLINE void ForEachCellularCell(float x, float y, float z, float jitter, const float& limit, FCellFunc cellFunc)
+{
+	float reach = FastAbs(jitter) + CELLULAR_BOUND_MARGIN;
+
+	int32 xs[3], ys[3], zs[3];
+	float xg[3], yg[3], zg[3];
+	CellularAxis(x, reach, xs, xg);
+	CellularAxis(y, reach, ys, yg);
+	CellularAxis(z, reach, zs, zg);
+
+	for (int32 i = 0; i < 2; i++)
+		for (int32 j = 0; j < 2; j++)
+			for (int32 k = 0; k < 2; k++)
+				if (TDistance::Distance(xg[i], yg[j], zg[k]) <= limit)
+					cellFunc(xs[i], ys[j], zs[k]);
+
+	if (TDistance::Distance(FMath::Min3(xg[2], yg[2], zg[2]), 0.0f, 0.0f) > limit)
+		return;
+
+	for (int32 i = 0; i < 3; i++)
+	{
+		for (int32 j = 0; j < 3; j++)
+		{
+			// Whole rows out of reach are skipped before looking at their cells
+			if (TDistance::Distance(xg[i], yg[j], 0.0f) > limit)
+				continue;
+
+			for (int32 k = 0; k < 3; k++)
+				if ((i == 2 || j == 2 || k == 2) && TDistance::Distance(xg[i], yg[j], zg[k]) <= limit)
+					cellFunc(xs[i], ys[j], zs[k]);
+		}
+	}
+}
+
+// True if cell a comes before cell b in the x, y(, z) order of a full 3x3(x3) scan
+// ForEachCellularCell visits the cells in another order, equal distances still have to pick the same cell
+static FORCEINLINE bool CellularScansBefore(int32 xa, int32 ya, int32 xb, int32 yb)
+{
+	return xa < xb || (xa == xb && ya < yb);
+}
+
+static FORCEINLINE bool CellularScansBefore(int32 xa, int32 ya, int32 za, int32 xb, int32 yb, int32 zb)
+{
+	return xa < xb || (xa == xb && (ya < yb || (ya == yb && za < zb)));
+}
+
+static TAutoConsoleVariable<int32> CVarFastNoiseFractalSetOrder(
+	TEXT("fastnoise.FractalSetOrder"),
+	0,
+	TEXT("Order the noise set grids of the fractal noise types evaluate octaves in, the values are the same either way.\n")
+	TEXT("  0: point major, every octave of a sample before the next sample (default)\n")
+	TEXT("  1: octave major, one octave over the whole grid before the next\n")
+	TEXT("fastnoise.BenchmarkFractalSetOrder times both on this machine.\n")
+	TEXT("Changing it recompiles every loaded noise, evaluators created earlier keep the order they were created with."),
+	ECVF_Default);
+
 UFastNoise::UFastNoise()
 	: Super()
 #if WITH_EDITORONLY_DATA
@@ -217,29 +432,88 @@ UFastNoise::UFastNoise()
 	, CellularDistanceIndex1(1)
 	, CellularJitter(0.45f)
 	, GradientPerturbAmp(1.0f)
+	, PerturbType(EFNPerturbType::Gradient)
+	, HashType(EFNHashType::Permutation)
 {
 	UpdateSeed();
-	CalculateFractalBounding();
+	CompileParams();
 }
 
-void UFastNoise::UpdateSeed()
+// Seeds with live tables, an entry is removed by the deleter of the tables it points to
+struct FPermutationRegistry
 {
-	std::mt19937_64 gen(Seed);
+	FCriticalSection Lock;
+	TMap<int32, TWeakPtr<const FFastNoisePermutation, ESPMode::ThreadSafe>> Entries;
+};
+
+// Never destroyed, noises released during shutdown may still unregister their tables
+static FPermutationRegistry& GetPermutationRegistry()
+{
+	static FPermutationRegistry* registry = new FPermutationRegistry();
+	return *registry;
+}
+
+FFastNoisePermutation::FFastNoisePermutation(int32 seed)
+{
+	std::mt19937_64 gen(seed);
 
 	for (int32 i = 0; i < 256; i++)
-		m_perm[i] = i;
+		Perm[i] = i;
 
 	for (int32 j = 0; j < 256; j++)
 	{
 		int32 rng = (int32)(gen() % (256 - j));
 		int32 k = rng + j;
-		int32 l = m_perm[j];
-		m_perm[j] = m_perm[j + 256] = m_perm[k];
-		m_perm[k] = l;
-		m_perm12[j] = m_perm12[j + 256] = m_perm[j] % 12;
+		int32 l = Perm[j];
+		Perm[j] = Perm[j + 256] = Perm[k];
+		Perm[k] = l;
+		Perm12[j] = Perm12[j + 256] = Perm[j] % 12;
 	}
 }
 
+TSharedRef<const FFastNoisePermutation, ESPMode::ThreadSafe> FFastNoisePermutation::Get(int32 seed)
+{
+	FPermutationRegistry& registry = GetPermutationRegistry();
+	FScopeLock scopeLock(&registry.Lock);
+
+	TWeakPtr<const FFastNoisePermutation, ESPMode::ThreadSafe>& entry = registry.Entries.FindOrAdd(seed);
+
+	TSharedPtr<const FFastNoisePermutation, ESPMode::ThreadSafe> permutation = entry.Pin();
+	if (permutation.IsValid())
+		return permutation.ToSharedRef();
+
+	TSharedRef<const FFastNoisePermutation, ESPMode::ThreadSafe> newPermutation = MakeShareable(new FFastNoisePermutation(seed), [seed](FFastNoisePermutation* released)
+	{
+		{
+			FPermutationRegistry& releaseRegistry = GetPermutationRegistry();
+			FScopeLock releaseLock(&releaseRegistry.Lock);
+
+			// Get(...) may already have replaced the entry with new tables for the same seed
+			const TWeakPtr<const FFastNoisePermutation, ESPMode::ThreadSafe>* releasedEntry = releaseRegistry.Entries.Find(seed);
+			if (releasedEntry && !releasedEntry->IsValid())
+				releaseRegistry.Entries.Remove(seed);
+		}
+		delete released;
+	});
+
+	entry = newPermutation;
+	return newPermutation;
+}
+
+void UFastNoise::UpdateSeed()
+{
+	m_params.Seed = Seed;
+
+	// Integer hashing mixes the seed in directly, the tables are only looked up once Permutation is selected
+	if (HashType == EFNHashType::Integer)
+		m_permutation.Reset();
+	else
+		m_permutation = FFastNoisePermutation::Get(Seed);
+
+	m_params.Perm = m_permutation.IsValid() ? m_permutation->Perm : nullptr;
+	m_params.Perm12 = m_permutation.IsValid() ? m_permutation->Perm12 : nullptr;
+}
+
 void UFastNoise::SetSeed(int32 seed)
 {
 	if (Seed == seed)
@@ -247,18 +521,140 @@ void UFastNoise::SetSeed(int32 seed)
 
 	Seed = seed;
 	UpdateSeed();
+	UpdateParams();
 }
 
 void UFastNoise::CalculateFractalBounding()
 {
-	float amp = FractalGain;
-	float ampFractal = 1.0f;
-	for (int32 i = 1; i < FractalOctaves; i++)
+	m_params.FractalBounding = FFastNoiseParams::CalculateFractalBounding(FractalOctaves, FractalGain);
+	m_params.FractalFade = 1.0f;
+}
+
+void UFastNoise::UpdateParams()
+{
+	CompileParams();
+
+	// Listeners are added and removed on the game thread, changes made elsewhere only miss the early eviction of stale data
+	if (IsInGameThread())
+		OnSettingsChanged().Broadcast(this);
+}
+
+void UFastNoise::CompileParams()
+{
+	m_params.Frequency = Frequency;
+	m_params.NoiseType = NoiseType;
+	m_params.Interpolation = Interpolation;
+	m_params.FractalType = FractalType;
+
+	m_params.FractalOctaves = FractalOctaves;
+	m_params.FractalLacunarity = FractalLacunarity;
+	m_params.FractalGain = FractalGain;
+	CalculateFractalBounding();
+
+	m_params.CellularDistanceFunction = CellularDistanceFunction;
+	m_params.CellularReturnType = CellularReturnType;
+	// The properties are only clamped by the editor, the kernels size their distance arrays by index 1 and need index 0 at or below it
+	m_params.CellularDistanceIndex0 = std::min(std::max(std::min(CellularDistanceIndex0, CellularDistanceIndex1), 0), FN_CELLULAR_INDEX_MAX);
+	m_params.CellularDistanceIndex1 = std::min(std::max(std::max(CellularDistanceIndex0, CellularDistanceIndex1), 0), FN_CELLULAR_INDEX_MAX);
+	m_params.CellularJitter = CellularJitter;
+
+	m_params.GradientPerturbAmp = GradientPerturbAmp;
+	m_params.PerturbType = PerturbType;
+	m_params.HashType = HashType;
+
+	// The lookup keeps its own params current, so only the pointer needs updating here
+	m_params.Lookup = CellularNoiseLookup ? &CellularNoiseLookup->m_params : nullptr;
+	m_params.Kernels = FastNoiseSIMD::GetKernels(NoiseType);
+	m_params.PerturbKernels = FastNoiseSIMD::GetLevelKernels();
+	m_params.FractalKernels = FastNoiseSIMD::GetFractalKernels(HashType);
+	m_params.FractalSetOrder = CVarFastNoiseFractalSetOrder.GetValueOnAnyThread() == 1 ? EFNFractalSetOrder::OctaveMajor : EFNFractalSetOrder::PointMajor;
+
+	// Only moved on the copies the large world path samples octaves with
+	m_params.LatticeOriginX = 0;
+	m_params.LatticeOriginY = 0;
+	m_params.LatticeOriginZ = 0;
+	m_params.BaseOffset = 0;
+}
+
+FFastNoiseChangedDelegate& UFastNoise::OnSettingsChanged()
+{
+	static FFastNoiseChangedDelegate settingsChanged;
+	return settingsChanged;
+}
+
+void UFastNoise::UpdateAllParams()
+{
+	check(IsInGameThread());
+
+	for (TObjectIterator<UFastNoise> it; it; ++it)
+		it->UpdateParams();
+}
+
+void UFastNoise::PostLoad()
+{
+	Super::PostLoad();
+
+	// Assets saved before the setters refused cycles can still hold one
+	if (LookupChainContains(CellularNoiseLookup, this))
 	{
-		ampFractal += amp;
-		amp *= FractalGain;
+		UE_LOG(LogFastNoise, Warning, TEXT("%s: %s looks this noise up, CellularNoiseLookup was cleared"), *GetName(), *CellularNoiseLookup->GetName());
+		CellularNoiseLookup = nullptr;
+	}
+
+	// May run on the async loading thread, a noise that was just loaded has no data generated from older settings to drop
+	UpdateSeed();
+	CompileParams();
+}
+
+#if WITH_EDITOR
+void UFastNoise::PostEditChangeProperty(FPropertyChangedEvent& propertyChangedEvent)
+{
+	Super::PostEditChangeProperty(propertyChangedEvent);
+
+	// The details panel can pick any noise, one that leads back here would never finish sampling
+	if (LookupChainContains(CellularNoiseLookup, this))
+	{
+		UE_LOG(LogFastNoise, Warning, TEXT("%s: %s looks this noise up, CellularNoiseLookup was cleared"), *GetName(), *CellularNoiseLookup->GetName());
+		CellularNoiseLookup = nullptr;
+	}
+
+	UpdateSeed();
+	UpdateParams();
+}
+#endif
+
+void UFastNoise::SetCellularNoiseLookup(UFastNoise* newCellularNoiseLookup)
+{
+	// Callable from Blueprints, so a cycle is refused with a warning rather than an ensure
+	if (LookupChainContains(newCellularNoiseLookup, this))
+	{
+		UE_LOG(LogFastNoise, Warning, TEXT("%s: %s looks this noise up and cannot be its CellularNoiseLookup"), *GetName(), *newCellularNoiseLookup->GetName());
+		return;
+	}
+
+	CellularNoiseLookup = newCellularNoiseLookup;
+	UpdateParams();
+}
+
+bool UFastNoise::LookupChainContains(const UFastNoise* lookup, const UFastNoise* noise)
+{
+	// Follows every lookup, not only the sampled ones, so changing a return type later cannot close a cycle either
+	TArray<const UFastNoise*> chain;
+
+	for (const UFastNoise* layer = lookup; layer && !chain.Contains(layer); layer = layer->CellularNoiseLookup)
+	{
+		if (layer == noise)
+			return true;
+
+		chain.Add(layer);
 	}
-	m_fractalBounding = 1.0f / ampFractal;
+
+	return false;
+}
+
+const UFastNoise* UFastNoise::GetActiveNoiseLookup() const
+{
+	return NoiseType == EFNNoiseType::Cellular && CellularReturnType == EFNCellularReturnType::NoiseLookup ? CellularNoiseLookup : nullptr;
 }
 
 void UFastNoise::SetCellularDistance2Indices(int32 cellularDistanceIndex0, int32 cellularDistanceIndex1)
@@ -268,6 +664,8 @@ void UFastNoise::SetCellularDistance2Indices(int32 cellularDistanceIndex0, int32
 
 	CellularDistanceIndex0 = std::min(std::max(CellularDistanceIndex0, 0), FN_CELLULAR_INDEX_MAX);
 	CellularDistanceIndex1 = std::min(std::max(CellularDistanceIndex1, 0), FN_CELLULAR_INDEX_MAX);
+
+	UpdateParams();
 }
 
 void UFastNoise::GetCellularDistance2Indices(int32& cellularDistanceIndex0, int32& cellularDistanceIndex1) const
@@ -276,400 +674,2956 @@ void UFastNoise::GetCellularDistance2Indices(int32& cellularDistanceIndex0, int3
 	cellularDistanceIndex1 = CellularDistanceIndex1;
 }
 
-uint8 UFastNoise::Index2D_12(uint8 offset, int32 x, int32 y) const
+// Sampling reads the compiled params, so it behaves the same as an evaluator created from this noise
+float UFastNoise::GetValue2D(float x, float y) const
 {
-	return m_perm12[(x & 0xff) + m_perm[(y & 0xff) + offset]];
+	return m_params.GetValue2D(x, y);
 }
-uint8 UFastNoise::Index3D_12(uint8 offset, int32 x, int32 y, int32 z) const
+
+float UFastNoise::GetValueFractal2D(float x, float y) const
 {
-	return m_perm12[(x & 0xff) + m_perm[(y & 0xff) + m_perm[(z & 0xff) + offset]]];
+	return m_params.GetValueFractal2D(x, y);
 }
-uint8 UFastNoise::Index4D_32(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
+
+float UFastNoise::GetPerlin2D(float x, float y) const
 {
-	return m_perm[(x & 0xff) + m_perm[(y & 0xff) + m_perm[(z & 0xff) + m_perm[(w & 0xff) + offset]]]] & 31;
+	return m_params.GetPerlin2D(x, y);
 }
-uint8 UFastNoise::Index2D_256(uint8 offset, int32 x, int32 y) const
+
+float UFastNoise::GetPerlinFractal2D(float x, float y) const
 {
-	return m_perm[(x & 0xff) + m_perm[(y & 0xff) + offset]];
+	return m_params.GetPerlinFractal2D(x, y);
 }
-uint8 UFastNoise::Index3D_256(uint8 offset, int32 x, int32 y, int32 z) const
+
+float UFastNoise::GetSimplex2D(float x, float y) const
 {
-	return m_perm[(x & 0xff) + m_perm[(y & 0xff) + m_perm[(z & 0xff) + offset]]];
+	return m_params.GetSimplex2D(x, y);
 }
-uint8 UFastNoise::Index4D_256(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
+
+float UFastNoise::GetSimplexFractal2D(float x, float y) const
 {
-	return m_perm[(x & 0xff) + m_perm[(y & 0xff) + m_perm[(z & 0xff) + m_perm[(w & 0xff) + offset]]]];
+	return m_params.GetSimplexFractal2D(x, y);
 }
 
-// Hashing
-#define X_PRIME 1619
-#define Y_PRIME 31337
-#define Z_PRIME 6971
-#define W_PRIME 1013
+float UFastNoise::GetCellular2D(float x, float y) const
+{
+	return m_params.GetCellular2D(x, y);
+}
 
-static float ValCoord2D(int32 seed, int32 x, int32 y)
+float UFastNoise::GetWhiteNoise2D(float x, float y) const
 {
-	int32 n = seed;
-	n ^= X_PRIME * x;
-	n ^= Y_PRIME * y;
+	return m_params.GetWhiteNoise2D(x, y);
+}
 
-	return (n * n * n * 60493) / float(2147483648);
+float UFastNoise::GetWhiteNoiseInt2D(int32 x, int32 y) const
+{
+	return m_params.GetWhiteNoiseInt2D(x, y);
 }
-static float ValCoord3D(int32 seed, int32 x, int32 y, int32 z)
+
+float UFastNoise::GetCubic2D(float x, float y) const
 {
-	int32 n = seed;
-	n ^= X_PRIME * x;
-	n ^= Y_PRIME * y;
-	n ^= Z_PRIME * z;
+	return m_params.GetCubic2D(x, y);
+}
 
-	return (n * n * n * 60493) / float(2147483648);
+float UFastNoise::GetCubicFractal2D(float x, float y) const
+{
+	return m_params.GetCubicFractal2D(x, y);
 }
-static float ValCoord4D(int32 seed, int32 x, int32 y, int32 z, int32 w)
+
+float UFastNoise::GetNoise2D(float x, float y) const
 {
-	int32 n = seed;
-	n ^= X_PRIME * x;
-	n ^= Y_PRIME * y;
-	n ^= Z_PRIME * z;
-	n ^= W_PRIME * w;
+	return m_params.GetNoise2D(x, y);
+}
 
-	return (n * n * n * 60493) / float(2147483648);
+void UFastNoise::GradientPerturb2D(float& x, float& y) const
+{
+	m_params.GradientPerturb2D(x, y);
 }
 
-float UFastNoise::ValCoord2DFast(uint8 offset, int32 x, int32 y) const
+void UFastNoise::GradientPerturbFractal2D(float& x, float& y) const
 {
-	return VAL_LUT[Index2D_256(offset, x, y)];
+	m_params.GradientPerturbFractal2D(x, y);
 }
-float UFastNoise::ValCoord3DFast(uint8 offset, int32 x, int32 y, int32 z) const
+
+float UFastNoise::GetValue3D(float x, float y, float z) const
 {
-	return VAL_LUT[Index3D_256(offset, x, y, z)];
+	return m_params.GetValue3D(x, y, z);
 }
 
-float UFastNoise::GradCoord2D(uint8 offset, int32 x, int32 y, float xd, float yd) const
+float UFastNoise::GetValueFractal3D(float x, float y, float z) const
 {
-	uint8 lutPos = Index2D_12(offset, x, y);
+	return m_params.GetValueFractal3D(x, y, z);
+}
 
-	return xd*GRAD_X[lutPos] + yd*GRAD_Y[lutPos];
+float UFastNoise::GetPerlin3D(float x, float y, float z) const
+{
+	return m_params.GetPerlin3D(x, y, z);
 }
-float UFastNoise::GradCoord3D(uint8 offset, int32 x, int32 y, int32 z, float xd, float yd, float zd) const
+
+float UFastNoise::GetPerlinFractal3D(float x, float y, float z) const
 {
-	uint8 lutPos = Index3D_12(offset, x, y, z);
+	return m_params.GetPerlinFractal3D(x, y, z);
+}
 
-	return xd*GRAD_X[lutPos] + yd*GRAD_Y[lutPos] + zd*GRAD_Z[lutPos];
+float UFastNoise::GetSimplex3D(float x, float y, float z) const
+{
+	return m_params.GetSimplex3D(x, y, z);
 }
-float UFastNoise::GradCoord4D(uint8 offset, int32 x, int32 y, int32 z, int32 w, float xd, float yd, float zd, float wd) const
+
+float UFastNoise::GetSimplexFractal3D(float x, float y, float z) const
 {
-	uint8 lutPos = Index4D_32(offset, x, y, z, w) << 2;
+	return m_params.GetSimplexFractal3D(x, y, z);
+}
 
-	return xd*GRAD_4D[lutPos] + yd*GRAD_4D[lutPos + 1] + zd*GRAD_4D[lutPos + 2] + wd*GRAD_4D[lutPos + 3];
+float UFastNoise::GetCellular3D(float x, float y, float z) const
+{
+	return m_params.GetCellular3D(x, y, z);
+}
+
+float UFastNoise::GetWhiteNoise3D(float x, float y, float z) const
+{
+	return m_params.GetWhiteNoise3D(x, y, z);
+}
+
+float UFastNoise::GetWhiteNoiseInt3D(int32 x, int32 y, int32 z) const
+{
+	return m_params.GetWhiteNoiseInt3D(x, y, z);
+}
+
+float UFastNoise::GetCubic3D(float x, float y, float z) const
+{
+	return m_params.GetCubic3D(x, y, z);
+}
+
+float UFastNoise::GetCubicFractal3D(float x, float y, float z) const
+{
+	return m_params.GetCubicFractal3D(x, y, z);
 }
 
 float UFastNoise::GetNoise3D(float x, float y, float z) const
 {
-	x *= Frequency;
-	y *= Frequency;
-	z *= Frequency;
+	return m_params.GetNoise3D(x, y, z);
+}
 
-	switch (NoiseType)
-	{
-	case EFNNoiseType::Value:
-		return SingleValue(0, x, y, z);
-	case EFNNoiseType::ValueFractal:
-		switch (FractalType)
-		{
-		case EFNFractalType::FBM:
-			return SingleValueFractalFBM(x, y, z);
-		case EFNFractalType::Billow:
-			return SingleValueFractalBillow(x, y, z);
-		case EFNFractalType::RigidMulti:
-			return SingleValueFractalRigidMulti(x, y, z);
-		default:
-			return 0;
+void UFastNoise::GradientPerturb3D(float& x, float& y, float& z) const
+{
+	m_params.GradientPerturb3D(x, y, z);
+}
+
+void UFastNoise::GradientPerturbFractal3D(float& x, float& y, float& z) const
+{
+	m_params.GradientPerturbFractal3D(x, y, z);
+}
+
+float UFastNoise::GetSimplex4D(float x, float y, float z, float w) const
+{
+	return m_params.GetSimplex4D(x, y, z, w);
+}
+
+float UFastNoise::GetWhiteNoise4D(float x, float y, float z, float w) const
+{
+	return m_params.GetWhiteNoise4D(x, y, z, w);
+}
+
+float UFastNoise::GetWhiteNoiseInt4D(int32 x, int32 y, int32 z, int32 w) const
+{
+	return m_params.GetWhiteNoiseInt4D(x, y, z, w);
+}
+
+float UFastNoise::GetValueDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	return m_params.GetValueDerivative2D(x, y, gradient);
+}
+
+float UFastNoise::GetValueFractalDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	return m_params.GetValueFractalDerivative2D(x, y, gradient);
+}
+
+float UFastNoise::GetPerlinDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	return m_params.GetPerlinDerivative2D(x, y, gradient);
+}
+
+float UFastNoise::GetPerlinFractalDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	return m_params.GetPerlinFractalDerivative2D(x, y, gradient);
+}
+
+float UFastNoise::GetSimplexDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	return m_params.GetSimplexDerivative2D(x, y, gradient);
+}
+
+float UFastNoise::GetSimplexFractalDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	return m_params.GetSimplexFractalDerivative2D(x, y, gradient);
+}
+
+float UFastNoise::GetNoiseDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	return m_params.GetNoiseDerivative2D(x, y, gradient);
+}
+
+float UFastNoise::GetValueDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	return m_params.GetValueDerivative3D(x, y, z, gradient);
+}
+
+float UFastNoise::GetValueFractalDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	return m_params.GetValueFractalDerivative3D(x, y, z, gradient);
+}
+
+float UFastNoise::GetPerlinDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	return m_params.GetPerlinDerivative3D(x, y, z, gradient);
+}
+
+float UFastNoise::GetPerlinFractalDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	return m_params.GetPerlinFractalDerivative3D(x, y, z, gradient);
+}
+
+float UFastNoise::GetSimplexDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	return m_params.GetSimplexDerivative3D(x, y, z, gradient);
+}
+
+float UFastNoise::GetSimplexFractalDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	return m_params.GetSimplexFractalDerivative3D(x, y, z, gradient);
+}
+
+float UFastNoise::GetNoiseDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	return m_params.GetNoiseDerivative3D(x, y, z, gradient);
+}
+
+void UFastNoise::GetNoiseSet2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize) const
+{
+	m_params.GetNoiseSet2D(noiseSet, xStart, yStart, xSize, ySize, stepSize);
+}
+
+void UFastNoise::GetNoiseSet3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize) const
+{
+	m_params.GetNoiseSet3D(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, stepSize);
+}
+
+void UFastNoise::GetNoiseSetParallel2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize, int32 minBatchSize) const
+{
+	m_params.GetNoiseSetParallel2D(noiseSet, xStart, yStart, xSize, ySize, stepSize, minBatchSize);
+}
+
+void UFastNoise::GetNoiseSetParallel3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize, int32 minBatchSize) const
+{
+	m_params.GetNoiseSetParallel3D(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, stepSize, minBatchSize);
+}
+
+void UFastNoise::GetNoisePointSet2D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const
+{
+	m_params.GetNoisePointSet2D(noiseSet, xPoints, yPoints);
+}
+
+void UFastNoise::GetNoisePointSet3D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const
+{
+	m_params.GetNoisePointSet3D(noiseSet, xPoints, yPoints, zPoints);
+}
+
+void UFastNoise::GradientPerturbSet2D(TArrayView<float> xPoints, TArrayView<float> yPoints) const
+{
+	m_params.GradientPerturbSet2D(xPoints, yPoints);
+}
+
+void UFastNoise::GradientPerturbFractalSet2D(TArrayView<float> xPoints, TArrayView<float> yPoints) const
+{
+	m_params.GradientPerturbFractalSet2D(xPoints, yPoints);
+}
+
+void UFastNoise::GradientPerturbSet3D(TArrayView<float> xPoints, TArrayView<float> yPoints, TArrayView<float> zPoints) const
+{
+	m_params.GradientPerturbSet3D(xPoints, yPoints, zPoints);
+}
+
+void UFastNoise::GradientPerturbFractalSet3D(TArrayView<float> xPoints, TArrayView<float> yPoints, TArrayView<float> zPoints) const
+{
+	m_params.GradientPerturbFractalSet3D(xPoints, yPoints, zPoints);
+}
+
+void UFastNoise::GetPerturbedNoisePointSet2D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, bool fractalPerturb, const UFastNoise* perturbNoise) const
+{
+	m_params.GetPerturbedNoisePointSet2D(noiseSet, xPoints, yPoints, perturbNoise ? perturbNoise->m_params : m_params, fractalPerturb);
+}
+
+void UFastNoise::GetPerturbedNoisePointSet3D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints, bool fractalPerturb, const UFastNoise* perturbNoise) const
+{
+	m_params.GetPerturbedNoisePointSet3D(noiseSet, xPoints, yPoints, zPoints, perturbNoise ? perturbNoise->m_params : m_params, fractalPerturb);
+}
+
+void UFastNoise::GetNoiseDerivativeSet2D(TArrayView<float> noiseSet, TArrayView<FVector2D> gradientSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize) const
+{
+	m_params.GetNoiseDerivativeSet2D(noiseSet, gradientSet, xStart, yStart, xSize, ySize, stepSize);
+}
+
+void UFastNoise::GetNoiseDerivativeSet3D(TArrayView<float> noiseSet, TArrayView<FVector> gradientSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize) const
+{
+	m_params.GetNoiseDerivativeSet3D(noiseSet, gradientSet, xStart, yStart, zStart, xSize, ySize, zSize, stepSize);
+}
+
+void UFastNoise::GetNoiseDerivativePointSet2D(TArrayView<float> noiseSet, TArrayView<FVector2D> gradientSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const
+{
+	m_params.GetNoiseDerivativePointSet2D(noiseSet, gradientSet, xPoints, yPoints);
+}
+
+void UFastNoise::GetNoiseDerivativePointSet3D(TArrayView<float> noiseSet, TArrayView<FVector> gradientSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const
+{
+	m_params.GetNoiseDerivativePointSet3D(noiseSet, gradientSet, xPoints, yPoints, zPoints);
+}
+
+void UFastNoise::GetHeightmap2D(TArrayView<float> heights, TArrayView<FVector> normals, TArrayView<float> slopes, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize, float heightScale) const
+{
+	m_params.GetHeightmap2D(heights, normals, slopes, xStart, yStart, xSize, ySize, stepSize, heightScale);
+}
+
+FFastNoiseCellularSample UFastNoise::GetCellularSample2D(float x, float y) const
+{
+	return m_params.GetCellularSample2D(x, y);
+}
+
+FFastNoiseCellularSample UFastNoise::GetCellularSample3D(float x, float y, float z) const
+{
+	return m_params.GetCellularSample3D(x, y, z);
+}
+
+void UFastNoise::GetCellularSamplePointSet2D(const FFastNoiseCellularSampleSet& sampleSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const
+{
+	m_params.GetCellularSamplePointSet2D(sampleSet, xPoints, yPoints);
+}
+
+void UFastNoise::GetCellularSamplePointSet3D(const FFastNoiseCellularSampleSet& sampleSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const
+{
+	m_params.GetCellularSamplePointSet3D(sampleSet, xPoints, yPoints, zPoints);
+}
+
+float UFastNoise::GetNoiseBandLimited2D(float x, float y, float footprint) const
+{
+	return m_params.GetNoiseBandLimited2D(x, y, footprint);
+}
+
+float UFastNoise::GetNoiseBandLimited3D(float x, float y, float z, float footprint) const
+{
+	return m_params.GetNoiseBandLimited3D(x, y, z, footprint);
+}
+
+void UFastNoise::GetNoiseSetBandLimited2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize) const
+{
+	m_params.GetNoiseSetBandLimited2D(noiseSet, xStart, yStart, xSize, ySize, stepSize);
+}
+
+void UFastNoise::GetNoiseSetBandLimited3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize) const
+{
+	m_params.GetNoiseSetBandLimited3D(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, stepSize);
+}
+
+float UFastNoise::GetNoiseLarge2D(double x, double y) const
+{
+	return m_params.GetNoiseLarge2D(x, y);
+}
+
+float UFastNoise::GetNoiseLarge3D(double x, double y, double z) const
+{
+	return m_params.GetNoiseLarge3D(x, y, z);
+}
+
+void UFastNoise::GetNoiseSetLarge2D(TArrayView<float> noiseSet, double xStart, double yStart, int32 xSize, int32 ySize, float stepSize) const
+{
+	m_params.GetNoiseSetLarge2D(noiseSet, xStart, yStart, xSize, ySize, stepSize);
+}
+
+void UFastNoise::GetNoiseSetLarge3D(TArrayView<float> noiseSet, double xStart, double yStart, double zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize) const
+{
+	m_params.GetNoiseSetLarge3D(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, stepSize);
+}
+
+// Integer hashing, the seed and every coordinate are mixed with a multiply by a prime and finished with a xorshift
+// The xorshift clears the sign bit, so only the low bits are used as an index, values come from ValCoord2D/3D
+// Unsigned math keeps the wrap around defined, the vectorized kernels compute the same bits
+static FORCEINLINE int32 HashFinish(uint32 hash)
+{
+	int32 n = (int32)(hash * hash * hash * 60493u);
+	return (n >> 13) ^ n;
+}
+
+int32 FFastNoiseParams::Hash2D(uint8 offset, int32 x, int32 y) const
+{
+	uint32 hash = (uint32)Seed + offset;
+	hash ^= X_PRIME * (uint32)x;
+	hash ^= Y_PRIME * (uint32)y;
+
+	return HashFinish(hash);
+}
+int32 FFastNoiseParams::Hash3D(uint8 offset, int32 x, int32 y, int32 z) const
+{
+	uint32 hash = (uint32)Seed + offset;
+	hash ^= X_PRIME * (uint32)x;
+	hash ^= Y_PRIME * (uint32)y;
+	hash ^= Z_PRIME * (uint32)z;
+
+	return HashFinish(hash);
+}
+int32 FFastNoiseParams::Hash4D(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
+{
+	uint32 hash = (uint32)Seed + offset;
+	hash ^= X_PRIME * (uint32)x;
+	hash ^= Y_PRIME * (uint32)y;
+	hash ^= Z_PRIME * (uint32)z;
+	hash ^= W_PRIME * (uint32)w;
+
+	return HashFinish(hash);
+}
+
+// Gradient from the low 4 bits of an integer hash: the 12 cube edge directions, 4 of them twice, as in improved Perlin noise
+// Selected with compares instead of a table so the vectorized kernels need no gather
+static FORCEINLINE float HashGrad(int32 hash, float xd, float yd, float zd)
+{
+	int32 h = hash & 15;
+	float u = h < 8 ? xd : yd;
+	float v = h < 4 ? yd : (h & 13) == 12 ? xd : zd;
+
+	return ((h & 1) ? 0.0f - u : u) + ((h & 2) ? 0.0f - v : v);
+}
+
+// The Permutation versions read the 256 entry table two to four times in a row, each index depending on the previous read
+uint8 FFastNoiseParams::Index2D_12(uint8 offset, int32 x, int32 y) const
+{
+	return Perm12[(x & 0xff) + Perm[(y & 0xff) + offset]];
+}
+uint8 FFastNoiseParams::Index3D_12(uint8 offset, int32 x, int32 y, int32 z) const
+{
+	return Perm12[(x & 0xff) + Perm[(y & 0xff) + Perm[(z & 0xff) + offset]]];
+}
+template <typename THash>
+uint8 FFastNoiseParams::Index4D_32(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
+{
+	if (THash::Integer)
+		return Hash4D(offset, x, y, z, w) & 31;
+
+	return Perm[(x & 0xff) + Perm[(y & 0xff) + Perm[(z & 0xff) + Perm[(w & 0xff) + offset]]]] & 31;
+}
+template <typename THash>
+uint8 FFastNoiseParams::Index2D_256(uint8 offset, int32 x, int32 y) const
+{
+	if (THash::Integer)
+		return Hash2D(offset, x, y) & 0xff;
+
+	return Perm[(x & 0xff) + Perm[(y & 0xff) + offset]];
+}
+template <typename THash>
+uint8 FFastNoiseParams::Index3D_256(uint8 offset, int32 x, int32 y, int32 z) const
+{
+	if (THash::Integer)
+		return Hash3D(offset, x, y, z) & 0xff;
+
+	return Perm[(x & 0xff) + Perm[(y & 0xff) + Perm[(z & 0xff) + offset]]];
+}
+template <typename THash>
+uint8 FFastNoiseParams::Index4D_256(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
+{
+	if (THash::Integer)
+		return Hash4D(offset, x, y, z, w) & 0xff;
+
+	return Perm[(x & 0xff) + Perm[(y & 0xff) + Perm[(z & 0xff) + Perm[(w & 0xff) + offset]]]];
+}
+
+// Hashing
+static float ValCoord2D(int32 seed, int32 x, int32 y)
+{
+	int32 n = seed;
+	n ^= X_PRIME * x;
+	n ^= Y_PRIME * y;
+
+	return (n * n * n * 60493) / float(2147483648);
+}
+static float ValCoord3D(int32 seed, int32 x, int32 y, int32 z)
+{
+	int32 n = seed;
+	n ^= X_PRIME * x;
+	n ^= Y_PRIME * y;
+	n ^= Z_PRIME * z;
+
+	return (n * n * n * 60493) / float(2147483648);
+}
+static float ValCoord4D(int32 seed, int32 x, int32 y, int32 z, int32 w)
+{
+	int32 n = seed;
+	n ^= X_PRIME * x;
+	n ^= Y_PRIME * y;
+	n ^= Z_PRIME * z;
+	n ^= W_PRIME * w;
+
+	return (n * n * n * 60493) / float(2147483648);
+}
+
+template <typename THash>
+float FFastNoiseParams::ValCoord2DFast(uint8 offset, int32 x, int32 y) const
+{
+	if (THash::Integer)
+		return ValCoord2D((int32)((uint32)Seed + offset), x, y);
+
+	return VAL_LUT[Index2D_256<THash>(offset, x, y)];
+}
+template <typename THash>
+float FFastNoiseParams::ValCoord3DFast(uint8 offset, int32 x, int32 y, int32 z) const
+{
+	if (THash::Integer)
+		return ValCoord3D((int32)((uint32)Seed + offset), x, y, z);
+
+	return VAL_LUT[Index3D_256<THash>(offset, x, y, z)];
+}
+
+template <typename THash>
+int32 FFastNoiseParams::GradHash2D(uint8 offset, int32 x, int32 y) const
+{
+	if (THash::Integer)
+		return Hash2D(offset, x, y);
+
+	return Index2D_12(offset, x, y);
+}
+template <typename THash>
+int32 FFastNoiseParams::GradHash3D(uint8 offset, int32 x, int32 y, int32 z) const
+{
+	if (THash::Integer)
+		return Hash3D(offset, x, y, z);
+
+	return Index3D_12(offset, x, y, z);
+}
+
+template <typename THash>
+float FFastNoiseParams::GradDot2D(int32 gradHash, float xd, float yd) const
+{
+	if (THash::Integer)
+		return HashGrad(gradHash, xd, yd, 0.0f);
+
+	return xd*GRAD_X[gradHash] + yd*GRAD_Y[gradHash];
+}
+template <typename THash>
+float FFastNoiseParams::GradDot3D(int32 gradHash, float xd, float yd, float zd) const
+{
+	if (THash::Integer)
+		return HashGrad(gradHash, xd, yd, zd);
+
+	return xd*GRAD_X[gradHash] + yd*GRAD_Y[gradHash] + zd*GRAD_Z[gradHash];
+}
+
+template <typename THash>
+float FFastNoiseParams::GradCoord2D(uint8 offset, int32 x, int32 y, float xd, float yd) const
+{
+	return GradDot2D<THash>(GradHash2D<THash>(offset, x, y), xd, yd);
+}
+template <typename THash>
+float FFastNoiseParams::GradCoord3D(uint8 offset, int32 x, int32 y, int32 z, float xd, float yd, float zd) const
+{
+	return GradDot3D<THash>(GradHash3D<THash>(offset, x, y, z), xd, yd, zd);
+}
+template <typename THash>
+float FFastNoiseParams::GradCoord4D(uint8 offset, int32 x, int32 y, int32 z, int32 w, float xd, float yd, float zd, float wd) const
+{
+	uint8 lutPos = Index4D_32<THash>(offset, x, y, z, w) << 2;
+
+	return xd*GRAD_4D[lutPos] + yd*GRAD_4D[lutPos + 1] + zd*GRAD_4D[lutPos + 2] + wd*GRAD_4D[lutPos + 3];
+}
+
+template <typename THash>
+float FFastNoiseParams::GradCoord2D(uint8 offset, int32 x, int32 y, float xd, float yd, float& xGrad, float& yGrad) const
+{
+	if (THash::Integer)
+	{
+		int32 hash = Hash2D(offset, x, y);
+		xGrad = HashGrad(hash, 1, 0, 0);
+		yGrad = HashGrad(hash, 0, 1, 0);
+		return HashGrad(hash, xd, yd, 0.0f);
+	}
+
+	uint8 lutPos = Index2D_12(offset, x, y);
+	xGrad = GRAD_X[lutPos];
+	yGrad = GRAD_Y[lutPos];
+
+	return xd*GRAD_X[lutPos] + yd*GRAD_Y[lutPos];
+}
+template <typename THash>
+float FFastNoiseParams::GradCoord3D(uint8 offset, int32 x, int32 y, int32 z, float xd, float yd, float zd, float& xGrad, float& yGrad, float& zGrad) const
+{
+	if (THash::Integer)
+	{
+		int32 hash = Hash3D(offset, x, y, z);
+		xGrad = HashGrad(hash, 1, 0, 0);
+		yGrad = HashGrad(hash, 0, 1, 0);
+		zGrad = HashGrad(hash, 0, 0, 1);
+		return HashGrad(hash, xd, yd, zd);
+	}
+
+	uint8 lutPos = Index3D_12(offset, x, y, z);
+	xGrad = GRAD_X[lutPos];
+	yGrad = GRAD_Y[lutPos];
+	zGrad = GRAD_Z[lutPos];
+
+	return xd*GRAD_X[lutPos] + yd*GRAD_Y[lutPos] + zd*GRAD_Z[lutPos];
+}
+
+float FFastNoiseParams::GetNoise3D(float x, float y, float z) const
+{
+	return SampleNoise3D(NoiseType, x * Frequency, y * Frequency, z * Frequency);
+}
+
+float FFastNoiseParams::GetNoise2D(float x, float y) const
+{
+	return SampleNoise2D(NoiseType, x * Frequency, y * Frequency);
+}
+
+// Whether a single point of noiseType runs its octaves in SIMD lanes rather than one after the other
+// An integer hash is arithmetic only, with the permutation hash the lanes only beat the scalar loop for Simplex, which hashes 4 corners instead of 8
+bool FFastNoiseParams::SamplesOctavesInLanes(EFNNoiseType noiseType) const
+{
+	if (!FractalKernels || FractalOctaves < 2)
+		return false;
+
+	if (HashType == EFNHashType::Permutation)
+		return noiseType == EFNNoiseType::SimplexFractal;
+
+	return noiseType == EFNNoiseType::ValueFractal || noiseType == EFNNoiseType::PerlinFractal || noiseType == EFNNoiseType::SimplexFractal;
+}
+
+float FFastNoiseParams::SampleNoise3D(EFNNoiseType noiseType, float x, float y, float z) const
+{
+	// A single point has no other points to fill the SIMD lanes with, so its octaves fill them instead
+	if (SamplesOctavesInLanes(noiseType))
+		return FractalKernels->SampleFractal3D(*this, noiseType, x, y, z);
+
+	float noise = 0;
+	DispatchNoise3D(noiseType, [&](auto noiseFunc) { noise = noiseFunc(x, y, z); });
+	return noise;
+}
+
+float FFastNoiseParams::SampleNoise2D(EFNNoiseType noiseType, float x, float y) const
+{
+	if (SamplesOctavesInLanes(noiseType))
+		return FractalKernels->SampleFractal2D(*this, noiseType, x, y);
+
+	float noise = 0;
+	DispatchNoise2D(noiseType, [&](auto noiseFunc) { noise = noiseFunc(x, y); });
+	return noise;
+}
+
+// Noise Sets
+static void FillNoiseSetAxis(float* coords, float start, float stepSize, int32 size, float frequency)
+{
+	for (int32 i = 0; i < size; i++)
+		coords[i] = (start + i * stepSize) * frequency;
+}
+
+template <typename FNoiseFunc>
+static void FillNoiseSet2D(float* noiseSet, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize, FNoiseFunc noiseFunc)
+{
+	int32 index = 0;
+
+	for (int32 y = 0; y < ySize; y++)
+	{
+		float yf = yCoords[y];
+
+		for (int32 x = 0; x < xSize; x++)
+			noiseSet[index++] = noiseFunc(xCoords[x], yf);
+	}
+}
+
+template <typename FNoiseFunc>
+static void FillNoiseSet3D(float* noiseSet, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize, FNoiseFunc noiseFunc)
+{
+	int32 index = 0;
+
+	for (int32 z = 0; z < zSize; z++)
+	{
+		float zf = zCoords[z];
+
+		for (int32 y = 0; y < ySize; y++)
+		{
+			float yf = yCoords[y];
+
+			for (int32 x = 0; x < xSize; x++)
+				noiseSet[index++] = noiseFunc(xCoords[x], yf, zf);
+		}
+	}
+}
+
+template <typename FNoiseFunc>
+static void FillNoisePointSet2D(float* noiseSet, const float* xPoints, const float* yPoints, int32 count, float frequency, FNoiseFunc noiseFunc)
+{
+	for (int32 i = 0; i < count; i++)
+		noiseSet[i] = noiseFunc(xPoints[i] * frequency, yPoints[i] * frequency);
+}
+
+template <typename FNoiseFunc>
+static void FillNoisePointSet3D(float* noiseSet, const float* xPoints, const float* yPoints, const float* zPoints, int32 count, float frequency, FNoiseFunc noiseFunc)
+{
+	for (int32 i = 0; i < count; i++)
+		noiseSet[i] = noiseFunc(xPoints[i] * frequency, yPoints[i] * frequency, zPoints[i] * frequency);
+}
+
+template <typename FNoiseSetFunc, typename FNoiseFunc>
+void FFastNoiseParams::DispatchFractal2D(FNoiseSetFunc& fill, bool fractal, FNoiseFunc noiseFunc) const
+{
+	if (!fractal)
+	{
+		fill([&](float x, float y) { return noiseFunc(BaseOffset, x, y); });
+		return;
+	}
+
+	switch (FractalType)
+	{
+	case EFNFractalType::FBM:
+		fill([&](float x, float y) { return SingleFractal<EFNFractalType::FBM>(x, y, noiseFunc); });
+		break;
+	case EFNFractalType::Billow:
+		fill([&](float x, float y) { return SingleFractal<EFNFractalType::Billow>(x, y, noiseFunc); });
+		break;
+	case EFNFractalType::RigidMulti:
+		fill([&](float x, float y) { return SingleFractal<EFNFractalType::RigidMulti>(x, y, noiseFunc); });
+		break;
+	}
+}
+
+template <typename FNoiseSetFunc>
+bool FFastNoiseParams::DispatchNoise2D(EFNNoiseType noiseType, FNoiseSetFunc fill) const
+{
+	switch (noiseType)
+	{
+	case EFNNoiseType::Value:
+	case EFNNoiseType::ValueFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchInterp(Interpolation, [&](auto interp)
+			{
+				DispatchFractal2D(fill, noiseType == EFNNoiseType::ValueFractal,
+					[this](uint8 offset, float x, float y) { return SingleValue<decltype(hash), decltype(interp)>(offset, x, y); });
+			});
+		});
+		return true;
+	case EFNNoiseType::Perlin:
+	case EFNNoiseType::PerlinFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchInterp(Interpolation, [&](auto interp)
+			{
+				DispatchFractal2D(fill, noiseType == EFNNoiseType::PerlinFractal,
+					[this](uint8 offset, float x, float y) { return SinglePerlin<decltype(hash), decltype(interp)>(offset, x, y); });
+			});
+		});
+		return true;
+	case EFNNoiseType::Simplex:
+	case EFNNoiseType::SimplexFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchFractal2D(fill, noiseType == EFNNoiseType::SimplexFractal,
+				[this](uint8 offset, float x, float y) { return SingleSimplex<decltype(hash)>(offset, x, y); });
+		});
+		return true;
+	case EFNNoiseType::Cellular:
+		DispatchCellular2D(fill);
+		return true;
+	case EFNNoiseType::WhiteNoise:
+		fill([this](float x, float y) { return GetWhiteNoise2D(x, y); });
+		return true;
+	case EFNNoiseType::Cubic:
+	case EFNNoiseType::CubicFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchFractal2D(fill, noiseType == EFNNoiseType::CubicFractal,
+				[this](uint8 offset, float x, float y) { return SingleCubic<decltype(hash)>(offset, x, y); });
+		});
+		return true;
+	}
+
+	return false;
+}
+
+template <typename FNoiseSetFunc, typename FNoiseFunc>
+void FFastNoiseParams::DispatchFractal3D(FNoiseSetFunc& fill, bool fractal, FNoiseFunc noiseFunc) const
+{
+	if (!fractal)
+	{
+		fill([&](float x, float y, float z) { return noiseFunc(BaseOffset, x, y, z); });
+		return;
+	}
+
+	switch (FractalType)
+	{
+	case EFNFractalType::FBM:
+		fill([&](float x, float y, float z) { return SingleFractal<EFNFractalType::FBM>(x, y, z, noiseFunc); });
+		break;
+	case EFNFractalType::Billow:
+		fill([&](float x, float y, float z) { return SingleFractal<EFNFractalType::Billow>(x, y, z, noiseFunc); });
+		break;
+	case EFNFractalType::RigidMulti:
+		fill([&](float x, float y, float z) { return SingleFractal<EFNFractalType::RigidMulti>(x, y, z, noiseFunc); });
+		break;
+	}
+}
+
+template <typename FNoiseSetFunc>
+bool FFastNoiseParams::DispatchNoise3D(EFNNoiseType noiseType, FNoiseSetFunc fill) const
+{
+	switch (noiseType)
+	{
+	case EFNNoiseType::Value:
+	case EFNNoiseType::ValueFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchInterp(Interpolation, [&](auto interp)
+			{
+				DispatchFractal3D(fill, noiseType == EFNNoiseType::ValueFractal,
+					[this](uint8 offset, float x, float y, float z) { return SingleValue<decltype(hash), decltype(interp)>(offset, x, y, z); });
+			});
+		});
+		return true;
+	case EFNNoiseType::Perlin:
+	case EFNNoiseType::PerlinFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchInterp(Interpolation, [&](auto interp)
+			{
+				DispatchFractal3D(fill, noiseType == EFNNoiseType::PerlinFractal,
+					[this](uint8 offset, float x, float y, float z) { return SinglePerlin<decltype(hash), decltype(interp)>(offset, x, y, z); });
+			});
+		});
+		return true;
+	case EFNNoiseType::Simplex:
+	case EFNNoiseType::SimplexFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchFractal3D(fill, noiseType == EFNNoiseType::SimplexFractal,
+				[this](uint8 offset, float x, float y, float z) { return SingleSimplex<decltype(hash)>(offset, x, y, z); });
+		});
+		return true;
+	case EFNNoiseType::Cellular:
+		DispatchCellular3D(fill);
+		return true;
+	case EFNNoiseType::WhiteNoise:
+		fill([this](float x, float y, float z) { return GetWhiteNoise3D(x, y, z); });
+		return true;
+	case EFNNoiseType::Cubic:
+	case EFNNoiseType::CubicFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchFractal3D(fill, noiseType == EFNNoiseType::CubicFractal,
+				[this](uint8 offset, float x, float y, float z) { return SingleCubic<decltype(hash)>(offset, x, y, z); });
+		});
+		return true;
+	}
+
+	return false;
+}
+
+void FFastNoiseParams::GetNoiseSet2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize) const
+{
+	if (xSize <= 0 || ySize <= 0)
+		return;
+
+	check(noiseSet.Num() >= xSize * ySize);
+
+	// X coordinates are padded so the vectorized kernels can always load a full vector
+	TArray<float> coords;
+	coords.SetNumUninitialized(ySize + xSize + FastNoiseSIMD::MaxVectorWidth);
+	float* yCoords = coords.GetData();
+	float* xCoords = yCoords + ySize;
+
+	FillNoiseSetAxis(xCoords, xStart, stepSize, xSize + FastNoiseSIMD::MaxVectorWidth, Frequency);
+	FillNoiseSetAxis(yCoords, yStart, stepSize, ySize, Frequency);
+
+	FillNoiseGrid2D(noiseSet.GetData(), xCoords, yCoords, xSize, ySize);
+}
+
+void FFastNoiseParams::GetNoiseSetParallel2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize, int32 minBatchSize) const
+{
+	if (xSize <= 0 || ySize <= 0)
+		return;
+
+	check(noiseSet.Num() >= xSize * ySize);
+
+	TArray<float> coords;
+	coords.SetNumUninitialized(ySize + xSize + FastNoiseSIMD::MaxVectorWidth);
+	float* yCoords = coords.GetData();
+	float* xCoords = yCoords + ySize;
+
+	FillNoiseSetAxis(xCoords, xStart, stepSize, xSize + FastNoiseSIMD::MaxVectorWidth, Frequency);
+	FillNoiseSetAxis(yCoords, yStart, stepSize, ySize, Frequency);
+
+	float* out = noiseSet.GetData();
+	int32 rowsPerTask = FMath::DivideAndRoundUp(FMath::Max(minBatchSize, 1), xSize);
+	int32 taskCount = FMath::DivideAndRoundUp(ySize, rowsPerTask);
+
+	// Every task fills whole rows from the shared axis coordinates, so the split never changes a sample
+	ParallelFor(taskCount, [&](int32 task)
+	{
+		int32 y = task * rowsPerTask;
+		int32 rows = FMath::Min(rowsPerTask, ySize - y);
+
+		FillNoiseGrid2D(out + y * xSize, xCoords, yCoords + y, xSize, rows);
+	}, taskCount == 1);
+}
+
+void FFastNoiseParams::FillNoiseGrid2D(float* out, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize) const
+{
+	if (NoiseType == EFNNoiseType::Cellular && CellularReturnType == EFNCellularReturnType::NoiseLookup)
+	{
+		FillCellularLookupGrid2D(out, xCoords, yCoords, xSize, ySize);
+		return;
+	}
+
+	if (FillsGridByOctave())
+	{
+		FillNoiseGridOctaves2D(out, xCoords, yCoords, xSize, ySize);
+		return;
+	}
+
+	if (Kernels)
+	{
+		Kernels->FillSet2D(*this, out, xCoords, yCoords, xSize, ySize);
+		return;
+	}
+
+	if (FillLatticeGrid2D(out, xCoords, yCoords, xSize, ySize))
+		return;
+
+	if (!DispatchNoise2D(NoiseType, [&](auto noiseFunc) { FillNoiseSet2D(out, xCoords, yCoords, xSize, ySize, noiseFunc); }))
+		FMemory::Memzero(out, xSize * ySize * sizeof(float));
+}
+
+void FFastNoiseParams::GetNoiseSet3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize) const
+{
+	if (xSize <= 0 || ySize <= 0 || zSize <= 0)
+		return;
+
+	check(noiseSet.Num() >= xSize * ySize * zSize);
+
+	// X coordinates are padded so the vectorized kernels can always load a full vector
+	TArray<float> coords;
+	coords.SetNumUninitialized(ySize + zSize + xSize + FastNoiseSIMD::MaxVectorWidth);
+	float* yCoords = coords.GetData();
+	float* zCoords = yCoords + ySize;
+	float* xCoords = zCoords + zSize;
+
+	FillNoiseSetAxis(xCoords, xStart, stepSize, xSize + FastNoiseSIMD::MaxVectorWidth, Frequency);
+	FillNoiseSetAxis(yCoords, yStart, stepSize, ySize, Frequency);
+	FillNoiseSetAxis(zCoords, zStart, stepSize, zSize, Frequency);
+
+	FillNoiseGrid3D(noiseSet.GetData(), xCoords, yCoords, zCoords, xSize, ySize, zSize);
+}
+
+void FFastNoiseParams::GetNoiseSetParallel3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize, int32 minBatchSize) const
+{
+	if (xSize <= 0 || ySize <= 0 || zSize <= 0)
+		return;
+
+	check(noiseSet.Num() >= xSize * ySize * zSize);
+
+	TArray<float> coords;
+	coords.SetNumUninitialized(ySize + zSize + xSize + FastNoiseSIMD::MaxVectorWidth);
+	float* yCoords = coords.GetData();
+	float* zCoords = yCoords + ySize;
+	float* xCoords = zCoords + zSize;
+
+	FillNoiseSetAxis(xCoords, xStart, stepSize, xSize + FastNoiseSIMD::MaxVectorWidth, Frequency);
+	FillNoiseSetAxis(yCoords, yStart, stepSize, ySize, Frequency);
+	FillNoiseSetAxis(zCoords, zStart, stepSize, zSize, Frequency);
+
+	float* out = noiseSet.GetData();
+	int32 rowCount = ySize * zSize;
+	int32 rowsPerTask = FMath::DivideAndRoundUp(FMath::Max(minBatchSize, 1), xSize);
+	int32 taskCount = FMath::DivideAndRoundUp(rowCount, rowsPerTask);
+
+	// Tasks are runs of whole rows, split where they cross a z slice
+	ParallelFor(taskCount, [&](int32 task)
+	{
+		int32 row = task * rowsPerTask;
+
+		FillNoiseGridRows3D(out, xCoords, yCoords, zCoords, xSize, ySize, row, FMath::Min(row + rowsPerTask, rowCount));
+	}, taskCount == 1);
+}
+
+void FFastNoiseParams::FillNoiseGridRows3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 rowStart, int32 rowEnd) const
+{
+	int32 row = rowStart;
+
+	while (row < rowEnd)
+	{
+		int32 z = row / ySize;
+		int32 y = row - z * ySize;
+		int32 rows = FMath::Min(rowEnd - row, ySize - y);
+
+		FillNoiseGrid3D(out + row * xSize, xCoords, yCoords + y, zCoords + z, xSize, rows, 1);
+		row += rows;
+	}
+}
+
+void FFastNoiseParams::FillNoiseGrid3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize) const
+{
+	if (NoiseType == EFNNoiseType::Cellular && CellularReturnType == EFNCellularReturnType::NoiseLookup)
+	{
+		FillCellularLookupGrid3D(out, xCoords, yCoords, zCoords, xSize, ySize, zSize);
+		return;
+	}
+
+	if (FillsGridByOctave())
+	{
+		FillNoiseGridOctaves3D(out, xCoords, yCoords, zCoords, xSize, ySize, zSize);
+		return;
+	}
+
+	if (Kernels)
+	{
+		Kernels->FillSet3D(*this, out, xCoords, yCoords, zCoords, xSize, ySize, zSize);
+		return;
+	}
+
+	if (FillLatticeGrid3D(out, xCoords, yCoords, zCoords, xSize, ySize, zSize))
+		return;
+
+	if (!DispatchNoise3D(NoiseType, [&](auto noiseFunc) { FillNoiseSet3D(out, xCoords, yCoords, zCoords, xSize, ySize, zSize, noiseFunc); }))
+		FMemory::Memzero(out, xSize * ySize * zSize * sizeof(float));
+}
+
+// Samples generated by an async request between checks for cancellation
+static const int32 AsyncTileSize = 4096;
+
+FFastNoiseAsyncRequestRef UFastNoise::GetNoiseSet2DAsync(float xStart, float yStart, int32 xSize, int32 ySize, float stepSize, FFastNoiseAsyncDelegate onComplete) const
+{
+	FFastNoiseAsyncRequestRef request = MakeShareable(new FFastNoiseAsyncRequest());
+	FFastNoiseEvaluator evaluator = CreateEvaluator();
+
+	Async<void>(EAsyncExecution::ThreadPool, [evaluator, request, onComplete, xStart, yStart, xSize, ySize, stepSize]()
+	{
+		const FFastNoiseParams& params = evaluator.GetParams();
+		TArray<float> noiseSet;
+
+		if (xSize > 0 && ySize > 0)
+		{
+			TArray<float> coords;
+			coords.SetNumUninitialized(ySize + xSize + FastNoiseSIMD::MaxVectorWidth);
+			float* yCoords = coords.GetData();
+			float* xCoords = yCoords + ySize;
+
+			FillNoiseSetAxis(xCoords, xStart, stepSize, xSize + FastNoiseSIMD::MaxVectorWidth, params.Frequency);
+			FillNoiseSetAxis(yCoords, yStart, stepSize, ySize, params.Frequency);
+
+			noiseSet.SetNumUninitialized(xSize * ySize);
+			int32 rowsPerTile = FMath::DivideAndRoundUp(AsyncTileSize, xSize);
+
+			for (int32 y = 0; y < ySize; y += rowsPerTile)
+			{
+				if (request->IsCancelled())
+				{
+					noiseSet.Empty();
+					break;
+				}
+
+				params.FillNoiseGrid2D(noiseSet.GetData() + y * xSize, xCoords, yCoords + y, xSize, FMath::Min(rowsPerTile, ySize - y));
+			}
+		}
+
+		FFastNoiseAsyncRequest::Complete(request, MoveTemp(noiseSet), onComplete);
+	});
+
+	return request;
+}
+
+FFastNoiseAsyncRequestRef UFastNoise::GetNoiseSet3DAsync(float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize, FFastNoiseAsyncDelegate onComplete) const
+{
+	FFastNoiseAsyncRequestRef request = MakeShareable(new FFastNoiseAsyncRequest());
+	FFastNoiseEvaluator evaluator = CreateEvaluator();
+
+	Async<void>(EAsyncExecution::ThreadPool, [evaluator, request, onComplete, xStart, yStart, zStart, xSize, ySize, zSize, stepSize]()
+	{
+		const FFastNoiseParams& params = evaluator.GetParams();
+		TArray<float> noiseSet;
+
+		if (xSize > 0 && ySize > 0 && zSize > 0)
+		{
+			TArray<float> coords;
+			coords.SetNumUninitialized(ySize + zSize + xSize + FastNoiseSIMD::MaxVectorWidth);
+			float* yCoords = coords.GetData();
+			float* zCoords = yCoords + ySize;
+			float* xCoords = zCoords + zSize;
+
+			FillNoiseSetAxis(xCoords, xStart, stepSize, xSize + FastNoiseSIMD::MaxVectorWidth, params.Frequency);
+			FillNoiseSetAxis(yCoords, yStart, stepSize, ySize, params.Frequency);
+			FillNoiseSetAxis(zCoords, zStart, stepSize, zSize, params.Frequency);
+
+			noiseSet.SetNumUninitialized(xSize * ySize * zSize);
+			int32 rowCount = ySize * zSize;
+			int32 rowsPerTile = FMath::DivideAndRoundUp(AsyncTileSize, xSize);
+
+			for (int32 row = 0; row < rowCount; row += rowsPerTile)
+			{
+				if (request->IsCancelled())
+				{
+					noiseSet.Empty();
+					break;
+				}
+
+				params.FillNoiseGridRows3D(noiseSet.GetData(), xCoords, yCoords, zCoords, xSize, ySize, row, FMath::Min(row + rowsPerTile, rowCount));
+			}
+		}
+
+		FFastNoiseAsyncRequest::Complete(request, MoveTemp(noiseSet), onComplete);
+	});
+
+	return request;
+}
+
+// FNV-1a over the values rather than GetTypeHash(...), which is only 32 bits and may change between engine versions
+static uint64 HashSetting(uint64 hash, const void* data, SIZE_T size)
+{
+	const uint8* bytes = (const uint8*)data;
+
+	for (SIZE_T i = 0; i < size; i++)
+	{
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ull;
+	}
+	return hash;
+}
+
+template <typename T>
+static uint64 HashSetting(uint64 hash, T value)
+{
+	return HashSetting(hash, &value, sizeof(T));
+}
+
+float FFastNoiseParams::CalculateFractalBounding(int32 octaves, float gain)
+{
+	float amp = gain;
+	float ampFractal = 1.0f;
+	for (int32 i = 1; i < octaves; i++)
+	{
+		ampFractal += amp;
+		amp *= gain;
+	}
+	return 1.0f / ampFractal;
+}
+
+uint64 FFastNoiseParams::GetSettingsHash() const
+{
+	TArray<const FFastNoiseParams*> chain;
+
+	for (const FFastNoiseParams* layer = this; layer; layer = layer->NoiseType == EFNNoiseType::Cellular && layer->CellularReturnType == EFNCellularReturnType::NoiseLookup ? layer->Lookup : nullptr)
+	{
+		// The setters refuse cycles, one loaded from an older asset is cut here instead of hashing forever
+		if (!ensureMsgf(!chain.Contains(layer), TEXT("FastNoise lookup chain loops back on itself")))
+			break;
+
+		chain.Add(layer);
+	}
+
+	// Each layer hashes the hash of its lookup last, so the chain is hashed from its end
+	uint64 lookupHash = 0;
+
+	for (int32 i = chain.Num() - 1; i >= 0; i--)
+		lookupHash = chain[i]->GetLayerSettingsHash(lookupHash);
+
+	return lookupHash;
+}
+
+uint64 FFastNoiseParams::GetLayerSettingsHash(uint64 lookupHash) const
+{
+	// Perm, Perm12 and FractalBounding are derived from the hashed settings, Kernels and FractalSetOrder only change speed
+	uint64 hash = 0xcbf29ce484222325ull;
+
+	hash = HashSetting(hash, Seed);
+	hash = HashSetting(hash, Frequency);
+	hash = HashSetting(hash, NoiseType);
+	hash = HashSetting(hash, Interpolation);
+	hash = HashSetting(hash, FractalType);
+
+	hash = HashSetting(hash, FractalOctaves);
+	hash = HashSetting(hash, FractalLacunarity);
+	hash = HashSetting(hash, FractalGain);
+
+	// Band limited copies keep the bounding of the octaves they dropped, the settings alone do not give it
+	if (FractalFade != 1.0f || FractalBounding != CalculateFractalBounding(FractalOctaves, FractalGain))
+	{
+		hash = HashSetting(hash, FractalBounding);
+		hash = HashSetting(hash, FractalFade);
+	}
+
+	hash = HashSetting(hash, CellularDistanceFunction);
+	hash = HashSetting(hash, CellularReturnType);
+	hash = HashSetting(hash, CellularDistanceIndex0);
+	hash = HashSetting(hash, CellularDistanceIndex1);
+	hash = HashSetting(hash, CellularJitter);
+
+	hash = HashSetting(hash, GradientPerturbAmp);
+	hash = HashSetting(hash, PerturbType);
+	hash = HashSetting(hash, HashType);
+
+	// An unused lookup noise does not change the output, so it does not change the hash either, lookupHash is 0 then
+	hash = HashSetting(hash, lookupHash);
+
+	return hash;
+}
+
+FFastNoiseEvaluator::FFastNoiseEvaluator(const UFastNoise& noise)
+{
+	TArray<const UFastNoise*> chain;
+
+	for (const UFastNoise* layer = &noise; layer; layer = layer->GetActiveNoiseLookup())
+	{
+		// A noise that looks itself up would recurse forever when sampled, the last layer returns its cell values instead
+		if (!ensureMsgf(!chain.Contains(layer), TEXT("%s: lookup chain loops back on itself"), *noise.GetName()))
+		{
+			Layers.Last().CellularReturnType = EFNCellularReturnType::CellValue;
+			break;
+		}
+
+		chain.Add(layer);
+		Layers.Add(layer->m_params);
+		Permutations.Add(layer->m_permutation);
+	}
+
+	LinkLayers();
+}
+
+FFastNoiseEvaluator::FFastNoiseEvaluator(const FFastNoiseEvaluator& other)
+	: Layers(other.Layers)
+	, Permutations(other.Permutations)
+{
+	LinkLayers();
+}
+
+FFastNoiseEvaluator& FFastNoiseEvaluator::operator=(const FFastNoiseEvaluator& other)
+{
+	Layers = other.Layers;
+	Permutations = other.Permutations;
+	LinkLayers();
+	return *this;
+}
+
+void FFastNoiseEvaluator::LinkLayers()
+{
+	for (int32 i = 0; i < Layers.Num(); i++)
+		Layers[i].Lookup = i + 1 < Layers.Num() ? &Layers[i + 1] : nullptr;
+}
+
+void FFastNoiseAsyncRequest::Complete(const FFastNoiseAsyncRequestRef& request, TArray<float>&& noiseSet, const FFastNoiseAsyncDelegate& onComplete)
+{
+	request->Promise.SetValue(MoveTemp(noiseSet));
+
+	if (onComplete.IsBound() && !request->IsCancelled())
+	{
+		AsyncTask(ENamedThreads::GameThread, [request, onComplete]()
+		{
+			if (!request->IsCancelled())
+				onComplete.ExecuteIfBound(request);
+		});
+	}
+}
+
+void FFastNoiseParams::GetNoisePointSet2D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const
+{
+	int32 count = noiseSet.Num();
+
+	check(xPoints.Num() >= count && yPoints.Num() >= count);
+
+	if (count <= 0)
+		return;
+
+	float* out = noiseSet.GetData();
+
+	if (NoiseType == EFNNoiseType::Cellular && CellularReturnType == EFNCellularReturnType::NoiseLookup)
+	{
+		FillCellularLookupPointSet2D(out, xPoints.GetData(), yPoints.GetData(), count);
+		return;
+	}
+
+	if (Kernels)
+	{
+		Kernels->FillPointSet2D(*this, out, xPoints.GetData(), yPoints.GetData(), count);
+		return;
+	}
+
+	if (!DispatchNoise2D(NoiseType, [&](auto noiseFunc) { FillNoisePointSet2D(out, xPoints.GetData(), yPoints.GetData(), count, Frequency, noiseFunc); }))
+		FMemory::Memzero(out, count * sizeof(float));
+}
+
+void FFastNoiseParams::GetNoisePointSet3D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const
+{
+	int32 count = noiseSet.Num();
+
+	check(xPoints.Num() >= count && yPoints.Num() >= count && zPoints.Num() >= count);
+
+	if (count <= 0)
+		return;
+
+	float* out = noiseSet.GetData();
+
+	if (NoiseType == EFNNoiseType::Cellular && CellularReturnType == EFNCellularReturnType::NoiseLookup)
+	{
+		FillCellularLookupPointSet3D(out, xPoints.GetData(), yPoints.GetData(), zPoints.GetData(), count);
+		return;
+	}
+
+	if (Kernels)
+	{
+		Kernels->FillPointSet3D(*this, out, xPoints.GetData(), yPoints.GetData(), zPoints.GetData(), count);
+		return;
+	}
+
+	if (!DispatchNoise3D(NoiseType, [&](auto noiseFunc) { FillNoisePointSet3D(out, xPoints.GetData(), yPoints.GetData(), zPoints.GetData(), count, Frequency, noiseFunc); }))
+		FMemory::Memzero(out, count * sizeof(float));
+}
+
+// Cellular NoiseLookup Sets
+// Every sample of a cell gets the same lookup value, so the sets find the closest cells first and sample the lookup noise per cell
+void FFastNoiseParams::FillCellularLookupGrid2D(float* out, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize) const
+{
+	int32 count = xSize * ySize;
+	TArray<int32> cells;
+	cells.SetNumUninitialized(count * 2);
+	int32* xCell = cells.GetData();
+	int32* yCell = xCell + count;
+
+	if (Kernels)
+	{
+		Kernels->FillCellularCellSet2D(*this, xCell, yCell, xCoords, yCoords, xSize, ySize);
+	}
+	else
+	{
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchCellularDistance(CellularDistanceFunction, [&](auto distanceFunc)
+			{
+				int32 index = 0;
+
+				for (int32 y = 0; y < ySize; y++)
+				{
+					for (int32 x = 0; x < xSize; x++, index++)
+						SingleCellularClosest<decltype(hash), decltype(distanceFunc)>(xCoords[x], yCoords[y], xCell[index], yCell[index]);
+				}
+			});
+		});
+	}
+
+	SampleCellularLookup2D(out, xCell, yCell, count);
+}
+
+void FFastNoiseParams::FillCellularLookupGrid3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize) const
+{
+	int32 count = xSize * ySize * zSize;
+	TArray<int32> cells;
+	cells.SetNumUninitialized(count * 3);
+	int32* xCell = cells.GetData();
+	int32* yCell = xCell + count;
+	int32* zCell = yCell + count;
+
+	if (Kernels)
+	{
+		Kernels->FillCellularCellSet3D(*this, xCell, yCell, zCell, xCoords, yCoords, zCoords, xSize, ySize, zSize);
+	}
+	else
+	{
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchCellularDistance(CellularDistanceFunction, [&](auto distanceFunc)
+			{
+				int32 index = 0;
+
+				for (int32 z = 0; z < zSize; z++)
+				{
+					for (int32 y = 0; y < ySize; y++)
+					{
+						for (int32 x = 0; x < xSize; x++, index++)
+							SingleCellularClosest<decltype(hash), decltype(distanceFunc)>(xCoords[x], yCoords[y], zCoords[z], xCell[index], yCell[index], zCell[index]);
+					}
+				}
+			});
+		});
+	}
+
+	SampleCellularLookup3D(out, xCell, yCell, zCell, count);
+}
+
+void FFastNoiseParams::FillCellularLookupPointSet2D(float* out, const float* xPoints, const float* yPoints, int32 count) const
+{
+	TArray<int32> cells;
+	cells.SetNumUninitialized(count * 2);
+	int32* xCell = cells.GetData();
+	int32* yCell = xCell + count;
+
+	if (Kernels)
+	{
+		Kernels->FillCellularCellPointSet2D(*this, xCell, yCell, xPoints, yPoints, count);
+	}
+	else
+	{
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchCellularDistance(CellularDistanceFunction, [&](auto distanceFunc)
+			{
+				for (int32 i = 0; i < count; i++)
+					SingleCellularClosest<decltype(hash), decltype(distanceFunc)>(xPoints[i] * Frequency, yPoints[i] * Frequency, xCell[i], yCell[i]);
+			});
+		});
+	}
+
+	SampleCellularLookup2D(out, xCell, yCell, count);
+}
+
+void FFastNoiseParams::FillCellularLookupPointSet3D(float* out, const float* xPoints, const float* yPoints, const float* zPoints, int32 count) const
+{
+	TArray<int32> cells;
+	cells.SetNumUninitialized(count * 3);
+	int32* xCell = cells.GetData();
+	int32* yCell = xCell + count;
+	int32* zCell = yCell + count;
+
+	if (Kernels)
+	{
+		Kernels->FillCellularCellPointSet3D(*this, xCell, yCell, zCell, xPoints, yPoints, zPoints, count);
+	}
+	else
+	{
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchCellularDistance(CellularDistanceFunction, [&](auto distanceFunc)
+			{
+				for (int32 i = 0; i < count; i++)
+					SingleCellularClosest<decltype(hash), decltype(distanceFunc)>(xPoints[i] * Frequency, yPoints[i] * Frequency, zPoints[i] * Frequency, xCell[i], yCell[i], zCell[i]);
+			});
+		});
+	}
+
+	SampleCellularLookup3D(out, xCell, yCell, zCell, count);
+}
+
+void FFastNoiseParams::SampleCellularLookup2D(float* out, const int32* xCell, const int32* yCell, int32 count) const
+{
+	check(Lookup);
+
+	auto lookupPosition = [this](auto hash, int32 xc, int32 yc, float& x, float& y)
+	{
+		uint8 lutPos = Index2D_256<decltype(hash)>(0, LatticeX(xc), LatticeY(yc));
+		x = xc + CELL_2D_X[lutPos] * CellularJitter;
+		y = yc + CELL_2D_Y[lutPos] * CellularJitter;
+	};
+
+	int32 xMin = xCell[0], xMax = xCell[0];
+	int32 yMin = yCell[0], yMax = yCell[0];
+
+	for (int32 i = 1; i < count; i++)
+	{
+		xMin = FMath::Min(xMin, xCell[i]);
+		xMax = FMath::Max(xMax, xCell[i]);
+		yMin = FMath::Min(yMin, yCell[i]);
+		yMax = FMath::Max(yMax, yCell[i]);
+	}
+
+	int64 xCells = (int64)xMax - xMin + 1;
+	int64 cellCount = xCells * ((int64)yMax - yMin + 1);
+
+	if (cellCount <= count)
+	{
+		// Precomputed value of every cell touching the set, each sample then reads the value of its cell
+		TArray<float> table;
+		table.SetNumUninitialized(cellCount * 3);
+		float* xLookup = table.GetData();
+		float* yLookup = xLookup + cellCount;
+		float* values = yLookup + cellCount;
+
+		DispatchHash(HashType, [&](auto hash)
+		{
+			int32 index = 0;
+			for (int32 yc = yMin; yc <= yMax; yc++)
+			{
+				for (int32 xc = xMin; xc <= xMax; xc++, index++)
+					lookupPosition(hash, xc, yc, xLookup[index], yLookup[index]);
+			}
+		});
+
+		Lookup->GetNoisePointSet2D(TArrayView<float>(values, cellCount), TArrayView<const float>(xLookup, cellCount), TArrayView<const float>(yLookup, cellCount));
+
+		for (int32 i = 0; i < count; i++)
+			out[i] = values[(xCell[i] - xMin) + xCells * (yCell[i] - yMin)];
+		return;
+	}
+
+	// The box is mostly cells no sample is in, only the cells of the samples are looked up
+	// Samples of a cell usually follow each other in the set, so each run of them is looked up once
+	TArray<float> lookup;
+	lookup.SetNumUninitialized(count * 2);
+	float* xLookup = lookup.GetData();
+	float* yLookup = xLookup + count;
+	int32 runCount = 0;
+
+	DispatchHash(HashType, [&](auto hash)
+	{
+		for (int32 i = 0; i < count; i++)
+		{
+			if (i == 0 || xCell[i] != xCell[i - 1] || yCell[i] != yCell[i - 1])
+			{
+				lookupPosition(hash, xCell[i], yCell[i], xLookup[runCount], yLookup[runCount]);
+				runCount++;
+			}
+		}
+	});
+
+	Lookup->GetNoisePointSet2D(TArrayView<float>(out, runCount), TArrayView<const float>(xLookup, runCount), TArrayView<const float>(yLookup, runCount));
+
+	// Spreads the run values over their samples from the back, run <= i so no value is overwritten before it is read
+	for (int32 i = count - 1, run = runCount - 1; i > 0; i--)
+	{
+		out[i] = out[run];
+		if (xCell[i] != xCell[i - 1] || yCell[i] != yCell[i - 1])
+			run--;
+	}
+}
+
+void FFastNoiseParams::SampleCellularLookup3D(float* out, const int32* xCell, const int32* yCell, const int32* zCell, int32 count) const
+{
+	check(Lookup);
+
+	auto lookupPosition = [this](auto hash, int32 xc, int32 yc, int32 zc, float& x, float& y, float& z)
+	{
+		uint8 lutPos = Index3D_256<decltype(hash)>(0, LatticeX(xc), LatticeY(yc), LatticeZ(zc));
+		x = xc + CELL_3D_X[lutPos] * CellularJitter;
+		y = yc + CELL_3D_Y[lutPos] * CellularJitter;
+		z = zc + CELL_3D_Z[lutPos] * CellularJitter;
+	};
+
+	int32 xMin = xCell[0], xMax = xCell[0];
+	int32 yMin = yCell[0], yMax = yCell[0];
+	int32 zMin = zCell[0], zMax = zCell[0];
+
+	for (int32 i = 1; i < count; i++)
+	{
+		xMin = FMath::Min(xMin, xCell[i]);
+		xMax = FMath::Max(xMax, xCell[i]);
+		yMin = FMath::Min(yMin, yCell[i]);
+		yMax = FMath::Max(yMax, yCell[i]);
+		zMin = FMath::Min(zMin, zCell[i]);
+		zMax = FMath::Max(zMax, zCell[i]);
+	}
+
+	int64 xCells = (int64)xMax - xMin + 1;
+	int64 yCells = (int64)yMax - yMin + 1;
+	int64 cellCount = xCells * yCells * ((int64)zMax - zMin + 1);
+
+	if (cellCount <= count)
+	{
+		TArray<float> table;
+		table.SetNumUninitialized(cellCount * 4);
+		float* xLookup = table.GetData();
+		float* yLookup = xLookup + cellCount;
+		float* zLookup = yLookup + cellCount;
+		float* values = zLookup + cellCount;
+
+		DispatchHash(HashType, [&](auto hash)
+		{
+			int32 index = 0;
+			for (int32 zc = zMin; zc <= zMax; zc++)
+			{
+				for (int32 yc = yMin; yc <= yMax; yc++)
+				{
+					for (int32 xc = xMin; xc <= xMax; xc++, index++)
+						lookupPosition(hash, xc, yc, zc, xLookup[index], yLookup[index], zLookup[index]);
+				}
+			}
+		});
+
+		Lookup->GetNoisePointSet3D(TArrayView<float>(values, cellCount), TArrayView<const float>(xLookup, cellCount), TArrayView<const float>(yLookup, cellCount), TArrayView<const float>(zLookup, cellCount));
+
+		for (int32 i = 0; i < count; i++)
+			out[i] = values[(xCell[i] - xMin) + xCells * ((yCell[i] - yMin) + yCells * (zCell[i] - zMin))];
+		return;
+	}
+
+	TArray<float> lookup;
+	lookup.SetNumUninitialized(count * 3);
+	float* xLookup = lookup.GetData();
+	float* yLookup = xLookup + count;
+	float* zLookup = yLookup + count;
+	int32 runCount = 0;
+
+	DispatchHash(HashType, [&](auto hash)
+	{
+		for (int32 i = 0; i < count; i++)
+		{
+			if (i == 0 || xCell[i] != xCell[i - 1] || yCell[i] != yCell[i - 1] || zCell[i] != zCell[i - 1])
+			{
+				lookupPosition(hash, xCell[i], yCell[i], zCell[i], xLookup[runCount], yLookup[runCount], zLookup[runCount]);
+				runCount++;
+			}
+		}
+	});
+
+	Lookup->GetNoisePointSet3D(TArrayView<float>(out, runCount), TArrayView<const float>(xLookup, runCount), TArrayView<const float>(yLookup, runCount), TArrayView<const float>(zLookup, runCount));
+
+	for (int32 i = count - 1, run = runCount - 1; i > 0; i--)
+	{
+		out[i] = out[run];
+		if (xCell[i] != xCell[i - 1] || yCell[i] != yCell[i - 1] || zCell[i] != zCell[i - 1])
+			run--;
+	}
+}
+
+// Cellular Sample Sets
+// True if every output sampleSet does not skip holds at least count samples
+static bool CellularSampleSetFits(const FFastNoiseCellularSampleSet& sampleSet, int32 count)
+{
+	auto fits = [count](int32 num) { return num == 0 || num >= count; };
+
+	return fits(sampleSet.Distance.Num()) && fits(sampleSet.Distance0.Num()) && fits(sampleSet.Distance1.Num()) && fits(sampleSet.CellValue.Num())
+		&& fits(sampleSet.CellX.Num()) && fits(sampleSet.CellY.Num()) && fits(sampleSet.CellZ.Num())
+		&& fits(sampleSet.CellPositionX.Num()) && fits(sampleSet.CellPositionY.Num()) && fits(sampleSet.CellPositionZ.Num());
+}
+
+// Writes sample to element i of the outputs sampleSet does not skip
+static void StoreCellularSample(const FFastNoiseCellularSampleSet& sampleSet, int32 i, const FFastNoiseCellularSample& sample, bool b3D)
+{
+	if (sampleSet.Distance.Num())
+		sampleSet.Distance[i] = sample.Distance;
+	if (sampleSet.Distance0.Num())
+		sampleSet.Distance0[i] = sample.Distance0;
+	if (sampleSet.Distance1.Num())
+		sampleSet.Distance1[i] = sample.Distance1;
+	if (sampleSet.CellValue.Num())
+		sampleSet.CellValue[i] = sample.CellValue;
+
+	if (sampleSet.CellX.Num())
+		sampleSet.CellX[i] = sample.Cell.X;
+	if (sampleSet.CellY.Num())
+		sampleSet.CellY[i] = sample.Cell.Y;
+	if (sampleSet.CellPositionX.Num())
+		sampleSet.CellPositionX[i] = sample.CellPosition.X;
+	if (sampleSet.CellPositionY.Num())
+		sampleSet.CellPositionY[i] = sample.CellPosition.Y;
+
+	if (!b3D)
+		return;
+
+	if (sampleSet.CellZ.Num())
+		sampleSet.CellZ[i] = sample.Cell.Z;
+	if (sampleSet.CellPositionZ.Num())
+		sampleSet.CellPositionZ[i] = sample.CellPosition.Z;
+}
+
+void FFastNoiseParams::GetCellularSamplePointSet2D(const FFastNoiseCellularSampleSet& sampleSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const
+{
+	int32 count = xPoints.Num();
+
+	check(yPoints.Num() >= count && CellularSampleSetFits(sampleSet, count));
+
+	if (count <= 0)
+		return;
+
+	if (PerturbKernels)
+	{
+		PerturbKernels->FillCellularSamplePointSet2D(*this, sampleSet, xPoints.GetData(), yPoints.GetData(), count);
+		return;
+	}
+
+	DispatchCellularSample([&](auto sampleFunc)
+	{
+		FFastNoiseCellularSample sample;
+
+		for (int32 i = 0; i < count; i++)
+		{
+			float x = xPoints[i] * Frequency;
+			float y = yPoints[i] * Frequency;
+
+			sampleFunc(x, y, sample);
+			StoreCellularSample(sampleSet, i, sample, false);
+		}
+	});
+}
+
+void FFastNoiseParams::GetCellularSamplePointSet3D(const FFastNoiseCellularSampleSet& sampleSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const
+{
+	int32 count = xPoints.Num();
+
+	check(yPoints.Num() >= count && zPoints.Num() >= count && CellularSampleSetFits(sampleSet, count));
+
+	if (count <= 0)
+		return;
+
+	if (PerturbKernels)
+	{
+		PerturbKernels->FillCellularSamplePointSet3D(*this, sampleSet, xPoints.GetData(), yPoints.GetData(), zPoints.GetData(), count);
+		return;
+	}
+
+	DispatchCellularSample([&](auto sampleFunc)
+	{
+		FFastNoiseCellularSample sample;
+
+		for (int32 i = 0; i < count; i++)
+		{
+			float x = xPoints[i] * Frequency;
+			float y = yPoints[i] * Frequency;
+			float z = zPoints[i] * Frequency;
+
+			sampleFunc(x, y, z, sample);
+			StoreCellularSample(sampleSet, i, sample, true);
+		}
+	});
+}
+
+// Gradient Perturb Sets
+// Points warped at a time by the fused perturbed point sets, small enough for the chunk to stay in L1
+static const int32 PerturbChunkSize = 256;
+
+void FFastNoiseParams::PerturbPoints2D(float* xOut, float* yOut, const float* xPoints, const float* yPoints, int32 count, bool fractal) const
+{
+	if (PerturbKernels)
+	{
+		PerturbKernels->GradientPerturbPointSet2D(*this, xOut, yOut, xPoints, yPoints, count, fractal);
+		return;
+	}
+
+	DispatchPerturb([&](auto perturb)
+	{
+		for (int32 i = 0; i < count; i++)
+		{
+			float x = xPoints[i];
+			float y = yPoints[i];
+
+			if (fractal)
+				SinglePerturbFractal(perturb, x, y);
+			else
+				perturb(0, GradientPerturbAmp, Frequency, x, y);
+
+			xOut[i] = x;
+			yOut[i] = y;
+		}
+	});
+}
+
+void FFastNoiseParams::PerturbPoints3D(float* xOut, float* yOut, float* zOut, const float* xPoints, const float* yPoints, const float* zPoints, int32 count, bool fractal) const
+{
+	if (PerturbKernels)
+	{
+		PerturbKernels->GradientPerturbPointSet3D(*this, xOut, yOut, zOut, xPoints, yPoints, zPoints, count, fractal);
+		return;
+	}
+
+	DispatchPerturb([&](auto perturb)
+	{
+		for (int32 i = 0; i < count; i++)
+		{
+			float x = xPoints[i];
+			float y = yPoints[i];
+			float z = zPoints[i];
+
+			if (fractal)
+				SinglePerturbFractal(perturb, x, y, z);
+			else
+				perturb(0, GradientPerturbAmp, Frequency, x, y, z);
+
+			xOut[i] = x;
+			yOut[i] = y;
+			zOut[i] = z;
+		}
+	});
+}
+
+void FFastNoiseParams::GradientPerturbSet2D(TArrayView<float> xPoints, TArrayView<float> yPoints) const
+{
+	check(yPoints.Num() >= xPoints.Num());
+	PerturbPoints2D(xPoints.GetData(), yPoints.GetData(), xPoints.GetData(), yPoints.GetData(), xPoints.Num(), false);
+}
+
+void FFastNoiseParams::GradientPerturbFractalSet2D(TArrayView<float> xPoints, TArrayView<float> yPoints) const
+{
+	check(yPoints.Num() >= xPoints.Num());
+	PerturbPoints2D(xPoints.GetData(), yPoints.GetData(), xPoints.GetData(), yPoints.GetData(), xPoints.Num(), true);
+}
+
+void FFastNoiseParams::GradientPerturbSet3D(TArrayView<float> xPoints, TArrayView<float> yPoints, TArrayView<float> zPoints) const
+{
+	check(yPoints.Num() >= xPoints.Num() && zPoints.Num() >= xPoints.Num());
+	PerturbPoints3D(xPoints.GetData(), yPoints.GetData(), zPoints.GetData(), xPoints.GetData(), yPoints.GetData(), zPoints.GetData(), xPoints.Num(), false);
+}
+
+void FFastNoiseParams::GradientPerturbFractalSet3D(TArrayView<float> xPoints, TArrayView<float> yPoints, TArrayView<float> zPoints) const
+{
+	check(yPoints.Num() >= xPoints.Num() && zPoints.Num() >= xPoints.Num());
+	PerturbPoints3D(xPoints.GetData(), yPoints.GetData(), zPoints.GetData(), xPoints.GetData(), yPoints.GetData(), zPoints.GetData(), xPoints.Num(), true);
+}
+
+void FFastNoiseParams::GetPerturbedNoisePointSet2D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, const FFastNoiseParams& perturb, bool fractalPerturb) const
+{
+	int32 count = noiseSet.Num();
+
+	check(xPoints.Num() >= count && yPoints.Num() >= count);
+
+	float xChunk[PerturbChunkSize];
+	float yChunk[PerturbChunkSize];
+
+	for (int32 i = 0; i < count; i += PerturbChunkSize)
+	{
+		int32 chunkSize = FMath::Min(count - i, PerturbChunkSize);
+
+		perturb.PerturbPoints2D(xChunk, yChunk, xPoints.GetData() + i, yPoints.GetData() + i, chunkSize, fractalPerturb);
+		GetNoisePointSet2D(noiseSet.Slice(i, chunkSize), TArrayView<const float>(xChunk, chunkSize), TArrayView<const float>(yChunk, chunkSize));
+	}
+}
+
+void FFastNoiseParams::GetPerturbedNoisePointSet3D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints, const FFastNoiseParams& perturb, bool fractalPerturb) const
+{
+	int32 count = noiseSet.Num();
+
+	check(xPoints.Num() >= count && yPoints.Num() >= count && zPoints.Num() >= count);
+
+	float xChunk[PerturbChunkSize];
+	float yChunk[PerturbChunkSize];
+	float zChunk[PerturbChunkSize];
+
+	for (int32 i = 0; i < count; i += PerturbChunkSize)
+	{
+		int32 chunkSize = FMath::Min(count - i, PerturbChunkSize);
+
+		perturb.PerturbPoints3D(xChunk, yChunk, zChunk, xPoints.GetData() + i, yPoints.GetData() + i, zPoints.GetData() + i, chunkSize, fractalPerturb);
+		GetNoisePointSet3D(noiseSet.Slice(i, chunkSize), TArrayView<const float>(xChunk, chunkSize), TArrayView<const float>(yChunk, chunkSize), TArrayView<const float>(zChunk, chunkSize));
+	}
+}
+
+// White Noise
+float FFastNoiseParams::GetWhiteNoise4D(float x, float y, float z, float w) const
+{
+	return ValCoord4D(Seed,
+		*reinterpret_cast<int32*>(&x) ^ (*reinterpret_cast<int32*>(&x) >> 16),
+		*reinterpret_cast<int32*>(&y) ^ (*reinterpret_cast<int32*>(&y) >> 16),
+		*reinterpret_cast<int32*>(&z) ^ (*reinterpret_cast<int32*>(&z) >> 16),
+		*reinterpret_cast<int32*>(&w) ^ (*reinterpret_cast<int32*>(&w) >> 16));
+}
+
+float FFastNoiseParams::GetWhiteNoise3D(float x, float y, float z) const
+{
+	return ValCoord3D(Seed,
+		*reinterpret_cast<int32*>(&x) ^ (*reinterpret_cast<int32*>(&x) >> 16),
+		*reinterpret_cast<int32*>(&y) ^ (*reinterpret_cast<int32*>(&y) >> 16),
+		*reinterpret_cast<int32*>(&z) ^ (*reinterpret_cast<int32*>(&z) >> 16));
+}
+
+float FFastNoiseParams::GetWhiteNoise2D(float x, float y) const
+{
+	return ValCoord2D(Seed,
+		*reinterpret_cast<int32*>(&x) ^ (*reinterpret_cast<int32*>(&x) >> 16),
+		*reinterpret_cast<int32*>(&y) ^ (*reinterpret_cast<int32*>(&y) >> 16));
+}
+
+float FFastNoiseParams::GetWhiteNoiseInt4D(int32 x, int32 y, int32 z, int32 w) const
+{
+	return ValCoord4D(Seed, x, y, z, w);
+}
+
+float FFastNoiseParams::GetWhiteNoiseInt3D(int32 x, int32 y, int32 z) const
+{
+	return ValCoord3D(Seed, x, y, z);
+}
+
+float FFastNoiseParams::GetWhiteNoiseInt2D(int32 x, int32 y) const
+{
+	return ValCoord2D(Seed, x, y);
+}
+
+// Band Limiting
+FFastNoiseParams FFastNoiseParams::GetBandLimited(float footprint) const
+{
+	FFastNoiseParams limited = *this;
+
+	// Octaves only get finer with a lacunarity above 1
+	if (!(footprint > 0) || FractalLacunarity <= 1.0f)
+		return limited;
+
+	// Lattice cells between samples at the octave, half a cell is the finest lattice the samples resolve
+	const float limit = 0.5f;
+	float cells = footprint * FMath::Abs(Frequency);
+	int32 octaves = 0;
+
+	while (octaves < FractalOctaves && cells < limit)
+	{
+		octaves++;
+		cells *= FractalLacunarity;
+	}
+
+	if (octaves <= 1)
+	{
+		limited.FractalOctaves = FMath::Min(FractalOctaves, 1);
+		limited.FractalFade = 1.0f;
+		return limited;
+	}
+
+	// The last octave kept fades out over the lacunarity step below the limit, so the output does not jump as the footprint grows
+	float lastCells = cells / FractalLacunarity;
+	float fade = FMath::Clamp(FMath::Loge(limit / lastCells) / FMath::Loge(FractalLacunarity), 0.0f, 1.0f);
+
+	limited.FractalFade = octaves == FractalOctaves ? FractalFade * fade : fade;
+	limited.FractalOctaves = octaves;
+	return limited;
+}
+
+float FFastNoiseParams::GetNoiseBandLimited2D(float x, float y, float footprint) const
+{
+	return GetBandLimited(footprint).GetNoise2D(x, y);
+}
+
+float FFastNoiseParams::GetNoiseBandLimited3D(float x, float y, float z, float footprint) const
+{
+	return GetBandLimited(footprint).GetNoise3D(x, y, z);
+}
+
+void FFastNoiseParams::GetNoiseSetBandLimited2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize) const
+{
+	GetBandLimited(FMath::Abs(stepSize)).GetNoiseSet2D(noiseSet, xStart, yStart, xSize, ySize, stepSize);
+}
+
+void FFastNoiseParams::GetNoiseSetBandLimited3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize) const
+{
+	GetBandLimited(FMath::Abs(stepSize)).GetNoiseSet3D(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, stepSize);
+}
+
+// Fractal
+// Octave combinators shared by every fractal noise type
+template <EFNFractalType FractalType>
+static FORCEINLINE float FractalOctave(float noise)
+{
+	switch (FractalType)
+	{
+	case EFNFractalType::Billow:
+		return FastAbs(noise) * 2 - 1;
+	case EFNFractalType::RigidMulti:
+		return 1 - FastAbs(noise);
+	default:
+		return noise;
+	}
+}
+
+template <EFNFractalType FractalType, typename FNoiseFunc>
+float FFastNoiseParams::SingleFractal(float x, float y, float z, FNoiseFunc noiseFunc) const
+{
+	float sum = FractalOctave<FractalType>(noiseFunc(OctaveOffset(0), x, y, z));
+	float amp = 1;
+	int32 i = 0;
+
+	while (++i < FractalOctaves)
+	{
+		x *= FractalLacunarity;
+		y *= FractalLacunarity;
+		z *= FractalLacunarity;
+
+		amp *= FractalGain;
+		if (i == FractalOctaves - 1)
+			amp *= FractalFade;
+		if (FractalType == EFNFractalType::RigidMulti)
+			sum -= FractalOctave<FractalType>(noiseFunc(OctaveOffset(i), x, y, z)) * amp;
+		else
+			sum += FractalOctave<FractalType>(noiseFunc(OctaveOffset(i), x, y, z)) * amp;
+	}
+
+	// RigidMulti is left unscaled
+	return FractalType == EFNFractalType::RigidMulti ? sum : sum * FractalBounding;
+}
+
+template <EFNFractalType FractalType, typename FNoiseFunc>
+float FFastNoiseParams::SingleFractal(float x, float y, FNoiseFunc noiseFunc) const
+{
+	float sum = FractalOctave<FractalType>(noiseFunc(OctaveOffset(0), x, y));
+	float amp = 1;
+	int32 i = 0;
+
+	while (++i < FractalOctaves)
+	{
+		x *= FractalLacunarity;
+		y *= FractalLacunarity;
+
+		amp *= FractalGain;
+		if (i == FractalOctaves - 1)
+			amp *= FractalFade;
+		if (FractalType == EFNFractalType::RigidMulti)
+			sum -= FractalOctave<FractalType>(noiseFunc(OctaveOffset(i), x, y)) * amp;
+		else
+			sum += FractalOctave<FractalType>(noiseFunc(OctaveOffset(i), x, y)) * amp;
+	}
+
+	return FractalType == EFNFractalType::RigidMulti ? sum : sum * FractalBounding;
+}
+
+// Derivatives
+// Slope of FractalOctave<FractalType>(noise) with respect to noise
+template <EFNFractalType FractalType>
+static FORCEINLINE float FractalOctaveSlope(float noise)
+{
+	switch (FractalType)
+	{
+	case EFNFractalType::Billow:
+		return noise < 0 ? -2.0f : 2.0f;
+	case EFNFractalType::RigidMulti:
+		return noise < 0 ? 1.0f : -1.0f;
+	default:
+		return 1.0f;
+	}
+}
+
+// The sum is the same as SingleFractal(...), octave i is sampled at lacunarity^i times the position so its gradient is scaled by that too
+template <EFNFractalType FractalType, typename FNoiseFunc>
+float FFastNoiseParams::SingleFractalDerivative(float x, float y, float z, FVector& gradient, FNoiseFunc noiseFunc) const
+{
+	FVector octaveGradient;
+	float noise = noiseFunc(OctaveOffset(0), x, y, z, octaveGradient);
+	float sum = FractalOctave<FractalType>(noise);
+	float amp = 1;
+	float frequency = 1;
+	int32 i = 0;
+
+	gradient = octaveGradient * FractalOctaveSlope<FractalType>(noise);
+
+	while (++i < FractalOctaves)
+	{
+		x *= FractalLacunarity;
+		y *= FractalLacunarity;
+		z *= FractalLacunarity;
+		frequency *= FractalLacunarity;
+
+		amp *= FractalGain;
+		if (i == FractalOctaves - 1)
+			amp *= FractalFade;
+		noise = noiseFunc(OctaveOffset(i), x, y, z, octaveGradient);
+		if (FractalType == EFNFractalType::RigidMulti)
+		{
+			sum -= FractalOctave<FractalType>(noise) * amp;
+			gradient -= octaveGradient * (FractalOctaveSlope<FractalType>(noise) * amp * frequency);
+		}
+		else
+		{
+			sum += FractalOctave<FractalType>(noise) * amp;
+			gradient += octaveGradient * (FractalOctaveSlope<FractalType>(noise) * amp * frequency);
+		}
+	}
+
+	if (FractalType == EFNFractalType::RigidMulti)
+		return sum;
+
+	gradient *= FractalBounding;
+	return sum * FractalBounding;
+}
+
+template <EFNFractalType FractalType, typename FNoiseFunc>
+float FFastNoiseParams::SingleFractalDerivative(float x, float y, FVector2D& gradient, FNoiseFunc noiseFunc) const
+{
+	FVector2D octaveGradient;
+	float noise = noiseFunc(OctaveOffset(0), x, y, octaveGradient);
+	float sum = FractalOctave<FractalType>(noise);
+	float amp = 1;
+	float frequency = 1;
+	int32 i = 0;
+
+	gradient = octaveGradient * FractalOctaveSlope<FractalType>(noise);
+
+	while (++i < FractalOctaves)
+	{
+		x *= FractalLacunarity;
+		y *= FractalLacunarity;
+		frequency *= FractalLacunarity;
+
+		amp *= FractalGain;
+		if (i == FractalOctaves - 1)
+			amp *= FractalFade;
+		noise = noiseFunc(OctaveOffset(i), x, y, octaveGradient);
+		if (FractalType == EFNFractalType::RigidMulti)
+		{
+			sum -= FractalOctave<FractalType>(noise) * amp;
+			gradient -= octaveGradient * (FractalOctaveSlope<FractalType>(noise) * amp * frequency);
+		}
+		else
+		{
+			sum += FractalOctave<FractalType>(noise) * amp;
+			gradient += octaveGradient * (FractalOctaveSlope<FractalType>(noise) * amp * frequency);
 		}
+	}
+
+	if (FractalType == EFNFractalType::RigidMulti)
+		return sum;
+
+	gradient *= FractalBounding;
+	return sum * FractalBounding;
+}
+
+template <typename FNoiseSetFunc, typename FNoiseFunc>
+void FFastNoiseParams::DispatchFractalDerivative2D(FNoiseSetFunc& fill, bool fractal, FNoiseFunc noiseFunc) const
+{
+	if (!fractal)
+	{
+		fill([&](float x, float y, FVector2D& gradient) { return noiseFunc(BaseOffset, x, y, gradient); });
+		return;
+	}
+
+	switch (FractalType)
+	{
+	case EFNFractalType::FBM:
+		fill([&](float x, float y, FVector2D& gradient) { return SingleFractalDerivative<EFNFractalType::FBM>(x, y, gradient, noiseFunc); });
+		break;
+	case EFNFractalType::Billow:
+		fill([&](float x, float y, FVector2D& gradient) { return SingleFractalDerivative<EFNFractalType::Billow>(x, y, gradient, noiseFunc); });
+		break;
+	case EFNFractalType::RigidMulti:
+		fill([&](float x, float y, FVector2D& gradient) { return SingleFractalDerivative<EFNFractalType::RigidMulti>(x, y, gradient, noiseFunc); });
+		break;
+	}
+}
+
+template <typename FNoiseSetFunc>
+bool FFastNoiseParams::DispatchNoiseDerivative2D(EFNNoiseType noiseType, FNoiseSetFunc fill) const
+{
+	switch (noiseType)
+	{
+	case EFNNoiseType::Value:
+	case EFNNoiseType::ValueFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchInterp(Interpolation, [&](auto interp)
+			{
+				DispatchFractalDerivative2D(fill, noiseType == EFNNoiseType::ValueFractal,
+					[this](uint8 offset, float x, float y, FVector2D& gradient) { return SingleValueDerivative<decltype(hash), decltype(interp)>(offset, x, y, gradient); });
+			});
+		});
+		return true;
 	case EFNNoiseType::Perlin:
-		return SinglePerlin(0, x, y, z);
 	case EFNNoiseType::PerlinFractal:
-		switch (FractalType)
-		{
-		case EFNFractalType::FBM:
-			return SinglePerlinFractalFBM(x, y, z);
-		case EFNFractalType::Billow:
-			return SinglePerlinFractalBillow(x, y, z);
-		case EFNFractalType::RigidMulti:
-			return SinglePerlinFractalRigidMulti(x, y, z);
-		default:
-			return 0;
-		}
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchInterp(Interpolation, [&](auto interp)
+			{
+				DispatchFractalDerivative2D(fill, noiseType == EFNNoiseType::PerlinFractal,
+					[this](uint8 offset, float x, float y, FVector2D& gradient) { return SinglePerlinDerivative<decltype(hash), decltype(interp)>(offset, x, y, gradient); });
+			});
+		});
+		return true;
 	case EFNNoiseType::Simplex:
-		return SingleSimplex(0, x, y, z);
 	case EFNNoiseType::SimplexFractal:
-		switch (FractalType)
-		{
-		case EFNFractalType::FBM:
-			return SingleSimplexFractalFBM(x, y, z);
-		case EFNFractalType::Billow:
-			return SingleSimplexFractalBillow(x, y, z);
-		case EFNFractalType::RigidMulti:
-			return SingleSimplexFractalRigidMulti(x, y, z);
-		default:
-			return 0;
-		}
-	case EFNNoiseType::Cellular:
-		switch (CellularReturnType)
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchFractalDerivative2D(fill, noiseType == EFNNoiseType::SimplexFractal,
+				[this](uint8 offset, float x, float y, FVector2D& gradient) { return SingleSimplexDerivative<decltype(hash)>(offset, x, y, gradient); });
+		});
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <typename FNoiseSetFunc, typename FNoiseFunc>
+void FFastNoiseParams::DispatchFractalDerivative3D(FNoiseSetFunc& fill, bool fractal, FNoiseFunc noiseFunc) const
+{
+	if (!fractal)
+	{
+		fill([&](float x, float y, float z, FVector& gradient) { return noiseFunc(BaseOffset, x, y, z, gradient); });
+		return;
+	}
+
+	switch (FractalType)
+	{
+	case EFNFractalType::FBM:
+		fill([&](float x, float y, float z, FVector& gradient) { return SingleFractalDerivative<EFNFractalType::FBM>(x, y, z, gradient, noiseFunc); });
+		break;
+	case EFNFractalType::Billow:
+		fill([&](float x, float y, float z, FVector& gradient) { return SingleFractalDerivative<EFNFractalType::Billow>(x, y, z, gradient, noiseFunc); });
+		break;
+	case EFNFractalType::RigidMulti:
+		fill([&](float x, float y, float z, FVector& gradient) { return SingleFractalDerivative<EFNFractalType::RigidMulti>(x, y, z, gradient, noiseFunc); });
+		break;
+	}
+}
+
+template <typename FNoiseSetFunc>
+bool FFastNoiseParams::DispatchNoiseDerivative3D(EFNNoiseType noiseType, FNoiseSetFunc fill) const
+{
+	switch (noiseType)
+	{
+	case EFNNoiseType::Value:
+	case EFNNoiseType::ValueFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchInterp(Interpolation, [&](auto interp)
+			{
+				DispatchFractalDerivative3D(fill, noiseType == EFNNoiseType::ValueFractal,
+					[this](uint8 offset, float x, float y, float z, FVector& gradient) { return SingleValueDerivative<decltype(hash), decltype(interp)>(offset, x, y, z, gradient); });
+			});
+		});
+		return true;
+	case EFNNoiseType::Perlin:
+	case EFNNoiseType::PerlinFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchInterp(Interpolation, [&](auto interp)
+			{
+				DispatchFractalDerivative3D(fill, noiseType == EFNNoiseType::PerlinFractal,
+					[this](uint8 offset, float x, float y, float z, FVector& gradient) { return SinglePerlinDerivative<decltype(hash), decltype(interp)>(offset, x, y, z, gradient); });
+			});
+		});
+		return true;
+	case EFNNoiseType::Simplex:
+	case EFNNoiseType::SimplexFractal:
+		DispatchHash(HashType, [&](auto hash)
+		{
+			DispatchFractalDerivative3D(fill, noiseType == EFNNoiseType::SimplexFractal,
+				[this](uint8 offset, float x, float y, float z, FVector& gradient) { return SingleSimplexDerivative<decltype(hash)>(offset, x, y, z, gradient); });
+		});
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Step of the central differences taken for noise types without an analytic derivative, in frequency scaled units
+static const float DERIVATIVE_STEP = float(1) / 1024;
+
+float FFastNoiseParams::SampleNoiseDerivative2D(EFNNoiseType noiseType, float x, float y, FVector2D& gradient) const
+{
+	float noise = 0;
+	if (DispatchNoiseDerivative2D(noiseType, [&](auto noiseFunc) { noise = noiseFunc(x, y, gradient); }))
+		return noise;
+
+	gradient.X = (SampleNoise2D(noiseType, x + DERIVATIVE_STEP, y) - SampleNoise2D(noiseType, x - DERIVATIVE_STEP, y)) / (2 * DERIVATIVE_STEP);
+	gradient.Y = (SampleNoise2D(noiseType, x, y + DERIVATIVE_STEP) - SampleNoise2D(noiseType, x, y - DERIVATIVE_STEP)) / (2 * DERIVATIVE_STEP);
+
+	return SampleNoise2D(noiseType, x, y);
+}
+
+float FFastNoiseParams::SampleNoiseDerivative3D(EFNNoiseType noiseType, float x, float y, float z, FVector& gradient) const
+{
+	float noise = 0;
+	if (DispatchNoiseDerivative3D(noiseType, [&](auto noiseFunc) { noise = noiseFunc(x, y, z, gradient); }))
+		return noise;
+
+	gradient.X = (SampleNoise3D(noiseType, x + DERIVATIVE_STEP, y, z) - SampleNoise3D(noiseType, x - DERIVATIVE_STEP, y, z)) / (2 * DERIVATIVE_STEP);
+	gradient.Y = (SampleNoise3D(noiseType, x, y + DERIVATIVE_STEP, z) - SampleNoise3D(noiseType, x, y - DERIVATIVE_STEP, z)) / (2 * DERIVATIVE_STEP);
+	gradient.Z = (SampleNoise3D(noiseType, x, y, z + DERIVATIVE_STEP) - SampleNoise3D(noiseType, x, y, z - DERIVATIVE_STEP)) / (2 * DERIVATIVE_STEP);
+
+	return SampleNoise3D(noiseType, x, y, z);
+}
+
+float FFastNoiseParams::GetNoiseDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	float noise = SampleNoiseDerivative2D(NoiseType, x * Frequency, y * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
+}
+
+float FFastNoiseParams::GetNoiseDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	float noise = SampleNoiseDerivative3D(NoiseType, x * Frequency, y * Frequency, z * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
+}
+
+template <typename FNoiseFunc>
+static void FillNoiseDerivativeSet2D(float* noiseSet, FVector2D* gradientSet, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize, float frequency, FNoiseFunc noiseFunc)
+{
+	int32 index = 0;
+
+	for (int32 y = 0; y < ySize; y++)
+	{
+		float yf = yCoords[y];
+
+		for (int32 x = 0; x < xSize; x++, index++)
 		{
-		case EFNCellularReturnType::CellValue:
-		case EFNCellularReturnType::NoiseLookup:
-		case EFNCellularReturnType::Distance:
-			return SingleCellular(x, y, z);
-		default:
-			return SingleCellular2Edge(x, y, z);
-		}
-	case EFNNoiseType::WhiteNoise:
-		return GetWhiteNoise3D(x, y, z);
-	case EFNNoiseType::Cubic:
-		return SingleCubic(0, x, y, z);
-	case EFNNoiseType::CubicFractal:
-		switch (FractalType)
-		{
-		case EFNFractalType::FBM:
-			return SingleCubicFractalFBM(x, y, z);
-		case EFNFractalType::Billow:
-			return SingleCubicFractalBillow(x, y, z);
-		case EFNFractalType::RigidMulti:
-			return SingleCubicFractalRigidMulti(x, y, z);
+			noiseSet[index] = noiseFunc(xCoords[x], yf, gradientSet[index]);
+			gradientSet[index] *= frequency;
 		}
-	default:
-		return 0;
 	}
 }
 
-float UFastNoise::GetNoise2D(float x, float y) const
+template <typename FNoiseFunc>
+static void FillNoiseDerivativeSet3D(float* noiseSet, FVector* gradientSet, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize, float frequency, FNoiseFunc noiseFunc)
 {
-	x *= Frequency;
-	y *= Frequency;
+	int32 index = 0;
 
-	switch (NoiseType)
+	for (int32 z = 0; z < zSize; z++)
 	{
-	case EFNNoiseType::Value:
-		return SingleValue(0, x, y);
-	case EFNNoiseType::ValueFractal:
-		switch (FractalType)
-		{
-		case EFNFractalType::FBM:
-			return SingleValueFractalFBM(x, y);
-		case EFNFractalType::Billow:
-			return SingleValueFractalBillow(x, y);
-		case EFNFractalType::RigidMulti:
-			return SingleValueFractalRigidMulti(x, y);
-		}
-	case EFNNoiseType::Perlin:
-		return SinglePerlin(0, x, y);
-	case EFNNoiseType::PerlinFractal:
-		switch (FractalType)
-		{
-		case EFNFractalType::FBM:
-			return SinglePerlinFractalFBM(x, y);
-		case EFNFractalType::Billow:
-			return SinglePerlinFractalBillow(x, y);
-		case EFNFractalType::RigidMulti:
-			return SinglePerlinFractalRigidMulti(x, y);
-		}
-	case EFNNoiseType::Simplex:
-		return SingleSimplex(0, x, y);
-	case EFNNoiseType::SimplexFractal:
-		switch (FractalType)
-		{
-		case EFNFractalType::FBM:
-			return SingleSimplexFractalFBM(x, y);
-		case EFNFractalType::Billow:
-			return SingleSimplexFractalBillow(x, y);
-		case EFNFractalType::RigidMulti:
-			return SingleSimplexFractalRigidMulti(x, y);
-		}
-	case EFNNoiseType::Cellular:
-		switch (CellularReturnType)
+		float zf = zCoords[z];
+
+		for (int32 y = 0; y < ySize; y++)
 		{
-		case EFNCellularReturnType::CellValue:
-		case EFNCellularReturnType::NoiseLookup:
-		case EFNCellularReturnType::Distance:
-			return SingleCellular(x, y);
-		default:
-			return SingleCellular2Edge(x, y);
-		}
-	case EFNNoiseType::WhiteNoise:
-		return GetWhiteNoise2D(x, y);
-	case EFNNoiseType::Cubic:
-		return SingleCubic(0, x, y);
-	case EFNNoiseType::CubicFractal:
-		switch (FractalType)
-		{
-		case EFNFractalType::FBM:
-			return SingleCubicFractalFBM(x, y);
-		case EFNFractalType::Billow:
-			return SingleCubicFractalBillow(x, y);
-		case EFNFractalType::RigidMulti:
-			return SingleCubicFractalRigidMulti(x, y);
+			float yf = yCoords[y];
+
+			for (int32 x = 0; x < xSize; x++, index++)
+			{
+				noiseSet[index] = noiseFunc(xCoords[x], yf, zf, gradientSet[index]);
+				gradientSet[index] *= frequency;
+			}
 		}
 	}
-	return 0;
 }
 
-// White Noise
-float UFastNoise::GetWhiteNoise4D(float x, float y, float z, float w) const
+template <typename FNoiseFunc>
+static void FillNoiseDerivativePointSet2D(float* noiseSet, FVector2D* gradientSet, const float* xPoints, const float* yPoints, int32 count, float frequency, FNoiseFunc noiseFunc)
 {
-	return ValCoord4D(Seed,
-		*reinterpret_cast<int32*>(&x) ^ (*reinterpret_cast<int32*>(&x) >> 16),
-		*reinterpret_cast<int32*>(&y) ^ (*reinterpret_cast<int32*>(&y) >> 16),
-		*reinterpret_cast<int32*>(&z) ^ (*reinterpret_cast<int32*>(&z) >> 16),
-		*reinterpret_cast<int32*>(&w) ^ (*reinterpret_cast<int32*>(&w) >> 16));
+	for (int32 i = 0; i < count; i++)
+	{
+		noiseSet[i] = noiseFunc(xPoints[i] * frequency, yPoints[i] * frequency, gradientSet[i]);
+		gradientSet[i] *= frequency;
+	}
 }
 
-float UFastNoise::GetWhiteNoise3D(float x, float y, float z) const
+template <typename FNoiseFunc>
+static void FillNoiseDerivativePointSet3D(float* noiseSet, FVector* gradientSet, const float* xPoints, const float* yPoints, const float* zPoints, int32 count, float frequency, FNoiseFunc noiseFunc)
 {
-	return ValCoord3D(Seed,
-		*reinterpret_cast<int32*>(&x) ^ (*reinterpret_cast<int32*>(&x) >> 16),
-		*reinterpret_cast<int32*>(&y) ^ (*reinterpret_cast<int32*>(&y) >> 16),
-		*reinterpret_cast<int32*>(&z) ^ (*reinterpret_cast<int32*>(&z) >> 16));
+	for (int32 i = 0; i < count; i++)
+	{
+		noiseSet[i] = noiseFunc(xPoints[i] * frequency, yPoints[i] * frequency, zPoints[i] * frequency, gradientSet[i]);
+		gradientSet[i] *= frequency;
+	}
 }
 
-float UFastNoise::GetWhiteNoise2D(float x, float y) const
+// The noise type is resolved once per set, noise types without an analytic derivative are sampled one point at a time
+void FFastNoiseParams::GetNoiseDerivativeSet2D(TArrayView<float> noiseSet, TArrayView<FVector2D> gradientSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize) const
 {
-	return ValCoord2D(Seed,
-		*reinterpret_cast<int32*>(&x) ^ (*reinterpret_cast<int32*>(&x) >> 16),
-		*reinterpret_cast<int32*>(&y) ^ (*reinterpret_cast<int32*>(&y) >> 16));
+	if (xSize <= 0 || ySize <= 0)
+		return;
+
+	check(noiseSet.Num() >= xSize * ySize && gradientSet.Num() >= xSize * ySize);
+
+	TArray<float> coords;
+	coords.SetNumUninitialized(ySize + xSize);
+	float* yCoords = coords.GetData();
+	float* xCoords = yCoords + ySize;
+
+	FillNoiseSetAxis(xCoords, xStart, stepSize, xSize, Frequency);
+	FillNoiseSetAxis(yCoords, yStart, stepSize, ySize, Frequency);
+
+	auto fill = [&](auto noiseFunc) { FillNoiseDerivativeSet2D(noiseSet.GetData(), gradientSet.GetData(), xCoords, yCoords, xSize, ySize, Frequency, noiseFunc); };
+
+	if (!DispatchNoiseDerivative2D(NoiseType, fill))
+		fill([this](float x, float y, FVector2D& gradient) { return SampleNoiseDerivative2D(NoiseType, x, y, gradient); });
 }
 
-float UFastNoise::GetWhiteNoiseInt4D(int32 x, int32 y, int32 z, int32 w) const
+void FFastNoiseParams::GetNoiseDerivativeSet3D(TArrayView<float> noiseSet, TArrayView<FVector> gradientSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize) const
 {
-	return ValCoord4D(Seed, x, y, z, w);
+	if (xSize <= 0 || ySize <= 0 || zSize <= 0)
+		return;
+
+	check(noiseSet.Num() >= xSize * ySize * zSize && gradientSet.Num() >= xSize * ySize * zSize);
+
+	TArray<float> coords;
+	coords.SetNumUninitialized(ySize + zSize + xSize);
+	float* yCoords = coords.GetData();
+	float* zCoords = yCoords + ySize;
+	float* xCoords = zCoords + zSize;
+
+	FillNoiseSetAxis(xCoords, xStart, stepSize, xSize, Frequency);
+	FillNoiseSetAxis(yCoords, yStart, stepSize, ySize, Frequency);
+	FillNoiseSetAxis(zCoords, zStart, stepSize, zSize, Frequency);
+
+	auto fill = [&](auto noiseFunc) { FillNoiseDerivativeSet3D(noiseSet.GetData(), gradientSet.GetData(), xCoords, yCoords, zCoords, xSize, ySize, zSize, Frequency, noiseFunc); };
+
+	if (!DispatchNoiseDerivative3D(NoiseType, fill))
+		fill([this](float x, float y, float z, FVector& gradient) { return SampleNoiseDerivative3D(NoiseType, x, y, z, gradient); });
 }
 
-float UFastNoise::GetWhiteNoiseInt3D(int32 x, int32 y, int32 z) const
+void FFastNoiseParams::GetNoiseDerivativePointSet2D(TArrayView<float> noiseSet, TArrayView<FVector2D> gradientSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const
 {
-	return ValCoord3D(Seed, x, y, z);
+	int32 count = noiseSet.Num();
+
+	check(gradientSet.Num() >= count && xPoints.Num() >= count && yPoints.Num() >= count);
+
+	if (count <= 0)
+		return;
+
+	auto fill = [&](auto noiseFunc) { FillNoiseDerivativePointSet2D(noiseSet.GetData(), gradientSet.GetData(), xPoints.GetData(), yPoints.GetData(), count, Frequency, noiseFunc); };
+
+	if (!DispatchNoiseDerivative2D(NoiseType, fill))
+		fill([this](float x, float y, FVector2D& gradient) { return SampleNoiseDerivative2D(NoiseType, x, y, gradient); });
 }
 
-float UFastNoise::GetWhiteNoiseInt2D(int32 x, int32 y) const
+void FFastNoiseParams::GetNoiseDerivativePointSet3D(TArrayView<float> noiseSet, TArrayView<FVector> gradientSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const
 {
-	return ValCoord2D(Seed, x, y);
+	int32 count = noiseSet.Num();
+
+	check(gradientSet.Num() >= count && xPoints.Num() >= count && yPoints.Num() >= count && zPoints.Num() >= count);
+
+	if (count <= 0)
+		return;
+
+	auto fill = [&](auto noiseFunc) { FillNoiseDerivativePointSet3D(noiseSet.GetData(), gradientSet.GetData(), xPoints.GetData(), yPoints.GetData(), zPoints.GetData(), count, Frequency, noiseFunc); };
+
+	if (!DispatchNoiseDerivative3D(NoiseType, fill))
+		fill([this](float x, float y, float z, FVector& gradient) { return SampleNoiseDerivative3D(NoiseType, x, y, z, gradient); });
 }
 
-// Value Noise
-float UFastNoise::GetValueFractal3D(float x, float y, float z) const
+// Heightmaps
+void FFastNoiseParams::GetHeightmap2D(TArrayView<float> heights, TArrayView<FVector> normals, TArrayView<float> slopes, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize, float heightScale) const
 {
-	x *= Frequency;
-	y *= Frequency;
-	z *= Frequency;
+	if (xSize <= 0 || ySize <= 0)
+		return;
+
+	const int32 count = xSize * ySize;
+
+	check(heights.Num() >= count);
+	check(normals.Num() == 0 || normals.Num() >= count);
+	check(slopes.Num() == 0 || slopes.Num() >= count);
+	// The central differences divide by the texel spacing
+	check(stepSize > 0);
+
+	float* heightData = heights.GetData();
+	TArray<FVector2D> gradients;
+	gradients.SetNumUninitialized(count);
+
+	// Axis coordinates with one texel before and after the grid, padded so the vectorized kernels can always load a full vector
+	const int32 apronXSize = xSize + 2;
+	const int32 apronYSize = ySize + 2;
+
+	TArray<float> coords;
+	coords.SetNumUninitialized(apronYSize + apronXSize + FastNoiseSIMD::MaxVectorWidth);
+	float* yCoords = coords.GetData();
+	float* xCoords = yCoords + apronYSize;
+
+	for (int32 i = 0; i < apronXSize + FastNoiseSIMD::MaxVectorWidth; i++)
+		xCoords[i] = (xStart + (i - 1) * stepSize) * Frequency;
+	for (int32 i = 0; i < apronYSize; i++)
+		yCoords[i] = (yStart + (i - 1) * stepSize) * Frequency;
+
+	auto fill = [&](auto noiseFunc) { FillNoiseDerivativeSet2D(heightData, gradients.GetData(), xCoords + 1, yCoords + 1, xSize, ySize, Frequency, noiseFunc); };
+
+	if (!DispatchNoiseDerivative2D(NoiseType, fill))
+	{
+		// The apron texels are the edge texels of the neighbouring tiles, so both tiles difference the same samples
+		TArray<float> apron;
+		apron.SetNumUninitialized(apronXSize * apronYSize);
+		FillNoiseGrid2D(apron.GetData(), xCoords, yCoords, apronXSize, apronYSize);
+
+		const float gradientScale = 1 / (2 * stepSize);
+		int32 index = 0;
+
+		for (int32 y = 0; y < ySize; y++)
+		{
+			const float* row = apron.GetData() + apronXSize * (y + 1) + 1;
+
+			for (int32 x = 0; x < xSize; x++, index++)
+			{
+				heightData[index] = row[x];
+				gradients[index] = FVector2D((row[x + 1] - row[x - 1]) * gradientScale, (row[x + apronXSize] - row[x - apronXSize]) * gradientScale);
+			}
+		}
+	}
+
+	for (int32 i = 0; i < count; i++)
+	{
+		heightData[i] *= heightScale;
+
+		// Normal of z = height(x, y) is (-dh/dx, -dh/dy, 1) normalized, its z is the cosine of the slope
+		const float xSlope = gradients[i].X * heightScale;
+		const float ySlope = gradients[i].Y * heightScale;
+		const float invLength = FMath::InvSqrt(1 + xSlope * xSlope + ySlope * ySlope);
+
+		if (normals.Num())
+			normals[i] = FVector(-xSlope * invLength, -ySlope * invLength, invLength);
+		if (slopes.Num())
+			slopes[i] = FMath::RadiansToDegrees(FMath::Acos(invLength));
+	}
+}
+
+// Large World Coordinates
+// Every octave is sampled by a copy of the params with the lattice origin moved next to the position,
+// the octave position is split in double and the kernels only see the float offset from that cell
+static int64 FloorToInt64(double f) { return (int64)floor(f); }
+
+// Fractal noise types are summed octave by octave, each octave sampled as the base noise type
+static EFNNoiseType OctaveNoiseType(EFNNoiseType noiseType)
+{
+	switch (noiseType)
+	{
+	case EFNNoiseType::ValueFractal:
+		return EFNNoiseType::Value;
+	case EFNNoiseType::PerlinFractal:
+		return EFNNoiseType::Perlin;
+	case EFNNoiseType::SimplexFractal:
+		return EFNNoiseType::Simplex;
+	case EFNNoiseType::CubicFractal:
+		return EFNNoiseType::Cubic;
+	default:
+		return noiseType;
+	}
+}
+
+template <typename FOctaveFunc>
+void FFastNoiseParams::ForEachLargeOctave(FOctaveFunc func) const
+{
+	FFastNoiseParams octave = *this;
+	octave.NoiseType = OctaveNoiseType(NoiseType);
+
+	if (octave.NoiseType == NoiseType)
+	{
+		func(octave, (double)Frequency, 1.0f);
+		return;
+	}
+
+	double frequency = Frequency;
+	float amp = 1;
+
+	for (int32 i = 0; i < FractalOctaves; i++)
+	{
+		if (i > 0)
+		{
+			frequency *= FractalLacunarity;
+			amp *= FractalGain;
+			if (i == FractalOctaves - 1)
+				amp *= FractalFade;
+		}
+
+		// Same order of operations as SingleFractal, RigidMulti subtracts every octave after the first
+		octave.BaseOffset = OctaveOffset(i);
+		func(octave, frequency, i > 0 && FractalType == EFNFractalType::RigidMulti ? -amp : amp);
+	}
+}
+
+float FFastNoiseParams::LargeOctaveNoise(float noise) const
+{
+	if (OctaveNoiseType(NoiseType) == NoiseType)
+		return noise;
 
 	switch (FractalType)
 	{
-	case EFNFractalType::FBM:
-		return SingleValueFractalFBM(x, y, z);
 	case EFNFractalType::Billow:
-		return SingleValueFractalBillow(x, y, z);
+		return FractalOctave<EFNFractalType::Billow>(noise);
 	case EFNFractalType::RigidMulti:
-		return SingleValueFractalRigidMulti(x, y, z);
+		return FractalOctave<EFNFractalType::RigidMulti>(noise);
 	default:
-		return 0;
+		return noise;
 	}
 }
 
-float UFastNoise::SingleValueFractalFBM(float x, float y, float z) const
+float FFastNoiseParams::LargeNoiseSum(float sum) const
 {
-	float sum = SingleValue(m_perm[0], x, y, z);
-	float amp = 1;
-	int32 i = 0;
+	if (OctaveNoiseType(NoiseType) == NoiseType || FractalType == EFNFractalType::RigidMulti)
+		return sum;
 
-	while (++i < FractalOctaves)
+	return sum * FractalBounding;
+}
+
+bool FFastNoiseParams::SamplesLargeSetPerPoint() const
+{
+	// White noise hashes the float position and has no lattice, the vectorized cellular lookup positions are relative to the set's cell
+	return NoiseType == EFNNoiseType::WhiteNoise || (NoiseType == EFNNoiseType::Cellular && CellularReturnType == EFNCellularReturnType::NoiseLookup);
+}
+
+bool FFastNoiseParams::FillsGridByOctave() const
+{
+	return FractalSetOrder == EFNFractalSetOrder::OctaveMajor && FractalOctaves > 1 && OctaveNoiseType(NoiseType) != NoiseType;
+}
+
+// Samples of the output tile an octave major grid sums its octaves in, small enough to stay in cache between octaves
+static const int32 OctaveTileSize = 4096;
+
+void FFastNoiseParams::FillNoiseGridOctaves2D(float* out, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize) const
+{
+	const int32 xCount = xSize + FastNoiseSIMD::MaxVectorWidth;
+	const int32 rowsPerTile = FMath::Min(ySize, FMath::DivideAndRoundUp(OctaveTileSize, xSize));
+
+	TArray<float> buffer;
+	buffer.SetNumUninitialized(rowsPerTile + xCount + rowsPerTile * xSize);
+	float* yOctave = buffer.GetData();
+	float* xOctave = yOctave + rowsPerTile;
+	float* octaveNoise = xOctave + xCount;
+
+	for (int32 y = 0; y < ySize; y += rowsPerTile)
 	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
+		const int32 rows = FMath::Min(rowsPerTile, ySize - y);
+		const int32 count = rows * xSize;
+		float* tile = out + y * xSize;
 
-		amp *= FractalGain;
-		sum += SingleValue(m_perm[i], x, y, z) * amp;
+		FMemory::Memcpy(xOctave, xCoords, xCount * sizeof(float));
+		FMemory::Memcpy(yOctave, yCoords + y, rows * sizeof(float));
+
+		bool bFirst = true;
+
+		ForEachLargeOctave([&](FFastNoiseParams& octave, double frequency, float weight)
+		{
+			// The axes are scaled in place, the same float multiplications SingleFractal applies to each position
+			if (!bFirst)
+			{
+				for (int32 i = 0; i < xCount; i++)
+					xOctave[i] *= FractalLacunarity;
+				for (int32 i = 0; i < rows; i++)
+					yOctave[i] *= FractalLacunarity;
+			}
+
+			octave.FillNoiseGrid2D(octaveNoise, xOctave, yOctave, xSize, rows);
+
+			if (bFirst)
+			{
+				for (int32 i = 0; i < count; i++)
+					tile[i] = LargeOctaveNoise(octaveNoise[i]);
+			}
+			else
+			{
+				for (int32 i = 0; i < count; i++)
+					tile[i] += LargeOctaveNoise(octaveNoise[i]) * weight;
+			}
+
+			bFirst = false;
+		});
+
+		for (int32 i = 0; i < count; i++)
+			tile[i] = LargeNoiseSum(tile[i]);
 	}
+}
+
+void FFastNoiseParams::FillNoiseGridOctaves3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize) const
+{
+	const int32 xCount = xSize + FastNoiseSIMD::MaxVectorWidth;
+	const int32 rowsPerTile = FMath::Min(ySize, FMath::DivideAndRoundUp(OctaveTileSize, xSize));
+	const int32 rowCount = ySize * zSize;
+
+	TArray<float> buffer;
+	buffer.SetNumUninitialized(rowsPerTile + xCount + rowsPerTile * xSize);
+	float* yOctave = buffer.GetData();
+	float* xOctave = yOctave + rowsPerTile;
+	float* octaveNoise = xOctave + xCount;
+
+	// Tiles are runs of rows inside one z slice
+	int32 row = 0;
+
+	while (row < rowCount)
+	{
+		const int32 z = row / ySize;
+		const int32 y = row - z * ySize;
+		const int32 rows = FMath::Min(rowsPerTile, ySize - y);
+		const int32 count = rows * xSize;
+		float* tile = out + row * xSize;
+		float zOctave = zCoords[z];
+
+		FMemory::Memcpy(xOctave, xCoords, xCount * sizeof(float));
+		FMemory::Memcpy(yOctave, yCoords + y, rows * sizeof(float));
 
-	return sum * m_fractalBounding;
+		bool bFirst = true;
+
+		ForEachLargeOctave([&](FFastNoiseParams& octave, double frequency, float weight)
+		{
+			if (!bFirst)
+			{
+				for (int32 i = 0; i < xCount; i++)
+					xOctave[i] *= FractalLacunarity;
+				for (int32 i = 0; i < rows; i++)
+					yOctave[i] *= FractalLacunarity;
+				zOctave *= FractalLacunarity;
+			}
+
+			octave.FillNoiseGrid3D(octaveNoise, xOctave, yOctave, &zOctave, xSize, rows, 1);
+
+			if (bFirst)
+			{
+				for (int32 i = 0; i < count; i++)
+					tile[i] = LargeOctaveNoise(octaveNoise[i]);
+			}
+			else
+			{
+				for (int32 i = 0; i < count; i++)
+					tile[i] += LargeOctaveNoise(octaveNoise[i]) * weight;
+			}
+
+			bFirst = false;
+		});
+
+		for (int32 i = 0; i < count; i++)
+			tile[i] = LargeNoiseSum(tile[i]);
+
+		row += rows;
+	}
 }
 
-float UFastNoise::SingleValueFractalBillow(float x, float y, float z) const
+// Best of a few GetNoiseSet2D/3D(...) calls of every fractal noise type in both octave orders, at the active SIMD level
+static void BenchmarkFractalSetOrder(FOutputDevice& ar)
 {
-	float sum = FastAbs(SingleValue(m_perm[0], x, y, z)) * 2 - 1;
-	float amp = 1;
-	int32 i = 0;
+	const EFNNoiseType noiseTypes[] = { EFNNoiseType::ValueFractal, EFNNoiseType::PerlinFractal, EFNNoiseType::SimplexFractal, EFNNoiseType::CubicFractal };
+	const TCHAR* noiseNames[] = { TEXT("ValueFractal"), TEXT("PerlinFractal"), TEXT("SimplexFractal"), TEXT("CubicFractal") };
+	const int32 size2D = 512;
+	const int32 size3D = 64;
+	const int32 runs = 3;
 
-	while (++i < FractalOctaves)
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetFractalOctaves(5);
+
+	TArray<float> noiseSet;
+	noiseSet.SetNumUninitialized(FMath::Max(size2D * size2D, size3D * size3D * size3D));
+
+	for (int32 type = 0; type < UE_ARRAY_COUNT(noiseTypes); type++)
+	{
+		noise->SetNoiseType(noiseTypes[type]);
+		FFastNoiseEvaluator evaluator = noise->CreateEvaluator();
+		FFastNoiseParams params = evaluator.GetParams();
+
+		double milliseconds[2][2];
+
+		for (int32 order = 0; order < 2; order++)
+		{
+			params.FractalSetOrder = order == 0 ? EFNFractalSetOrder::PointMajor : EFNFractalSetOrder::OctaveMajor;
+			milliseconds[order][0] = milliseconds[order][1] = MAX_dbl;
+
+			for (int32 run = 0; run < runs; run++)
+			{
+				double start = FPlatformTime::Seconds();
+				params.GetNoiseSet2D(noiseSet, 0, 0, size2D, size2D);
+				double middle = FPlatformTime::Seconds();
+				params.GetNoiseSet3D(noiseSet, 0, 0, 0, size3D, size3D, size3D);
+				double end = FPlatformTime::Seconds();
+
+				milliseconds[order][0] = FMath::Min(milliseconds[order][0], (middle - start) * 1000);
+				milliseconds[order][1] = FMath::Min(milliseconds[order][1], (end - middle) * 1000);
+			}
+		}
+
+		ar.Logf(TEXT("%s %dx%d: point major %.2f ms, octave major %.2f ms; %dx%dx%d: point major %.2f ms, octave major %.2f ms"),
+			noiseNames[type], size2D, size2D, milliseconds[0][0], milliseconds[1][0], size3D, size3D, size3D, milliseconds[0][1], milliseconds[1][1]);
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice BenchmarkFractalSetOrderCommand(
+	TEXT("fastnoise.BenchmarkFractalSetOrder"),
+	TEXT("Times the noise set grids of the fractal noise types with each fastnoise.FractalSetOrder, 5 octaves at the active SIMD level."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&BenchmarkFractalSetOrder));
+
+void FFastNoiseParams::MoveLatticeOrigin2D(double& x, double& y)
+{
+	if (NoiseType == EFNNoiseType::Simplex)
+	{
+		// The origin is a cell of the skewed lattice, unskewed with the exact inverse of the float F2 the kernel skews with
+		const double skew = F2;
+		const double unskew = skew / (1 + 2 * skew);
+
+		double t = (x + y) * skew;
+		int64 i = FloorToInt64(x + t);
+		int64 j = FloorToInt64(y + t);
+
+		t = (double)(i + j) * unskew;
+		x -= i - t;
+		y -= j - t;
+
+		LatticeOriginX = i;
+		LatticeOriginY = j;
+		return;
+	}
+
+	LatticeOriginX = FloorToInt64(x);
+	LatticeOriginY = FloorToInt64(y);
+	x -= LatticeOriginX;
+	y -= LatticeOriginY;
+}
+
+void FFastNoiseParams::MoveLatticeOrigin3D(double& x, double& y, double& z)
+{
+	if (NoiseType == EFNNoiseType::Simplex)
+	{
+		const double skew = F3;
+		const double unskew = skew / (1 + 3 * skew);
+
+		double t = (x + y + z) * skew;
+		int64 i = FloorToInt64(x + t);
+		int64 j = FloorToInt64(y + t);
+		int64 k = FloorToInt64(z + t);
+
+		t = (double)(i + j + k) * unskew;
+		x -= i - t;
+		y -= j - t;
+		z -= k - t;
+
+		LatticeOriginX = i;
+		LatticeOriginY = j;
+		LatticeOriginZ = k;
+		return;
+	}
+
+	LatticeOriginX = FloorToInt64(x);
+	LatticeOriginY = FloorToInt64(y);
+	LatticeOriginZ = FloorToInt64(z);
+	x -= LatticeOriginX;
+	y -= LatticeOriginY;
+	z -= LatticeOriginZ;
+}
+
+float FFastNoiseParams::GetNoiseLarge2D(double x, double y) const
+{
+	if (NoiseType == EFNNoiseType::WhiteNoise)
+		return GetNoise2D((float)x, (float)y);
+
+	float sum = 0;
+
+	ForEachLargeOctave([&](FFastNoiseParams& octave, double frequency, float weight)
+	{
+		double xf = x * frequency;
+		double yf = y * frequency;
+		octave.MoveLatticeOrigin2D(xf, yf);
+
+		sum += LargeOctaveNoise(octave.SampleNoise2D(octave.NoiseType, (float)xf, (float)yf)) * weight;
+	});
+
+	return LargeNoiseSum(sum);
+}
+
+float FFastNoiseParams::GetNoiseLarge3D(double x, double y, double z) const
+{
+	if (NoiseType == EFNNoiseType::WhiteNoise)
+		return GetNoise3D((float)x, (float)y, (float)z);
+
+	float sum = 0;
+
+	ForEachLargeOctave([&](FFastNoiseParams& octave, double frequency, float weight)
+	{
+		double xf = x * frequency;
+		double yf = y * frequency;
+		double zf = z * frequency;
+		octave.MoveLatticeOrigin3D(xf, yf, zf);
+
+		sum += LargeOctaveNoise(octave.SampleNoise3D(octave.NoiseType, (float)xf, (float)yf, (float)zf)) * weight;
+	});
+
+	return LargeNoiseSum(sum);
+}
+
+// Axis coordinates of a large world set relative to the octave's lattice origin, small enough for float
+static void FillLargeNoiseSetAxis(float* coords, double start, double stepSize, int32 size)
+{
+	for (int32 i = 0; i < size; i++)
+		coords[i] = (float)(start + i * stepSize);
+}
+
+void FFastNoiseParams::GetNoiseSetLarge2D(TArrayView<float> noiseSet, double xStart, double yStart, int32 xSize, int32 ySize, float stepSize) const
+{
+	if (xSize <= 0 || ySize <= 0)
+		return;
+
+	check(noiseSet.Num() >= xSize * ySize);
+
+	const int32 count = xSize * ySize;
+	float* out = noiseSet.GetData();
+
+	if (SamplesLargeSetPerPoint())
+	{
+		int32 index = 0;
+
+		for (int32 y = 0; y < ySize; y++)
+			for (int32 x = 0; x < xSize; x++)
+				out[index++] = GetNoiseLarge2D(xStart + x * (double)stepSize, yStart + y * (double)stepSize);
+		return;
+	}
+
+	// X coordinates are padded so the vectorized kernels can always load a full vector
+	TArray<float> buffer;
+	buffer.SetNumUninitialized(ySize + xSize + FastNoiseSIMD::MaxVectorWidth + count);
+	float* yCoords = buffer.GetData();
+	float* xCoords = yCoords + ySize;
+	float* octaveNoise = xCoords + xSize + FastNoiseSIMD::MaxVectorWidth;
+
+	FMemory::Memzero(out, count * sizeof(float));
+
+	ForEachLargeOctave([&](FFastNoiseParams& octave, double frequency, float weight)
 	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
+		double xf = xStart * frequency;
+		double yf = yStart * frequency;
+		octave.MoveLatticeOrigin2D(xf, yf);
 
-		amp *= FractalGain;
-		sum += (FastAbs(SingleValue(m_perm[i], x, y, z)) * 2 - 1) * amp;
-	}
+		FillLargeNoiseSetAxis(xCoords, xf, stepSize * frequency, xSize + FastNoiseSIMD::MaxVectorWidth);
+		FillLargeNoiseSetAxis(yCoords, yf, stepSize * frequency, ySize);
+		octave.FillNoiseGrid2D(octaveNoise, xCoords, yCoords, xSize, ySize);
+
+		for (int32 i = 0; i < count; i++)
+			out[i] += LargeOctaveNoise(octaveNoise[i]) * weight;
+	});
 
-	return sum * m_fractalBounding;
+	for (int32 i = 0; i < count; i++)
+		out[i] = LargeNoiseSum(out[i]);
 }
 
-float UFastNoise::SingleValueFractalRigidMulti(float x, float y, float z) const
+void FFastNoiseParams::GetNoiseSetLarge3D(TArrayView<float> noiseSet, double xStart, double yStart, double zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize) const
 {
-	float sum = 1 - FastAbs(SingleValue(m_perm[0], x, y, z));
-	float amp = 1;
-	int32 i = 0;
+	if (xSize <= 0 || ySize <= 0 || zSize <= 0)
+		return;
 
-	while (++i < FractalOctaves)
+	check(noiseSet.Num() >= xSize * ySize * zSize);
+
+	const int32 count = xSize * ySize * zSize;
+	float* out = noiseSet.GetData();
+
+	if (SamplesLargeSetPerPoint())
 	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
+		int32 index = 0;
 
-		amp *= FractalGain;
-		sum -= (1 - FastAbs(SingleValue(m_perm[i], x, y, z))) * amp;
+		for (int32 z = 0; z < zSize; z++)
+			for (int32 y = 0; y < ySize; y++)
+				for (int32 x = 0; x < xSize; x++)
+					out[index++] = GetNoiseLarge3D(xStart + x * (double)stepSize, yStart + y * (double)stepSize, zStart + z * (double)stepSize);
+		return;
 	}
 
-	return sum;
+	TArray<float> buffer;
+	buffer.SetNumUninitialized(zSize + ySize + xSize + FastNoiseSIMD::MaxVectorWidth + count);
+	float* zCoords = buffer.GetData();
+	float* yCoords = zCoords + zSize;
+	float* xCoords = yCoords + ySize;
+	float* octaveNoise = xCoords + xSize + FastNoiseSIMD::MaxVectorWidth;
+
+	FMemory::Memzero(out, count * sizeof(float));
+
+	ForEachLargeOctave([&](FFastNoiseParams& octave, double frequency, float weight)
+	{
+		double xf = xStart * frequency;
+		double yf = yStart * frequency;
+		double zf = zStart * frequency;
+		octave.MoveLatticeOrigin3D(xf, yf, zf);
+
+		FillLargeNoiseSetAxis(xCoords, xf, stepSize * frequency, xSize + FastNoiseSIMD::MaxVectorWidth);
+		FillLargeNoiseSetAxis(yCoords, yf, stepSize * frequency, ySize);
+		FillLargeNoiseSetAxis(zCoords, zf, stepSize * frequency, zSize);
+		octave.FillNoiseGrid3D(octaveNoise, xCoords, yCoords, zCoords, xSize, ySize, zSize);
+
+		for (int32 i = 0; i < count; i++)
+			out[i] += LargeOctaveNoise(octaveNoise[i]) * weight;
+	});
+
+	for (int32 i = 0; i < count; i++)
+		out[i] = LargeNoiseSum(out[i]);
 }
 
-float UFastNoise::GetValue3D(float x, float y, float z) const
+// Value Noise
+float FFastNoiseParams::GetValueFractal3D(float x, float y, float z) const
+{
+	return SampleNoise3D(EFNNoiseType::ValueFractal, x * Frequency, y * Frequency, z * Frequency);
+}
+
+float FFastNoiseParams::GetValue3D(float x, float y, float z) const
 {
-	return SingleValue(0, x * Frequency, y * Frequency, z * Frequency);
+	return SampleNoise3D(EFNNoiseType::Value, x * Frequency, y * Frequency, z * Frequency);
 }
 
-float UFastNoise::SingleValue(uint8 offset, float x, float y, float z) const
+template <typename THash, typename TInterp>
+float FFastNoiseParams::SingleValue(uint8 offset, float x, float y, float z) const
 {
 	int32 x0 = FastFloor(x);
 	int32 y0 = FastFloor(y);
 	int32 z0 = FastFloor(z);
+
+	float xs = TInterp::Apply(x - (float)x0);
+	float ys = TInterp::Apply(y - (float)y0);
+	float zs = TInterp::Apply(z - (float)z0);
+
+	x0 = LatticeX(x0);
+	y0 = LatticeY(y0);
+	z0 = LatticeZ(z0);
 	int32 x1 = x0 + 1;
 	int32 y1 = y0 + 1;
 	int32 z1 = z0 + 1;
 
-	float xs = 0;
-	float ys = 0;
-	float zs = 0;
-	switch (Interpolation)
-	{
-	case EFNInterp::Linear:
-		xs = x - (float)x0;
-		ys = y - (float)y0;
-		zs = z - (float)z0;
-		break;
-	case EFNInterp::Hermite:
-		xs = InterpHermiteFunc(x - (float)x0);
-		ys = InterpHermiteFunc(y - (float)y0);
-		zs = InterpHermiteFunc(z - (float)z0);
-		break;
-	case EFNInterp::Quintic:
-		xs = InterpQuinticFunc(x - (float)x0);
-		ys = InterpQuinticFunc(y - (float)y0);
-		zs = InterpQuinticFunc(z - (float)z0);
-		break;
-	}
-
-	float xf00 = Lerp(ValCoord3DFast(offset, x0, y0, z0), ValCoord3DFast(offset, x1, y0, z0), xs);
-	float xf10 = Lerp(ValCoord3DFast(offset, x0, y1, z0), ValCoord3DFast(offset, x1, y1, z0), xs);
-	float xf01 = Lerp(ValCoord3DFast(offset, x0, y0, z1), ValCoord3DFast(offset, x1, y0, z1), xs);
-	float xf11 = Lerp(ValCoord3DFast(offset, x0, y1, z1), ValCoord3DFast(offset, x1, y1, z1), xs);
+	float xf00 = Lerp(ValCoord3DFast<THash>(offset, x0, y0, z0), ValCoord3DFast<THash>(offset, x1, y0, z0), xs);
+	float xf10 = Lerp(ValCoord3DFast<THash>(offset, x0, y1, z0), ValCoord3DFast<THash>(offset, x1, y1, z0), xs);
+	float xf01 = Lerp(ValCoord3DFast<THash>(offset, x0, y0, z1), ValCoord3DFast<THash>(offset, x1, y0, z1), xs);
+	float xf11 = Lerp(ValCoord3DFast<THash>(offset, x0, y1, z1), ValCoord3DFast<THash>(offset, x1, y1, z1), xs);
 
 	float yf0 = Lerp(xf00, xf10, ys);
 	float yf1 = Lerp(xf01, xf11, ys);
@@ -677,225 +3631,225 @@ float UFastNoise::SingleValue(uint8 offset, float x, float y, float z) const
 	return Lerp(yf0, yf1, zs);
 }
 
-float UFastNoise::GetValueFractal2D(float x, float y) const
+float FFastNoiseParams::GetValueFractalDerivative3D(float x, float y, float z, FVector& gradient) const
 {
-	x *= Frequency;
-	y *= Frequency;
+	float noise = SampleNoiseDerivative3D(EFNNoiseType::ValueFractal, x * Frequency, y * Frequency, z * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
+}
 
-	switch (FractalType)
-	{
-	case EFNFractalType::FBM:
-		return SingleValueFractalFBM(x, y);
-	case EFNFractalType::Billow:
-		return SingleValueFractalBillow(x, y);
-	case EFNFractalType::RigidMulti:
-		return SingleValueFractalRigidMulti(x, y);
-	default:
-		return 0;
-	}
+float FFastNoiseParams::GetValueDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	float noise = SampleNoiseDerivative3D(EFNNoiseType::Value, x * Frequency, y * Frequency, z * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
 }
 
-float UFastNoise::SingleValueFractalFBM(float x, float y) const
+// Corners are indexed x + 2 * y + 4 * z, the value is interpolated exactly as in SingleValue(...)
+template <typename THash, typename TInterp>
+float FFastNoiseParams::SingleValueDerivative(uint8 offset, float x, float y, float z, FVector& gradient) const
 {
-	float sum = SingleValue(m_perm[0], x, y);
-	float amp = 1;
-	int32 i = 0;
+	int32 x0 = FastFloor(x);
+	int32 y0 = FastFloor(y);
+	int32 z0 = FastFloor(z);
 
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
+	float xs = TInterp::Apply(x - (float)x0);
+	float ys = TInterp::Apply(y - (float)y0);
+	float zs = TInterp::Apply(z - (float)z0);
+	float dxs = TInterp::Derivative(x - (float)x0);
+	float dys = TInterp::Derivative(y - (float)y0);
+	float dzs = TInterp::Derivative(z - (float)z0);
 
-		amp *= FractalGain;
-		sum += SingleValue(m_perm[i], x, y) * amp;
-	}
+	x0 = LatticeX(x0);
+	y0 = LatticeY(y0);
+	z0 = LatticeZ(z0);
+	int32 x1 = x0 + 1;
+	int32 y1 = y0 + 1;
+	int32 z1 = z0 + 1;
+
+	float v[8];
+	v[0] = ValCoord3DFast<THash>(offset, x0, y0, z0);
+	v[1] = ValCoord3DFast<THash>(offset, x1, y0, z0);
+	v[2] = ValCoord3DFast<THash>(offset, x0, y1, z0);
+	v[3] = ValCoord3DFast<THash>(offset, x1, y1, z0);
+	v[4] = ValCoord3DFast<THash>(offset, x0, y0, z1);
+	v[5] = ValCoord3DFast<THash>(offset, x1, y0, z1);
+	v[6] = ValCoord3DFast<THash>(offset, x0, y1, z1);
+	v[7] = ValCoord3DFast<THash>(offset, x1, y1, z1);
+
+	float xf00 = Lerp(v[0], v[1], xs);
+	float xf10 = Lerp(v[2], v[3], xs);
+	float xf01 = Lerp(v[4], v[5], xs);
+	float xf11 = Lerp(v[6], v[7], xs);
 
-	return sum * m_fractalBounding;
+	float yf0 = Lerp(xf00, xf10, ys);
+	float yf1 = Lerp(xf01, xf11, ys);
+
+	gradient.X = dxs * Lerp(Lerp(v[1] - v[0], v[3] - v[2], ys), Lerp(v[5] - v[4], v[7] - v[6], ys), zs);
+	gradient.Y = dys * Lerp(xf10 - xf00, xf11 - xf01, zs);
+	gradient.Z = dzs * (yf1 - yf0);
+
+	return Lerp(yf0, yf1, zs);
 }
 
-float UFastNoise::SingleValueFractalBillow(float x, float y) const
+float FFastNoiseParams::GetValueFractal2D(float x, float y) const
 {
-	float sum = FastAbs(SingleValue(m_perm[0], x, y)) * 2 - 1;
-	float amp = 1;
-	int32 i = 0;
-
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		amp *= FractalGain;
-		sum += (FastAbs(SingleValue(m_perm[i], x, y)) * 2 - 1) * amp;
-	}
+	return SampleNoise2D(EFNNoiseType::ValueFractal, x * Frequency, y * Frequency);
+}
 
-	return sum * m_fractalBounding;
+float FFastNoiseParams::GetValue2D(float x, float y) const
+{
+	return SampleNoise2D(EFNNoiseType::Value, x * Frequency, y * Frequency);
 }
 
-float UFastNoise::SingleValueFractalRigidMulti(float x, float y) const
+template <typename THash, typename TInterp>
+float FFastNoiseParams::SingleValue(uint8 offset, float x, float y) const
 {
-	float sum = 1 - FastAbs(SingleValue(m_perm[0], x, y));
-	float amp = 1;
-	int32 i = 0;
+	int32 x0 = FastFloor(x);
+	int32 y0 = FastFloor(y);
 
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
+	float xs = TInterp::Apply(x - (float)x0);
+	float ys = TInterp::Apply(y - (float)y0);
 
-		amp *= FractalGain;
-		sum -= (1 - FastAbs(SingleValue(m_perm[i], x, y))) * amp;
-	}
+	x0 = LatticeX(x0);
+	y0 = LatticeY(y0);
+	int32 x1 = x0 + 1;
+	int32 y1 = y0 + 1;
 
-	return sum;
+	float xf0 = Lerp(ValCoord2DFast<THash>(offset, x0, y0), ValCoord2DFast<THash>(offset, x1, y0), xs);
+	float xf1 = Lerp(ValCoord2DFast<THash>(offset, x0, y1), ValCoord2DFast<THash>(offset, x1, y1), xs);
+
+	return Lerp(xf0, xf1, ys);
 }
 
-float UFastNoise::GetValue2D(float x, float y) const
+float FFastNoiseParams::GetValueFractalDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	float noise = SampleNoiseDerivative2D(EFNNoiseType::ValueFractal, x * Frequency, y * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
+}
+
+float FFastNoiseParams::GetValueDerivative2D(float x, float y, FVector2D& gradient) const
 {
-	return SingleValue(0, x * Frequency, y * Frequency);
+	float noise = SampleNoiseDerivative2D(EFNNoiseType::Value, x * Frequency, y * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
 }
 
-float UFastNoise::SingleValue(uint8 offset, float x, float y) const
+template <typename THash, typename TInterp>
+float FFastNoiseParams::SingleValueDerivative(uint8 offset, float x, float y, FVector2D& gradient) const
 {
 	int32 x0 = FastFloor(x);
 	int32 y0 = FastFloor(y);
+
+	float xs = TInterp::Apply(x - (float)x0);
+	float ys = TInterp::Apply(y - (float)y0);
+	float dxs = TInterp::Derivative(x - (float)x0);
+	float dys = TInterp::Derivative(y - (float)y0);
+
+	x0 = LatticeX(x0);
+	y0 = LatticeY(y0);
 	int32 x1 = x0 + 1;
 	int32 y1 = y0 + 1;
 
-	float xs = 0;
-	float ys = 0;
-	switch (Interpolation)
-	{
-	case EFNInterp::Linear:
-		xs = x - (float)x0;
-		ys = y - (float)y0;
-		break;
-	case EFNInterp::Hermite:
-		xs = InterpHermiteFunc(x - (float)x0);
-		ys = InterpHermiteFunc(y - (float)y0);
-		break;
-	case EFNInterp::Quintic:
-		xs = InterpQuinticFunc(x - (float)x0);
-		ys = InterpQuinticFunc(y - (float)y0);
-		break;
-	}
+	float v[4];
+	v[0] = ValCoord2DFast<THash>(offset, x0, y0);
+	v[1] = ValCoord2DFast<THash>(offset, x1, y0);
+	v[2] = ValCoord2DFast<THash>(offset, x0, y1);
+	v[3] = ValCoord2DFast<THash>(offset, x1, y1);
 
-	float xf0 = Lerp(ValCoord2DFast(offset, x0, y0), ValCoord2DFast(offset, x1, y0), xs);
-	float xf1 = Lerp(ValCoord2DFast(offset, x0, y1), ValCoord2DFast(offset, x1, y1), xs);
+	float xf0 = Lerp(v[0], v[1], xs);
+	float xf1 = Lerp(v[2], v[3], xs);
+
+	gradient.X = dxs * Lerp(v[1] - v[0], v[3] - v[2], ys);
+	gradient.Y = dys * (xf1 - xf0);
 
 	return Lerp(xf0, xf1, ys);
 }
 
 // Perlin Noise
-float UFastNoise::GetPerlinFractal3D(float x, float y, float z) const
+float FFastNoiseParams::GetPerlinFractal3D(float x, float y, float z) const
 {
-	x *= Frequency;
-	y *= Frequency;
-	z *= Frequency;
-
-	switch (FractalType)
-	{
-	case EFNFractalType::FBM:
-		return SinglePerlinFractalFBM(x, y, z);
-	case EFNFractalType::Billow:
-		return SinglePerlinFractalBillow(x, y, z);
-	case EFNFractalType::RigidMulti:
-		return SinglePerlinFractalRigidMulti(x, y, z);
-	default:
-		return 0;
-	}
+	return SampleNoise3D(EFNNoiseType::PerlinFractal, x * Frequency, y * Frequency, z * Frequency);
 }
 
-float UFastNoise::SinglePerlinFractalFBM(float x, float y, float z) const
+float FFastNoiseParams::GetPerlin3D(float x, float y, float z) const
 {
-	float sum = SinglePerlin(m_perm[0], x, y, z);
-	float amp = 1;
-	int32 i = 0;
+	return SampleNoise3D(EFNNoiseType::Perlin, x * Frequency, y * Frequency, z * Frequency);
+}
 
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
+template <typename THash, typename TInterp>
+float FFastNoiseParams::SinglePerlin(uint8 offset, float x, float y, float z) const
+{
+	int32 x0 = FastFloor(x);
+	int32 y0 = FastFloor(y);
+	int32 z0 = FastFloor(z);
 
-		amp *= FractalGain;
-		sum += SinglePerlin(m_perm[i], x, y, z) * amp;
-	}
+	float xs = TInterp::Apply(x - (float)x0);
+	float ys = TInterp::Apply(y - (float)y0);
+	float zs = TInterp::Apply(z - (float)z0);
 
-	return sum * m_fractalBounding;
-}
+	float xd0 = x - (float)x0;
+	float yd0 = y - (float)y0;
+	float zd0 = z - (float)z0;
+	float xd1 = xd0 - 1;
+	float yd1 = yd0 - 1;
+	float zd1 = zd0 - 1;
 
-float UFastNoise::SinglePerlinFractalBillow(float x, float y, float z) const
-{
-	float sum = FastAbs(SinglePerlin(m_perm[0], x, y, z)) * 2 - 1;
-	float amp = 1;
-	int32 i = 0;
+	x0 = LatticeX(x0);
+	y0 = LatticeY(y0);
+	z0 = LatticeZ(z0);
+	int32 x1 = x0 + 1;
+	int32 y1 = y0 + 1;
+	int32 z1 = z0 + 1;
 
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
+	float xf00 = Lerp(GradCoord3D<THash>(offset, x0, y0, z0, xd0, yd0, zd0), GradCoord3D<THash>(offset, x1, y0, z0, xd1, yd0, zd0), xs);
+	float xf10 = Lerp(GradCoord3D<THash>(offset, x0, y1, z0, xd0, yd1, zd0), GradCoord3D<THash>(offset, x1, y1, z0, xd1, yd1, zd0), xs);
+	float xf01 = Lerp(GradCoord3D<THash>(offset, x0, y0, z1, xd0, yd0, zd1), GradCoord3D<THash>(offset, x1, y0, z1, xd1, yd0, zd1), xs);
+	float xf11 = Lerp(GradCoord3D<THash>(offset, x0, y1, z1, xd0, yd1, zd1), GradCoord3D<THash>(offset, x1, y1, z1, xd1, yd1, zd1), xs);
 
-		amp *= FractalGain;
-		sum += (FastAbs(SinglePerlin(m_perm[i], x, y, z)) * 2 - 1) * amp;
-	}
+	float yf0 = Lerp(xf00, xf10, ys);
+	float yf1 = Lerp(xf01, xf11, ys);
 
-	return sum * m_fractalBounding;
+	return Lerp(yf0, yf1, zs);
 }
 
-float UFastNoise::SinglePerlinFractalRigidMulti(float x, float y, float z) const
+float FFastNoiseParams::GetPerlinFractalDerivative3D(float x, float y, float z, FVector& gradient) const
 {
-	float sum = 1 - FastAbs(SinglePerlin(m_perm[0], x, y, z));
-	float amp = 1;
-	int32 i = 0;
-
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
-
-		amp *= FractalGain;
-		sum -= (1 - FastAbs(SinglePerlin(m_perm[i], x, y, z))) * amp;
-	}
+	float noise = SampleNoiseDerivative3D(EFNNoiseType::PerlinFractal, x * Frequency, y * Frequency, z * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
+}
 
-	return sum;
+float FFastNoiseParams::GetPerlinDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	float noise = SampleNoiseDerivative3D(EFNNoiseType::Perlin, x * Frequency, y * Frequency, z * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
 }
 
-float UFastNoise::GetPerlin3D(float x, float y, float z) const
+// Trilinear interpolation of corners indexed x + 2 * y + 4 * z
+static FORCEINLINE float LerpCorners3D(const float* corners, float xs, float ys, float zs)
 {
-	return SinglePerlin(0, x * Frequency, y * Frequency, z * Frequency);
+	return Lerp(Lerp(Lerp(corners[0], corners[1], xs), Lerp(corners[2], corners[3], xs), ys),
+		Lerp(Lerp(corners[4], corners[5], xs), Lerp(corners[6], corners[7], xs), ys), zs);
 }
 
-float UFastNoise::SinglePerlin(uint8 offset, float x, float y, float z) const
+// The slope of each corner's dot product is its gradient vector, interpolated like the dot products,
+// to which the slope of the interpolation weights adds the difference between the corners
+template <typename THash, typename TInterp>
+float FFastNoiseParams::SinglePerlinDerivative(uint8 offset, float x, float y, float z, FVector& gradient) const
 {
 	int32 x0 = FastFloor(x);
 	int32 y0 = FastFloor(y);
 	int32 z0 = FastFloor(z);
-	int32 x1 = x0 + 1;
-	int32 y1 = y0 + 1;
-	int32 z1 = z0 + 1;
 
-	float xs = 0;
-	float ys = 0;
-	float zs = 0;
-	switch (Interpolation)
-	{
-	case EFNInterp::Linear:
-		xs = x - (float)x0;
-		ys = y - (float)y0;
-		zs = z - (float)z0;
-		break;
-	case EFNInterp::Hermite:
-		xs = InterpHermiteFunc(x - (float)x0);
-		ys = InterpHermiteFunc(y - (float)y0);
-		zs = InterpHermiteFunc(z - (float)z0);
-		break;
-	case EFNInterp::Quintic:
-		xs = InterpQuinticFunc(x - (float)x0);
-		ys = InterpQuinticFunc(y - (float)y0);
-		zs = InterpQuinticFunc(z - (float)z0);
-		break;
-	}
+	float xs = TInterp::Apply(x - (float)x0);
+	float ys = TInterp::Apply(y - (float)y0);
+	float zs = TInterp::Apply(z - (float)z0);
+	float dxs = TInterp::Derivative(x - (float)x0);
+	float dys = TInterp::Derivative(y - (float)y0);
+	float dzs = TInterp::Derivative(z - (float)z0);
 
 	float xd0 = x - (float)x0;
 	float yd0 = y - (float)y0;
@@ -904,217 +3858,266 @@ float UFastNoise::SinglePerlin(uint8 offset, float x, float y, float z) const
 	float yd1 = yd0 - 1;
 	float zd1 = zd0 - 1;
 
-	float xf00 = Lerp(GradCoord3D(offset, x0, y0, z0, xd0, yd0, zd0), GradCoord3D(offset, x1, y0, z0, xd1, yd0, zd0), xs);
-	float xf10 = Lerp(GradCoord3D(offset, x0, y1, z0, xd0, yd1, zd0), GradCoord3D(offset, x1, y1, z0, xd1, yd1, zd0), xs);
-	float xf01 = Lerp(GradCoord3D(offset, x0, y0, z1, xd0, yd0, zd1), GradCoord3D(offset, x1, y0, z1, xd1, yd0, zd1), xs);
-	float xf11 = Lerp(GradCoord3D(offset, x0, y1, z1, xd0, yd1, zd1), GradCoord3D(offset, x1, y1, z1, xd1, yd1, zd1), xs);
+	x0 = LatticeX(x0);
+	y0 = LatticeY(y0);
+	z0 = LatticeZ(z0);
+	int32 x1 = x0 + 1;
+	int32 y1 = y0 + 1;
+	int32 z1 = z0 + 1;
+
+	float n[8], xGrad[8], yGrad[8], zGrad[8];
+	n[0] = GradCoord3D<THash>(offset, x0, y0, z0, xd0, yd0, zd0, xGrad[0], yGrad[0], zGrad[0]);
+	n[1] = GradCoord3D<THash>(offset, x1, y0, z0, xd1, yd0, zd0, xGrad[1], yGrad[1], zGrad[1]);
+	n[2] = GradCoord3D<THash>(offset, x0, y1, z0, xd0, yd1, zd0, xGrad[2], yGrad[2], zGrad[2]);
+	n[3] = GradCoord3D<THash>(offset, x1, y1, z0, xd1, yd1, zd0, xGrad[3], yGrad[3], zGrad[3]);
+	n[4] = GradCoord3D<THash>(offset, x0, y0, z1, xd0, yd0, zd1, xGrad[4], yGrad[4], zGrad[4]);
+	n[5] = GradCoord3D<THash>(offset, x1, y0, z1, xd1, yd0, zd1, xGrad[5], yGrad[5], zGrad[5]);
+	n[6] = GradCoord3D<THash>(offset, x0, y1, z1, xd0, yd1, zd1, xGrad[6], yGrad[6], zGrad[6]);
+	n[7] = GradCoord3D<THash>(offset, x1, y1, z1, xd1, yd1, zd1, xGrad[7], yGrad[7], zGrad[7]);
+
+	float xf00 = Lerp(n[0], n[1], xs);
+	float xf10 = Lerp(n[2], n[3], xs);
+	float xf01 = Lerp(n[4], n[5], xs);
+	float xf11 = Lerp(n[6], n[7], xs);
 
 	float yf0 = Lerp(xf00, xf10, ys);
 	float yf1 = Lerp(xf01, xf11, ys);
 
+	gradient.X = LerpCorners3D(xGrad, xs, ys, zs) + dxs * Lerp(Lerp(n[1] - n[0], n[3] - n[2], ys), Lerp(n[5] - n[4], n[7] - n[6], ys), zs);
+	gradient.Y = LerpCorners3D(yGrad, xs, ys, zs) + dys * Lerp(xf10 - xf00, xf11 - xf01, zs);
+	gradient.Z = LerpCorners3D(zGrad, xs, ys, zs) + dzs * (yf1 - yf0);
+
 	return Lerp(yf0, yf1, zs);
 }
 
-float UFastNoise::GetPerlinFractal2D(float x, float y) const
+float FFastNoiseParams::GetPerlinFractal2D(float x, float y) const
 {
-	x *= Frequency;
-	y *= Frequency;
-
-	switch (FractalType)
-	{
-	case EFNFractalType::FBM:
-		return SinglePerlinFractalFBM(x, y);
-	case EFNFractalType::Billow:
-		return SinglePerlinFractalBillow(x, y);
-	case EFNFractalType::RigidMulti:
-		return SinglePerlinFractalRigidMulti(x, y);
-	default:
-		return 0;
-	}
+	return SampleNoise2D(EFNNoiseType::PerlinFractal, x * Frequency, y * Frequency);
 }
 
-float UFastNoise::SinglePerlinFractalFBM(float x, float y) const
+float FFastNoiseParams::GetPerlin2D(float x, float y) const
 {
-	float sum = SinglePerlin(m_perm[0], x, y);
-	float amp = 1;
-	int32 i = 0;
-
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-
-		amp *= FractalGain;
-		sum += SinglePerlin(m_perm[i], x, y) * amp;
-	}
-
-	return sum * m_fractalBounding;
+	return SampleNoise2D(EFNNoiseType::Perlin, x * Frequency, y * Frequency);
 }
 
-float UFastNoise::SinglePerlinFractalBillow(float x, float y) const
+template <typename THash, typename TInterp>
+float FFastNoiseParams::SinglePerlin(uint8 offset, float x, float y) const
 {
-	float sum = FastAbs(SinglePerlin(m_perm[0], x, y)) * 2 - 1;
-	float amp = 1;
-	int32 i = 0;
-
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
+	int32 x0 = FastFloor(x);
+	int32 y0 = FastFloor(y);
 
-		amp *= FractalGain;
-		sum += (FastAbs(SinglePerlin(m_perm[i], x, y)) * 2 - 1) * amp;
-	}
+	float xs = TInterp::Apply(x - (float)x0);
+	float ys = TInterp::Apply(y - (float)y0);
 
-	return sum * m_fractalBounding;
-}
+	float xd0 = x - (float)x0;
+	float yd0 = y - (float)y0;
+	float xd1 = xd0 - 1;
+	float yd1 = yd0 - 1;
 
-float UFastNoise::SinglePerlinFractalRigidMulti(float x, float y) const
-{
-	float sum = 1 - FastAbs(SinglePerlin(m_perm[0], x, y));
-	float amp = 1;
-	int32 i = 0;
+	x0 = LatticeX(x0);
+	y0 = LatticeY(y0);
+	int32 x1 = x0 + 1;
+	int32 y1 = y0 + 1;
 
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
+	float xf0 = Lerp(GradCoord2D<THash>(offset, x0, y0, xd0, yd0), GradCoord2D<THash>(offset, x1, y0, xd1, yd0), xs);
+	float xf1 = Lerp(GradCoord2D<THash>(offset, x0, y1, xd0, yd1), GradCoord2D<THash>(offset, x1, y1, xd1, yd1), xs);
 
-		amp *= FractalGain;
-		sum -= (1 - FastAbs(SinglePerlin(m_perm[i], x, y))) * amp;
-	}
+	return Lerp(xf0, xf1, ys);
+}
 
-	return sum;
+float FFastNoiseParams::GetPerlinFractalDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	float noise = SampleNoiseDerivative2D(EFNNoiseType::PerlinFractal, x * Frequency, y * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
 }
 
-float UFastNoise::GetPerlin2D(float x, float y) const
+float FFastNoiseParams::GetPerlinDerivative2D(float x, float y, FVector2D& gradient) const
 {
-	return SinglePerlin(0, x * Frequency, y * Frequency);
+	float noise = SampleNoiseDerivative2D(EFNNoiseType::Perlin, x * Frequency, y * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
 }
 
-float UFastNoise::SinglePerlin(uint8 offset, float x, float y) const
+template <typename THash, typename TInterp>
+float FFastNoiseParams::SinglePerlinDerivative(uint8 offset, float x, float y, FVector2D& gradient) const
 {
 	int32 x0 = FastFloor(x);
 	int32 y0 = FastFloor(y);
-	int32 x1 = x0 + 1;
-	int32 y1 = y0 + 1;
 
-	float xs = 0;
-	float ys = 0;
-	switch (Interpolation)
-	{
-	case EFNInterp::Linear:
-		xs = x - (float)x0;
-		ys = y - (float)y0;
-		break;
-	case EFNInterp::Hermite:
-		xs = InterpHermiteFunc(x - (float)x0);
-		ys = InterpHermiteFunc(y - (float)y0);
-		break;
-	case EFNInterp::Quintic:
-		xs = InterpQuinticFunc(x - (float)x0);
-		ys = InterpQuinticFunc(y - (float)y0);
-		break;
-	}
+	float xs = TInterp::Apply(x - (float)x0);
+	float ys = TInterp::Apply(y - (float)y0);
+	float dxs = TInterp::Derivative(x - (float)x0);
+	float dys = TInterp::Derivative(y - (float)y0);
 
 	float xd0 = x - (float)x0;
 	float yd0 = y - (float)y0;
 	float xd1 = xd0 - 1;
 	float yd1 = yd0 - 1;
 
-	float xf0 = Lerp(GradCoord2D(offset, x0, y0, xd0, yd0), GradCoord2D(offset, x1, y0, xd1, yd0), xs);
-	float xf1 = Lerp(GradCoord2D(offset, x0, y1, xd0, yd1), GradCoord2D(offset, x1, y1, xd1, yd1), xs);
+	x0 = LatticeX(x0);
+	y0 = LatticeY(y0);
+	int32 x1 = x0 + 1;
+	int32 y1 = y0 + 1;
+
+	float n[4], xGrad[4], yGrad[4];
+	n[0] = GradCoord2D<THash>(offset, x0, y0, xd0, yd0, xGrad[0], yGrad[0]);
+	n[1] = GradCoord2D<THash>(offset, x1, y0, xd1, yd0, xGrad[1], yGrad[1]);
+	n[2] = GradCoord2D<THash>(offset, x0, y1, xd0, yd1, xGrad[2], yGrad[2]);
+	n[3] = GradCoord2D<THash>(offset, x1, y1, xd1, yd1, xGrad[3], yGrad[3]);
+
+	float xf0 = Lerp(n[0], n[1], xs);
+	float xf1 = Lerp(n[2], n[3], xs);
+
+	gradient.X = Lerp(Lerp(xGrad[0], xGrad[1], xs), Lerp(xGrad[2], xGrad[3], xs), ys) + dxs * Lerp(n[1] - n[0], n[3] - n[2], ys);
+	gradient.Y = Lerp(Lerp(yGrad[0], yGrad[1], xs), Lerp(yGrad[2], yGrad[3], xs), ys) + dys * (xf1 - xf0);
 
 	return Lerp(xf0, xf1, ys);
 }
 
 // Simplex Noise
 
-float UFastNoise::GetSimplexFractal3D(float x, float y, float z) const
+float FFastNoiseParams::GetSimplexFractal3D(float x, float y, float z) const
 {
-	x *= Frequency;
-	y *= Frequency;
-	z *= Frequency;
+	return SampleNoise3D(EFNNoiseType::SimplexFractal, x * Frequency, y * Frequency, z * Frequency);
+}
 
-	switch (FractalType)
-	{
-	case EFNFractalType::FBM:
-		return SingleSimplexFractalFBM(x, y, z);
-	case EFNFractalType::Billow:
-		return SingleSimplexFractalBillow(x, y, z);
-	case EFNFractalType::RigidMulti:
-		return SingleSimplexFractalRigidMulti(x, y, z);
-	default:
-		return 0;
-	}
+float FFastNoiseParams::GetSimplex3D(float x, float y, float z) const
+{
+	float noise = 0;
+	DispatchHash(HashType, [&](auto hash) { noise = SingleSimplex<decltype(hash)>(0, x * Frequency, y * Frequency, z * Frequency); });
+	return noise;
 }
 
-float UFastNoise::SingleSimplexFractalFBM(float x, float y, float z) const
+template <typename THash>
+float FFastNoiseParams::SingleSimplex(uint8 offset, float x, float y, float z) const
 {
-	float sum = SingleSimplex(m_perm[0], x, y, z);
-	float amp = 1;
-	int32 i = 0;
+	float t = (x + y + z) * F3;
+	int32 i = FastFloor(x + t);
+	int32 j = FastFloor(y + t);
+	int32 k = FastFloor(z + t);
 
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
+	t = (i + j + k) * G3;
+	float X0 = i - t;
+	float Y0 = j - t;
+	float Z0 = k - t;
 
-		amp *= FractalGain;
-		sum += SingleSimplex(m_perm[i], x, y, z) * amp;
-	}
+	float x0 = x - X0;
+	float y0 = y - Y0;
+	float z0 = z - Z0;
 
-	return sum * m_fractalBounding;
-}
+	i = LatticeX(i);
+	j = LatticeY(j);
+	k = LatticeZ(k);
 
-float UFastNoise::SingleSimplexFractalBillow(float x, float y, float z) const
-{
-	float sum = FastAbs(SingleSimplex(m_perm[0], x, y, z)) * 2 - 1;
-	float amp = 1;
-	int32 i = 0;
+	int32 i1, j1, k1;
+	int32 i2, j2, k2;
 
-	while (++i < FractalOctaves)
+	if (x0 >= y0)
 	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
-
-		amp *= FractalGain;
-		sum += (FastAbs(SingleSimplex(m_perm[i], x, y, z)) * 2 - 1) * amp;
+		if (y0 >= z0)
+		{
+			i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 1; k2 = 0;
+		}
+		else if (x0 >= z0)
+		{
+			i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 0; k2 = 1;
+		}
+		else // x0 < z0
+		{
+			i1 = 0; j1 = 0; k1 = 1; i2 = 1; j2 = 0; k2 = 1;
+		}
+	}
+	else // x0 < y0
+	{
+		if (y0 < z0)
+		{
+			i1 = 0; j1 = 0; k1 = 1; i2 = 0; j2 = 1; k2 = 1;
+		}
+		else if (x0 < z0)
+		{
+			i1 = 0; j1 = 1; k1 = 0; i2 = 0; j2 = 1; k2 = 1;
+		}
+		else // x0 >= z0
+		{
+			i1 = 0; j1 = 1; k1 = 0; i2 = 1; j2 = 1; k2 = 0;
+		}
 	}
 
-	return sum * m_fractalBounding;
-}
+	float x1 = x0 - i1 + G3;
+	float y1 = y0 - j1 + G3;
+	float z1 = z0 - k1 + G3;
+	float x2 = x0 - i2 + 2*G3;
+	float y2 = y0 - j2 + 2*G3;
+	float z2 = z0 - k2 + 2*G3;
+	float x3 = x0 - 1 + 3*G3;
+	float y3 = y0 - 1 + 3*G3;
+	float z3 = z0 - 1 + 3*G3;
 
-float UFastNoise::SingleSimplexFractalRigidMulti(float x, float y, float z) const
-{
-	float sum = 1 - FastAbs(SingleSimplex(m_perm[0], x, y, z));
-	float amp = 1;
-	int32 i = 0;
+	float n0, n1, n2, n3;
 
-	while (++i < FractalOctaves)
+	t = float(0.6) - x0*x0 - y0*y0 - z0*z0;
+	if (t < 0) n0 = 0;
+	else
 	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
+		t *= t;
+		n0 = t*t*GradCoord3D<THash>(offset, i, j, k, x0, y0, z0);
+	}
 
-		amp *= FractalGain;
-		sum -= (1 - FastAbs(SingleSimplex(m_perm[i], x, y, z))) * amp;
+	t = float(0.6) - x1*x1 - y1*y1 - z1*z1;
+	if (t < 0) n1 = 0;
+	else
+	{
+		t *= t;
+		n1 = t*t*GradCoord3D<THash>(offset, i + i1, j + j1, k + k1, x1, y1, z1);
+	}
+
+	t = float(0.6) - x2*x2 - y2*y2 - z2*z2;
+	if (t < 0) n2 = 0;
+	else
+	{
+		t *= t;
+		n2 = t*t*GradCoord3D<THash>(offset, i + i2, j + j2, k + k2, x2, y2, z2);
+	}
+
+	t = float(0.6) - x3*x3 - y3*y3 - z3*z3;
+	if (t < 0) n3 = 0;
+	else
+	{
+		t *= t;
+		n3 = t*t*GradCoord3D<THash>(offset, i + 1, j + 1, k + 1, x3, y3, z3);
 	}
 
-	return sum;
+	return 32 * (n0 + n1 + n2 + n3);
 }
 
-float UFastNoise::GetSimplex3D(float x, float y, float z) const
+float FFastNoiseParams::GetSimplexFractalDerivative3D(float x, float y, float z, FVector& gradient) const
+{
+	float noise = SampleNoiseDerivative3D(EFNNoiseType::SimplexFractal, x * Frequency, y * Frequency, z * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
+}
+
+float FFastNoiseParams::GetSimplexDerivative3D(float x, float y, float z, FVector& gradient) const
 {
-	return SingleSimplex(0, x * Frequency, y * Frequency, z * Frequency);
+	float noise = SampleNoiseDerivative3D(EFNNoiseType::Simplex, x * Frequency, y * Frequency, z * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
 }
 
-static const float F3 = 1 / float(3);
-static const float G3 = 1 / float(6);
+// Adds the gradient of t^4 * dot, the contribution of a corner at offset (xd, yd, zd) with falloff t = r^2 - |offset|^2
+static FORCEINLINE void AddSimplexCornerGradient(float t, float dot, float xGrad, float yGrad, float zGrad, float xd, float yd, float zd, FVector& gradient)
+{
+	float t2 = t * t;
+	float falloffSlope = -8 * t2 * t * dot;
+
+	gradient.X += t2 * t2 * xGrad + falloffSlope * xd;
+	gradient.Y += t2 * t2 * yGrad + falloffSlope * yd;
+	gradient.Z += t2 * t2 * zGrad + falloffSlope * zd;
+}
 
-float UFastNoise::SingleSimplex(uint8 offset, float x, float y, float z) const
+template <typename THash>
+float FFastNoiseParams::SingleSimplexDerivative(uint8 offset, float x, float y, float z, FVector& gradient) const
 {
 	float t = (x + y + z) * F3;
 	int32 i = FastFloor(x + t);
@@ -1130,6 +4133,10 @@ float UFastNoise::SingleSimplex(uint8 offset, float x, float y, float z) const
 	float y0 = y - Y0;
 	float z0 = z - Z0;
 
+	i = LatticeX(i);
+	j = LatticeY(j);
+	k = LatticeZ(k);
+
 	int32 i1, j1, k1;
 	int32 i2, j2, k2;
 
@@ -1175,63 +4182,63 @@ float UFastNoise::SingleSimplex(uint8 offset, float x, float y, float z) const
 	float z3 = z0 - 1 + 3*G3;
 
 	float n0, n1, n2, n3;
+	float xGrad, yGrad, zGrad;
+
+	gradient = FVector::ZeroVector;
 
 	t = float(0.6) - x0*x0 - y0*y0 - z0*z0;
 	if (t < 0) n0 = 0;
 	else
 	{
+		n0 = GradCoord3D<THash>(offset, i, j, k, x0, y0, z0, xGrad, yGrad, zGrad);
+		AddSimplexCornerGradient(t, n0, xGrad, yGrad, zGrad, x0, y0, z0, gradient);
 		t *= t;
-		n0 = t*t*GradCoord3D(offset, i, j, k, x0, y0, z0);
+		n0 *= t*t;
 	}
 
 	t = float(0.6) - x1*x1 - y1*y1 - z1*z1;
 	if (t < 0) n1 = 0;
 	else
 	{
+		n1 = GradCoord3D<THash>(offset, i + i1, j + j1, k + k1, x1, y1, z1, xGrad, yGrad, zGrad);
+		AddSimplexCornerGradient(t, n1, xGrad, yGrad, zGrad, x1, y1, z1, gradient);
 		t *= t;
-		n1 = t*t*GradCoord3D(offset, i + i1, j + j1, k + k1, x1, y1, z1);
+		n1 *= t*t;
 	}
 
 	t = float(0.6) - x2*x2 - y2*y2 - z2*z2;
 	if (t < 0) n2 = 0;
 	else
 	{
+		n2 = GradCoord3D<THash>(offset, i + i2, j + j2, k + k2, x2, y2, z2, xGrad, yGrad, zGrad);
+		AddSimplexCornerGradient(t, n2, xGrad, yGrad, zGrad, x2, y2, z2, gradient);
 		t *= t;
-		n2 = t*t*GradCoord3D(offset, i + i2, j + j2, k + k2, x2, y2, z2);
+		n2 *= t*t;
 	}
 
 	t = float(0.6) - x3*x3 - y3*y3 - z3*z3;
 	if (t < 0) n3 = 0;
 	else
 	{
+		n3 = GradCoord3D<THash>(offset, i + 1, j + 1, k + 1, x3, y3, z3, xGrad, yGrad, zGrad);
+		AddSimplexCornerGradient(t, n3, xGrad, yGrad, zGrad, x3, y3, z3, gradient);
 		t *= t;
-		n3 = t*t*GradCoord3D(offset, i + 1, j + 1, k + 1, x3, y3, z3);
+		n3 *= t*t;
 	}
 
+	gradient *= 32;
 	return 32 * (n0 + n1 + n2 + n3);
 }
 
-float UFastNoise::GetSimplexFractal2D(float x, float y) const
+float FFastNoiseParams::GetSimplexFractal2D(float x, float y) const
 {
-	x *= Frequency;
-	y *= Frequency;
-
-	switch (FractalType)
-	{
-	case EFNFractalType::FBM:
-		return SingleSimplexFractalFBM(x, y);
-	case EFNFractalType::Billow:
-		return SingleSimplexFractalBillow(x, y);
-	case EFNFractalType::RigidMulti:
-		return SingleSimplexFractalRigidMulti(x, y);
-	default:
-		return 0;
-	}
+	return SampleNoise2D(EFNNoiseType::SimplexFractal, x * Frequency, y * Frequency);
 }
 
-float UFastNoise::SingleSimplexFractalFBM(float x, float y) const
+template <typename THash>
+float FFastNoiseParams::SingleSimplexFractalBlend(float x, float y) const
 {
-	float sum = SingleSimplex(m_perm[0], x, y);
+	float sum = SingleSimplex<THash>(OctaveOffset(0), x, y);
 	float amp = 1;
 	int32 i = 0;
 
@@ -1241,79 +4248,107 @@ float UFastNoise::SingleSimplexFractalFBM(float x, float y) const
 		y *= FractalLacunarity;
 
 		amp *= FractalGain;
-		sum += SingleSimplex(m_perm[i], x, y) * amp;
+		if (i == FractalOctaves - 1)
+			amp *= FractalFade;
+		sum *= SingleSimplex<THash>(OctaveOffset(i), x, y) * amp + 1;
 	}
 
-	return sum * m_fractalBounding;
+	return sum * FractalBounding;
 }
 
-float UFastNoise::SingleSimplexFractalBillow(float x, float y) const
+float FFastNoiseParams::GetSimplex2D(float x, float y) const
 {
-	float sum = FastAbs(SingleSimplex(m_perm[0], x, y)) * 2 - 1;
-	float amp = 1;
-	int32 i = 0;
+	float noise = 0;
+	DispatchHash(HashType, [&](auto hash) { noise = SingleSimplex<decltype(hash)>(0, x * Frequency, y * Frequency); });
+	return noise;
+}
 
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
+template <typename THash>
+float FFastNoiseParams::SingleSimplex(uint8 offset, float x, float y) const
+{
+	float t = (x + y) * F2;
+	int32 i = FastFloor(x + t);
+	int32 j = FastFloor(y + t);
 
-		amp *= FractalGain;
-		sum += (FastAbs(SingleSimplex(m_perm[i], x, y)) * 2 - 1) * amp;
-	}
+	t = (i + j) * G2;
+	float X0 = i - t;
+	float Y0 = j - t;
 
-	return sum * m_fractalBounding;
-}
+	float x0 = x - X0;
+	float y0 = y - Y0;
 
-float UFastNoise::SingleSimplexFractalRigidMulti(float x, float y) const
-{
-	float sum = 1 - FastAbs(SingleSimplex(m_perm[0], x, y));
-	float amp = 1;
-	int32 i = 0;
+	i = LatticeX(i);
+	j = LatticeY(j);
 
-	while (++i < FractalOctaves)
+	int32 i1, j1;
+	if (x0 > y0)
 	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-
-		amp *= FractalGain;
-		sum -= (1 - FastAbs(SingleSimplex(m_perm[i], x, y))) * amp;
+		i1 = 1; j1 = 0;
+	}
+	else
+	{
+		i1 = 0; j1 = 1;
 	}
 
-	return sum;
-}
+	float x1 = x0 - (float)i1 + G2;
+	float y1 = y0 - (float)j1 + G2;
+	float x2 = x0 - 1 + 2*G2;
+	float y2 = y0 - 1 + 2*G2;
 
-float UFastNoise::SingleSimplexFractalBlend(float x, float y) const
-{
-	float sum = SingleSimplex(m_perm[0], x, y);
-	float amp = 1;
-	int32 i = 0;
+	float n0, n1, n2;
 
-	while (++i < FractalOctaves)
+	t = float(0.5) - x0*x0 - y0*y0;
+	if (t < 0) n0 = 0;
+	else
 	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
+		t *= t;
+		n0 = t * t * GradCoord2D<THash>(offset, i, j, x0, y0);
+	}
 
-		amp *= FractalGain;
-		sum *= SingleSimplex(m_perm[i], x, y) * amp + 1;
+	t = float(0.5) - x1*x1 - y1*y1;
+	if (t < 0) n1 = 0;
+	else
+	{
+		t *= t;
+		n1 = t*t*GradCoord2D<THash>(offset, i + i1, j + j1, x1, y1);
+	}
+
+	t = float(0.5) - x2*x2 - y2*y2;
+	if (t < 0) n2 = 0;
+	else
+	{
+		t *= t;
+		n2 = t*t*GradCoord2D<THash>(offset, i + 1, j + 1, x2, y2);
 	}
 
-	return sum * m_fractalBounding;
+	return 70 * (n0 + n1 + n2);
+}
+
+float FFastNoiseParams::GetSimplexFractalDerivative2D(float x, float y, FVector2D& gradient) const
+{
+	float noise = SampleNoiseDerivative2D(EFNNoiseType::SimplexFractal, x * Frequency, y * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
 }
 
-float UFastNoise::GetSimplex2D(float x, float y) const
+float FFastNoiseParams::GetSimplexDerivative2D(float x, float y, FVector2D& gradient) const
 {
-	return SingleSimplex(0, x * Frequency, y * Frequency);
+	float noise = SampleNoiseDerivative2D(EFNNoiseType::Simplex, x * Frequency, y * Frequency, gradient);
+	gradient *= Frequency;
+	return noise;
 }
 
-//static const float F2 = 1 / float(2);
-//static const float G2 = 1 / float(4);
+static FORCEINLINE void AddSimplexCornerGradient(float t, float dot, float xGrad, float yGrad, float xd, float yd, FVector2D& gradient)
+{
+	float t2 = t * t;
+	float falloffSlope = -8 * t2 * t * dot;
 
-static const float SQRT3 = float(1.7320508075688772935274463415059);
-static const float F2 = float(0.5) * (SQRT3 - float(1.0));
-static const float G2 = (float(3.0) - SQRT3) / float(6.0);
+	gradient.X += t2 * t2 * xGrad + falloffSlope * xd;
+	gradient.Y += t2 * t2 * yGrad + falloffSlope * yd;
+}
 
-float UFastNoise::SingleSimplex(uint8 offset, float x, float y) const
+template <typename THash>
+float FFastNoiseParams::SingleSimplexDerivative(uint8 offset, float x, float y, FVector2D& gradient) const
 {
 	float t = (x + y) * F2;
 	int32 i = FastFloor(x + t);
@@ -1326,6 +4361,9 @@ float UFastNoise::SingleSimplex(uint8 offset, float x, float y) const
 	float x0 = x - X0;
 	float y0 = y - Y0;
 
+	i = LatticeX(i);
+	j = LatticeY(j);
+
 	int32 i1, j1;
 	if (x0 > y0)
 	{
@@ -1342,37 +4380,49 @@ float UFastNoise::SingleSimplex(uint8 offset, float x, float y) const
 	float y2 = y0 - 1 + 2*G2;
 
 	float n0, n1, n2;
+	float xGrad, yGrad;
+
+	gradient = FVector2D::ZeroVector;
 
 	t = float(0.5) - x0*x0 - y0*y0;
 	if (t < 0) n0 = 0;
 	else
 	{
+		n0 = GradCoord2D<THash>(offset, i, j, x0, y0, xGrad, yGrad);
+		AddSimplexCornerGradient(t, n0, xGrad, yGrad, x0, y0, gradient);
 		t *= t;
-		n0 = t * t * GradCoord2D(offset, i, j, x0, y0);
+		n0 *= t*t;
 	}
 
 	t = float(0.5) - x1*x1 - y1*y1;
 	if (t < 0) n1 = 0;
 	else
 	{
+		n1 = GradCoord2D<THash>(offset, i + i1, j + j1, x1, y1, xGrad, yGrad);
+		AddSimplexCornerGradient(t, n1, xGrad, yGrad, x1, y1, gradient);
 		t *= t;
-		n1 = t*t*GradCoord2D(offset, i + i1, j + j1, x1, y1);
+		n1 *= t*t;
 	}
 
 	t = float(0.5) - x2*x2 - y2*y2;
 	if (t < 0) n2 = 0;
 	else
 	{
+		n2 = GradCoord2D<THash>(offset, i + 1, j + 1, x2, y2, xGrad, yGrad);
+		AddSimplexCornerGradient(t, n2, xGrad, yGrad, x2, y2, gradient);
 		t *= t;
-		n2 = t*t*GradCoord2D(offset, i + 1, j + 1, x2, y2);
+		n2 *= t*t;
 	}
 
+	gradient *= 70;
 	return 70 * (n0 + n1 + n2);
 }
 
-float UFastNoise::GetSimplex4D(float x, float y, float z, float w) const
+float FFastNoiseParams::GetSimplex4D(float x, float y, float z, float w) const
 {
-	return SingleSimplex(0, x * Frequency, y * Frequency, z * Frequency, w * Frequency);
+	float noise = 0;
+	DispatchHash(HashType, [&](auto hash) { noise = SingleSimplex<decltype(hash)>(0, x * Frequency, y * Frequency, z * Frequency, w * Frequency); });
+	return noise;
 }
 
 static const uint8 SIMPLEX_4D[] =
@@ -1390,7 +4440,8 @@ static const uint8 SIMPLEX_4D[] =
 static const float F4 = (sqrt(float(5)) - 1) / 4;
 static const float G4 = (5 - sqrt(float(5))) / 20;
 
-float UFastNoise::SingleSimplex(uint8 offset, float x, float y, float z, float w) const
+template <typename THash>
+float FFastNoiseParams::SingleSimplex(uint8 offset, float x, float y, float z, float w) const
 {
 	float n0, n1, n2, n3, n4;
 	float t = (x + y + z + w) * F4;
@@ -1450,126 +4501,65 @@ float UFastNoise::SingleSimplex(uint8 offset, float x, float y, float z, float w
 	if (t < 0) n0 = 0;
 	else {
 		t *= t;
-		n0 = t * t * GradCoord4D(offset, i, j, k, l, x0, y0, z0, w0);
+		n0 = t * t * GradCoord4D<THash>(offset, i, j, k, l, x0, y0, z0, w0);
 	}
 	t = float(0.6) - x1*x1 - y1*y1 - z1*z1 - w1*w1;
 	if (t < 0) n1 = 0;
 	else {
 		t *= t;
-		n1 = t * t * GradCoord4D(offset, i + i1, j + j1, k + k1, l + l1, x1, y1, z1, w1);
+		n1 = t * t * GradCoord4D<THash>(offset, i + i1, j + j1, k + k1, l + l1, x1, y1, z1, w1);
 	}
 	t = float(0.6) - x2*x2 - y2*y2 - z2*z2 - w2*w2;
 	if (t < 0) n2 = 0;
 	else {
-		t *= t;
-		n2 = t * t * GradCoord4D(offset, i + i2, j + j2, k + k2, l + l2, x2, y2, z2, w2);
-	}
-	t = float(0.6) - x3*x3 - y3*y3 - z3*z3 - w3*w3;
-	if (t < 0) n3 = 0;
-	else {
-		t *= t;
-		n3 = t * t * GradCoord4D(offset, i + i3, j + j3, k + k3, l + l3, x3, y3, z3, w3);
-	}
-	t = float(0.6) - x4*x4 - y4*y4 - z4*z4 - w4*w4;
-	if (t < 0) n4 = 0;
-	else {
-		t *= t;
-		n4 = t * t * GradCoord4D(offset, i + 1, j + 1, k + 1, l + 1, x4, y4, z4, w4);
-	}
-
-	return 27 * (n0 + n1 + n2 + n3 + n4);
-}
-
-// Cubic Noise
-float UFastNoise::GetCubicFractal3D(float x, float y, float z) const
-{
-	x *= Frequency;
-	y *= Frequency;
-	z *= Frequency;
-
-	switch (FractalType)
-	{
-	case EFNFractalType::FBM:
-		return SingleCubicFractalFBM(x, y, z);
-	case EFNFractalType::Billow:
-		return SingleCubicFractalBillow(x, y, z);
-	case EFNFractalType::RigidMulti:
-		return SingleCubicFractalRigidMulti(x, y, z);
-	default:
-		return 0;
-	}
-}
-
-float UFastNoise::SingleCubicFractalFBM(float x, float y, float z) const
-{
-	float sum = SingleCubic(m_perm[0], x, y, z);
-	float amp = 1;
-	int32 i = 0;
-
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
-
-		amp *= FractalGain;
-		sum += SingleCubic(m_perm[i], x, y, z) * amp;
+		t *= t;
+		n2 = t * t * GradCoord4D<THash>(offset, i + i2, j + j2, k + k2, l + l2, x2, y2, z2, w2);
 	}
-
-	return sum * m_fractalBounding;
-}
-
-float UFastNoise::SingleCubicFractalBillow(float x, float y, float z) const
-{
-	float sum = FastAbs(SingleCubic(m_perm[0], x, y, z)) * 2 - 1;
-	float amp = 1;
-	int32 i = 0;
-
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
-
-		amp *= FractalGain;
-		sum += (FastAbs(SingleCubic(m_perm[i], x, y, z)) * 2 - 1) * amp;
+	t = float(0.6) - x3*x3 - y3*y3 - z3*z3 - w3*w3;
+	if (t < 0) n3 = 0;
+	else {
+		t *= t;
+		n3 = t * t * GradCoord4D<THash>(offset, i + i3, j + j3, k + k3, l + l3, x3, y3, z3, w3);
+	}
+	t = float(0.6) - x4*x4 - y4*y4 - z4*z4 - w4*w4;
+	if (t < 0) n4 = 0;
+	else {
+		t *= t;
+		n4 = t * t * GradCoord4D<THash>(offset, i + 1, j + 1, k + 1, l + 1, x4, y4, z4, w4);
 	}
 
-	return sum * m_fractalBounding;
+	return 27 * (n0 + n1 + n2 + n3 + n4);
 }
 
-float UFastNoise::SingleCubicFractalRigidMulti(float x, float y, float z) const
+// Cubic Noise
+float FFastNoiseParams::GetCubicFractal3D(float x, float y, float z) const
 {
-	float sum = 1 - FastAbs(SingleCubic(m_perm[0], x, y, z));
-	float amp = 1;
-	int32 i = 0;
-
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-		z *= FractalLacunarity;
-
-		amp *= FractalGain;
-		sum -= (1 - FastAbs(SingleCubic(m_perm[i], x, y, z))) * amp;
-	}
-
-	return sum;
+	return SampleNoise3D(EFNNoiseType::CubicFractal, x * Frequency, y * Frequency, z * Frequency);
 }
 
-float UFastNoise::GetCubic3D(float x, float y, float z) const
+float FFastNoiseParams::GetCubic3D(float x, float y, float z) const
 {
-	return SingleCubic(0, x * Frequency, y * Frequency, z * Frequency);
+	float noise = 0;
+	DispatchHash(HashType, [&](auto hash) { noise = SingleCubic<decltype(hash)>(0, x * Frequency, y * Frequency, z * Frequency); });
+	return noise;
 }
 
 const float CUBIC_3D_BOUNDING = 1 / (float(1.5) * float(1.5) * float(1.5));
 
-float UFastNoise::SingleCubic(uint8 offset, float x, float y, float z) const
+template <typename THash>
+float FFastNoiseParams::SingleCubic(uint8 offset, float x, float y, float z) const
 {
 	int32 x1 = FastFloor(x);
 	int32 y1 = FastFloor(y);
 	int32 z1 = FastFloor(z);
 
+	float xs = x - (float)x1;
+	float ys = y - (float)y1;
+	float zs = z - (float)z1;
+
+	x1 = LatticeX(x1);
+	y1 = LatticeY(y1);
+	z1 = LatticeZ(z1);
 	int32 x0 = x1 - 1;
 	int32 y0 = y1 - 1;
 	int32 z0 = z1 - 1;
@@ -1580,478 +4570,742 @@ float UFastNoise::SingleCubic(uint8 offset, float x, float y, float z) const
 	int32 y3 = y1 + 2;
 	int32 z3 = z1 + 2;
 
-	float xs = x - (float)x1;
-	float ys = y - (float)y1;
-	float zs = z - (float)z1;
-
 	return CubicLerp(
 		CubicLerp(
-		CubicLerp(ValCoord3DFast(offset, x0, y0, z0), ValCoord3DFast(offset, x1, y0, z0), ValCoord3DFast(offset, x2, y0, z0), ValCoord3DFast(offset, x3, y0, z0), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y1, z0), ValCoord3DFast(offset, x1, y1, z0), ValCoord3DFast(offset, x2, y1, z0), ValCoord3DFast(offset, x3, y1, z0), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y2, z0), ValCoord3DFast(offset, x1, y2, z0), ValCoord3DFast(offset, x2, y2, z0), ValCoord3DFast(offset, x3, y2, z0), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y3, z0), ValCoord3DFast(offset, x1, y3, z0), ValCoord3DFast(offset, x2, y3, z0), ValCoord3DFast(offset, x3, y3, z0), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y0, z0), ValCoord3DFast<THash>(offset, x1, y0, z0), ValCoord3DFast<THash>(offset, x2, y0, z0), ValCoord3DFast<THash>(offset, x3, y0, z0), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y1, z0), ValCoord3DFast<THash>(offset, x1, y1, z0), ValCoord3DFast<THash>(offset, x2, y1, z0), ValCoord3DFast<THash>(offset, x3, y1, z0), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y2, z0), ValCoord3DFast<THash>(offset, x1, y2, z0), ValCoord3DFast<THash>(offset, x2, y2, z0), ValCoord3DFast<THash>(offset, x3, y2, z0), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y3, z0), ValCoord3DFast<THash>(offset, x1, y3, z0), ValCoord3DFast<THash>(offset, x2, y3, z0), ValCoord3DFast<THash>(offset, x3, y3, z0), xs),
 		ys),
 		CubicLerp(
-		CubicLerp(ValCoord3DFast(offset, x0, y0, z1), ValCoord3DFast(offset, x1, y0, z1), ValCoord3DFast(offset, x2, y0, z1), ValCoord3DFast(offset, x3, y0, z1), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y1, z1), ValCoord3DFast(offset, x1, y1, z1), ValCoord3DFast(offset, x2, y1, z1), ValCoord3DFast(offset, x3, y1, z1), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y2, z1), ValCoord3DFast(offset, x1, y2, z1), ValCoord3DFast(offset, x2, y2, z1), ValCoord3DFast(offset, x3, y2, z1), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y3, z1), ValCoord3DFast(offset, x1, y3, z1), ValCoord3DFast(offset, x2, y3, z1), ValCoord3DFast(offset, x3, y3, z1), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y0, z1), ValCoord3DFast<THash>(offset, x1, y0, z1), ValCoord3DFast<THash>(offset, x2, y0, z1), ValCoord3DFast<THash>(offset, x3, y0, z1), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y1, z1), ValCoord3DFast<THash>(offset, x1, y1, z1), ValCoord3DFast<THash>(offset, x2, y1, z1), ValCoord3DFast<THash>(offset, x3, y1, z1), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y2, z1), ValCoord3DFast<THash>(offset, x1, y2, z1), ValCoord3DFast<THash>(offset, x2, y2, z1), ValCoord3DFast<THash>(offset, x3, y2, z1), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y3, z1), ValCoord3DFast<THash>(offset, x1, y3, z1), ValCoord3DFast<THash>(offset, x2, y3, z1), ValCoord3DFast<THash>(offset, x3, y3, z1), xs),
 		ys),
 		CubicLerp(
-		CubicLerp(ValCoord3DFast(offset, x0, y0, z2), ValCoord3DFast(offset, x1, y0, z2), ValCoord3DFast(offset, x2, y0, z2), ValCoord3DFast(offset, x3, y0, z2), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y1, z2), ValCoord3DFast(offset, x1, y1, z2), ValCoord3DFast(offset, x2, y1, z2), ValCoord3DFast(offset, x3, y1, z2), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y2, z2), ValCoord3DFast(offset, x1, y2, z2), ValCoord3DFast(offset, x2, y2, z2), ValCoord3DFast(offset, x3, y2, z2), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y3, z2), ValCoord3DFast(offset, x1, y3, z2), ValCoord3DFast(offset, x2, y3, z2), ValCoord3DFast(offset, x3, y3, z2), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y0, z2), ValCoord3DFast<THash>(offset, x1, y0, z2), ValCoord3DFast<THash>(offset, x2, y0, z2), ValCoord3DFast<THash>(offset, x3, y0, z2), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y1, z2), ValCoord3DFast<THash>(offset, x1, y1, z2), ValCoord3DFast<THash>(offset, x2, y1, z2), ValCoord3DFast<THash>(offset, x3, y1, z2), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y2, z2), ValCoord3DFast<THash>(offset, x1, y2, z2), ValCoord3DFast<THash>(offset, x2, y2, z2), ValCoord3DFast<THash>(offset, x3, y2, z2), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y3, z2), ValCoord3DFast<THash>(offset, x1, y3, z2), ValCoord3DFast<THash>(offset, x2, y3, z2), ValCoord3DFast<THash>(offset, x3, y3, z2), xs),
 		ys),
 		CubicLerp(
-		CubicLerp(ValCoord3DFast(offset, x0, y0, z3), ValCoord3DFast(offset, x1, y0, z3), ValCoord3DFast(offset, x2, y0, z3), ValCoord3DFast(offset, x3, y0, z3), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y1, z3), ValCoord3DFast(offset, x1, y1, z3), ValCoord3DFast(offset, x2, y1, z3), ValCoord3DFast(offset, x3, y1, z3), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y2, z3), ValCoord3DFast(offset, x1, y2, z3), ValCoord3DFast(offset, x2, y2, z3), ValCoord3DFast(offset, x3, y2, z3), xs),
-		CubicLerp(ValCoord3DFast(offset, x0, y3, z3), ValCoord3DFast(offset, x1, y3, z3), ValCoord3DFast(offset, x2, y3, z3), ValCoord3DFast(offset, x3, y3, z3), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y0, z3), ValCoord3DFast<THash>(offset, x1, y0, z3), ValCoord3DFast<THash>(offset, x2, y0, z3), ValCoord3DFast<THash>(offset, x3, y0, z3), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y1, z3), ValCoord3DFast<THash>(offset, x1, y1, z3), ValCoord3DFast<THash>(offset, x2, y1, z3), ValCoord3DFast<THash>(offset, x3, y1, z3), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y2, z3), ValCoord3DFast<THash>(offset, x1, y2, z3), ValCoord3DFast<THash>(offset, x2, y2, z3), ValCoord3DFast<THash>(offset, x3, y2, z3), xs),
+		CubicLerp(ValCoord3DFast<THash>(offset, x0, y3, z3), ValCoord3DFast<THash>(offset, x1, y3, z3), ValCoord3DFast<THash>(offset, x2, y3, z3), ValCoord3DFast<THash>(offset, x3, y3, z3), xs),
 		ys),
 		zs) * CUBIC_3D_BOUNDING;
 }
 
 
-float UFastNoise::GetCubicFractal2D(float x, float y) const
+float FFastNoiseParams::GetCubicFractal2D(float x, float y) const
+{
+	return SampleNoise2D(EFNNoiseType::CubicFractal, x * Frequency, y * Frequency);
+}
+
+float FFastNoiseParams::GetCubic2D(float x, float y) const
 {
 	x *= Frequency;
 	y *= Frequency;
 
-	switch (FractalType)
-	{
-	case EFNFractalType::FBM:
-		return SingleCubicFractalFBM(x, y);
-	case EFNFractalType::Billow:
-		return SingleCubicFractalBillow(x, y);
-	case EFNFractalType::RigidMulti:
-		return SingleCubicFractalRigidMulti(x, y);
-	default:
-		return 0;
-	}
+	float noise = 0;
+	DispatchHash(HashType, [&](auto hash) { noise = SingleCubic<decltype(hash)>(0, x, y); });
+	return noise;
 }
 
-float UFastNoise::SingleCubicFractalFBM(float x, float y) const
+const float CUBIC_2D_BOUNDING = 1 / (float(1.5) * float(1.5));
+
+template <typename THash>
+float FFastNoiseParams::SingleCubic(uint8 offset, float x, float y) const
 {
-	float sum = SingleCubic(m_perm[0], x, y);
-	float amp = 1;
-	int32 i = 0;
+	int32 x1 = FastFloor(x);
+	int32 y1 = FastFloor(y);
 
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
+	float xs = x - (float)x1;
+	float ys = y - (float)y1;
 
-		amp *= FractalGain;
-		sum += SingleCubic(m_perm[i], x, y) * amp;
-	}
+	x1 = LatticeX(x1);
+	y1 = LatticeY(y1);
+	int32 x0 = x1 - 1;
+	int32 y0 = y1 - 1;
+	int32 x2 = x1 + 1;
+	int32 y2 = y1 + 1;
+	int32 x3 = x1 + 2;
+	int32 y3 = y1 + 2;
 
-	return sum * m_fractalBounding;
+	return CubicLerp(
+		CubicLerp(ValCoord2DFast<THash>(offset, x0, y0), ValCoord2DFast<THash>(offset, x1, y0), ValCoord2DFast<THash>(offset, x2, y0), ValCoord2DFast<THash>(offset, x3, y0), xs),
+		CubicLerp(ValCoord2DFast<THash>(offset, x0, y1), ValCoord2DFast<THash>(offset, x1, y1), ValCoord2DFast<THash>(offset, x2, y1), ValCoord2DFast<THash>(offset, x3, y1), xs),
+		CubicLerp(ValCoord2DFast<THash>(offset, x0, y2), ValCoord2DFast<THash>(offset, x1, y2), ValCoord2DFast<THash>(offset, x2, y2), ValCoord2DFast<THash>(offset, x3, y2), xs),
+		CubicLerp(ValCoord2DFast<THash>(offset, x0, y3), ValCoord2DFast<THash>(offset, x1, y3), ValCoord2DFast<THash>(offset, x2, y3), ValCoord2DFast<THash>(offset, x3, y3), xs),
+		ys) * CUBIC_2D_BOUNDING;
 }
 
-float UFastNoise::SingleCubicFractalBillow(float x, float y) const
+// Lattice Grid Walker
+// Lattice cell of one axis coordinate, its interpolation weight and the offsets from the cell's two corners
+struct FLatticeAxis
 {
-	float sum = FastAbs(SingleCubic(m_perm[0], x, y)) * 2 - 1;
-	float amp = 1;
-	int32 i = 0;
-
-	while (++i < FractalOctaves)
-	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-
-		amp *= FractalGain;
-		sum += (FastAbs(SingleCubic(m_perm[i], x, y)) * 2 - 1) * amp;
-	}
+	int32 Cell;
+	float Weight;
+	float Offset0;
+	float Offset1;
+};
 
-	return sum * m_fractalBounding;
+// The same operations SingleValue, SinglePerlin and SingleCubic (with FInterpLinear) apply to each coordinate
+template <typename TInterp>
+static FORCEINLINE FLatticeAxis LatticeAxis(float coord)
+{
+	FLatticeAxis axis;
+	axis.Cell = FastFloor(coord);
+	axis.Offset0 = coord - (float)axis.Cell;
+	axis.Offset1 = axis.Offset0 - 1;
+	axis.Weight = TInterp::Apply(axis.Offset0);
+	return axis;
 }
 
-float UFastNoise::SingleCubicFractalRigidMulti(float x, float y) const
+// Fills a grid row by row, a row hashes the Corners corners of every lattice column it crosses once, from Before columns ahead of its first cell
+// to After columns past its last, and reuses them until it enters another lattice cell along y (and z)
+// column(corners, x, y[, z]) hashes column x for the cells y (and z), sample(corners, x, y[, z]) interpolates a cell from the corners of its first column on
+template <int32 Before, int32 After, int32 Corners, typename TCorner, typename FAxisFunc, typename FColumnFunc, typename FSampleFunc>
+static bool WalkLatticeGrid2D(float* out, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize, FAxisFunc axisFunc, FColumnFunc column, FSampleFunc sample)
 {
-	float sum = 1 - FastAbs(SingleCubic(m_perm[0], x, y));
-	float amp = 1;
-	int32 i = 0;
+	TArray<FLatticeAxis> xAxes;
+	xAxes.SetNumUninitialized(xSize);
+	int32 xMin = MAX_int32;
+	int32 xMax = MIN_int32;
 
-	while (++i < FractalOctaves)
+	for (int32 x = 0; x < xSize; x++)
 	{
-		x *= FractalLacunarity;
-		y *= FractalLacunarity;
-
-		amp *= FractalGain;
-		sum -= (1 - FastAbs(SingleCubic(m_perm[i], x, y))) * amp;
+		xAxes[x] = axisFunc(xCoords[x]);
+		xMin = FMath::Min(xMin, xAxes[x].Cell);
+		xMax = FMath::Max(xMax, xAxes[x].Cell);
 	}
 
-	return sum;
-}
+	// Once samples are more than a cell apart there is nothing to reuse
+	if ((int64)xMax - xMin >= xSize)
+		return false;
 
-float UFastNoise::GetCubic2D(float x, float y) const
-{
-	x *= Frequency;
-	y *= Frequency;
+	const int32 columnCount = xMax - xMin + 1 + Before + After;
+	TArray<TCorner> columns;
+	columns.SetNumUninitialized(columnCount * Corners);
+	TCorner* corners = columns.GetData();
 
-	return SingleCubic(0, x, y);
-}
+	int32 index = 0;
+	int32 yCell = 0;
+	bool bHashed = false;
 
-const float CUBIC_2D_BOUNDING = 1 / (float(1.5) * float(1.5));
+	for (int32 y = 0; y < ySize; y++)
+	{
+		FLatticeAxis yAxis = axisFunc(yCoords[y]);
 
-float UFastNoise::SingleCubic(uint8 offset, float x, float y) const
-{
-	int32 x1 = FastFloor(x);
-	int32 y1 = FastFloor(y);
+		if (!bHashed || yAxis.Cell != yCell)
+		{
+			for (int32 i = 0; i < columnCount; i++)
+				column(corners + i * Corners, (int32)((uint32)xMin - Before + i), yAxis.Cell);
 
-	int32 x0 = x1 - 1;
-	int32 y0 = y1 - 1;
-	int32 x2 = x1 + 1;
-	int32 y2 = y1 + 1;
-	int32 x3 = x1 + 2;
-	int32 y3 = y1 + 2;
+			yCell = yAxis.Cell;
+			bHashed = true;
+		}
 
-	float xs = x - (float)x1;
-	float ys = y - (float)y1;
+		for (int32 x = 0; x < xSize; x++)
+			out[index++] = sample(corners + (xAxes[x].Cell - xMin) * Corners, xAxes[x], yAxis);
+	}
 
-	return CubicLerp(
-		CubicLerp(ValCoord2DFast(offset, x0, y0), ValCoord2DFast(offset, x1, y0), ValCoord2DFast(offset, x2, y0), ValCoord2DFast(offset, x3, y0), xs),
-		CubicLerp(ValCoord2DFast(offset, x0, y1), ValCoord2DFast(offset, x1, y1), ValCoord2DFast(offset, x2, y1), ValCoord2DFast(offset, x3, y1), xs),
-		CubicLerp(ValCoord2DFast(offset, x0, y2), ValCoord2DFast(offset, x1, y2), ValCoord2DFast(offset, x2, y2), ValCoord2DFast(offset, x3, y2), xs),
-		CubicLerp(ValCoord2DFast(offset, x0, y3), ValCoord2DFast(offset, x1, y3), ValCoord2DFast(offset, x2, y3), ValCoord2DFast(offset, x3, y3), xs),
-		ys) * CUBIC_2D_BOUNDING;
+	return true;
 }
 
-// Cellular Noise
-float UFastNoise::GetCellular3D(float x, float y, float z) const
+template <int32 Before, int32 After, int32 Corners, typename TCorner, typename FAxisFunc, typename FColumnFunc, typename FSampleFunc>
+static bool WalkLatticeGrid3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize, FAxisFunc axisFunc, FColumnFunc column, FSampleFunc sample)
 {
-	x *= Frequency;
-	y *= Frequency;
-	z *= Frequency;
+	TArray<FLatticeAxis> xAxes;
+	xAxes.SetNumUninitialized(xSize);
+	int32 xMin = MAX_int32;
+	int32 xMax = MIN_int32;
 
-	switch (CellularReturnType)
+	for (int32 x = 0; x < xSize; x++)
 	{
-	case EFNCellularReturnType::CellValue:
-	case EFNCellularReturnType::NoiseLookup:
-	case EFNCellularReturnType::Distance:
-		return SingleCellular(x, y, z);
-	default:
-		return SingleCellular2Edge(x, y, z);
+		xAxes[x] = axisFunc(xCoords[x]);
+		xMin = FMath::Min(xMin, xAxes[x].Cell);
+		xMax = FMath::Max(xMax, xAxes[x].Cell);
 	}
-}
 
-float UFastNoise::SingleCellular(float x, float y, float z) const
-{
-	int32 xr = FastRound(x);
-	int32 yr = FastRound(y);
-	int32 zr = FastRound(z);
+	if ((int64)xMax - xMin >= xSize)
+		return false;
 
-	float distance = 999999;
+	const int32 columnCount = xMax - xMin + 1 + Before + After;
+	TArray<TCorner> columns;
+	columns.SetNumUninitialized(columnCount * Corners);
+	TCorner* corners = columns.GetData();
 
-	int32 xc = 0;
-	int32 yc = 0;
-	int32 zc = 0;
+	int32 index = 0;
+	int32 yCell = 0;
+	int32 zCell = 0;
+	bool bHashed = false;
 
-	switch (CellularDistanceFunction)
+	for (int32 z = 0; z < zSize; z++)
 	{
-	case EFNCellularDistanceFunction::Euclidean:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
-		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
-			{
-				for (int32 zi = zr - 1; zi <= zr + 1; zi++)
-				{
-					uint8 lutPos = Index3D_256(0, xi, yi, zi);
+		FLatticeAxis zAxis = axisFunc(zCoords[z]);
 
-					float vecX = xi - x + CELL_3D_X[lutPos] * CellularJitter;
-					float vecY = yi - y + CELL_3D_Y[lutPos] * CellularJitter;
-					float vecZ = zi - z + CELL_3D_Z[lutPos] * CellularJitter;
+		for (int32 y = 0; y < ySize; y++)
+		{
+			FLatticeAxis yAxis = axisFunc(yCoords[y]);
 
-					float newDistance = vecX * vecX + vecY * vecY + vecZ * vecZ;
+			if (!bHashed || yAxis.Cell != yCell || zAxis.Cell != zCell)
+			{
+				for (int32 i = 0; i < columnCount; i++)
+					column(corners + i * Corners, (int32)((uint32)xMin - Before + i), yAxis.Cell, zAxis.Cell);
 
-					if (newDistance < distance)
-					{
-						distance = newDistance;
-						xc = xi;
-						yc = yi;
-						zc = zi;
-					}
-				}
+				yCell = yAxis.Cell;
+				zCell = zAxis.Cell;
+				bHashed = true;
 			}
+
+			for (int32 x = 0; x < xSize; x++)
+				out[index++] = sample(corners + (xAxes[x].Cell - xMin) * Corners, xAxes[x], yAxis, zAxis);
 		}
-		break;
-	case EFNCellularDistanceFunction::Manhattan:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
+	}
+
+	return true;
+}
+
+bool FFastNoiseParams::FillLatticeGrid2D(float* out, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize) const
+{
+	bool bFilled = false;
+
+	DispatchHash(HashType, [&](auto hash)
+	{
+		using THash = decltype(hash);
+
+		switch (NoiseType)
 		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
+		case EFNNoiseType::Value:
+			DispatchInterp(Interpolation, [&](auto interp)
 			{
-				for (int32 zi = zr - 1; zi <= zr + 1; zi++)
+				bFilled = WalkLatticeGrid2D<0, 1, 2, float>(out, xCoords, yCoords, xSize, ySize, LatticeAxis<decltype(interp)>,
+					[this](float* corners, int32 x, int32 y)
+					{
+						x = LatticeX(x);
+						y = LatticeY(y);
+						corners[0] = ValCoord2DFast<THash>(BaseOffset, x, y);
+						corners[1] = ValCoord2DFast<THash>(BaseOffset, x, y + 1);
+					},
+					[](const float* corners, const FLatticeAxis& x, const FLatticeAxis& y)
+					{
+						float xf0 = Lerp(corners[0], corners[2], x.Weight);
+						float xf1 = Lerp(corners[1], corners[3], x.Weight);
+
+						return Lerp(xf0, xf1, y.Weight);
+					});
+			});
+			break;
+		case EFNNoiseType::Perlin:
+			DispatchInterp(Interpolation, [&](auto interp)
+			{
+				bFilled = WalkLatticeGrid2D<0, 1, 2, int32>(out, xCoords, yCoords, xSize, ySize, LatticeAxis<decltype(interp)>,
+					[this](int32* corners, int32 x, int32 y)
+					{
+						x = LatticeX(x);
+						y = LatticeY(y);
+						corners[0] = GradHash2D<THash>(BaseOffset, x, y);
+						corners[1] = GradHash2D<THash>(BaseOffset, x, y + 1);
+					},
+					[this](const int32* corners, const FLatticeAxis& x, const FLatticeAxis& y)
+					{
+						float xf0 = Lerp(GradDot2D<THash>(corners[0], x.Offset0, y.Offset0), GradDot2D<THash>(corners[2], x.Offset1, y.Offset0), x.Weight);
+						float xf1 = Lerp(GradDot2D<THash>(corners[1], x.Offset0, y.Offset1), GradDot2D<THash>(corners[3], x.Offset1, y.Offset1), x.Weight);
+
+						return Lerp(xf0, xf1, y.Weight);
+					});
+			});
+			break;
+		case EFNNoiseType::Cubic:
+			bFilled = WalkLatticeGrid2D<1, 2, 4, float>(out, xCoords, yCoords, xSize, ySize, LatticeAxis<FInterpLinear>,
+				[this](float* corners, int32 x, int32 y)
 				{
-					uint8 lutPos = Index3D_256(0, xi, yi, zi);
+					x = LatticeX(x);
+					y = LatticeY(y);
 
-					float vecX = xi - x + CELL_3D_X[lutPos] * CellularJitter;
-					float vecY = yi - y + CELL_3D_Y[lutPos] * CellularJitter;
-					float vecZ = zi - z + CELL_3D_Z[lutPos] * CellularJitter;
+					for (int32 i = 0; i < 4; i++)
+						corners[i] = ValCoord2DFast<THash>(BaseOffset, x, y - 1 + i);
+				},
+				[](const float* corners, const FLatticeAxis& x, const FLatticeAxis& y)
+				{
+					float xf[4];
 
-					float newDistance = FastAbs(vecX) + FastAbs(vecY) + FastAbs(vecZ);
+					for (int32 i = 0; i < 4; i++)
+						xf[i] = CubicLerp(corners[i], corners[4 + i], corners[8 + i], corners[12 + i], x.Weight);
 
-					if (newDistance < distance)
-					{
-						distance = newDistance;
-						xc = xi;
-						yc = yi;
-						zc = zi;
-					}
-				}
-			}
+					return CubicLerp(xf[0], xf[1], xf[2], xf[3], y.Weight) * CUBIC_2D_BOUNDING;
+				});
+			break;
+		default:
+			break;
 		}
-		break;
-	case EFNCellularDistanceFunction::Natural:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
+	});
+
+	return bFilled;
+}
+
+bool FFastNoiseParams::FillLatticeGrid3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize) const
+{
+	bool bFilled = false;
+
+	DispatchHash(HashType, [&](auto hash)
+	{
+		using THash = decltype(hash);
+
+		switch (NoiseType)
 		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
+		case EFNNoiseType::Value:
+			DispatchInterp(Interpolation, [&](auto interp)
 			{
-				for (int32 zi = zr - 1; zi <= zr + 1; zi++)
+				bFilled = WalkLatticeGrid3D<0, 1, 4, float>(out, xCoords, yCoords, zCoords, xSize, ySize, zSize, LatticeAxis<decltype(interp)>,
+					[this](float* corners, int32 x, int32 y, int32 z)
+					{
+						x = LatticeX(x);
+						y = LatticeY(y);
+						z = LatticeZ(z);
+						corners[0] = ValCoord3DFast<THash>(BaseOffset, x, y, z);
+						corners[1] = ValCoord3DFast<THash>(BaseOffset, x, y + 1, z);
+						corners[2] = ValCoord3DFast<THash>(BaseOffset, x, y, z + 1);
+						corners[3] = ValCoord3DFast<THash>(BaseOffset, x, y + 1, z + 1);
+					},
+					[](const float* corners, const FLatticeAxis& x, const FLatticeAxis& y, const FLatticeAxis& z)
+					{
+						float xf00 = Lerp(corners[0], corners[4], x.Weight);
+						float xf10 = Lerp(corners[1], corners[5], x.Weight);
+						float xf01 = Lerp(corners[2], corners[6], x.Weight);
+						float xf11 = Lerp(corners[3], corners[7], x.Weight);
+
+						float yf0 = Lerp(xf00, xf10, y.Weight);
+						float yf1 = Lerp(xf01, xf11, y.Weight);
+
+						return Lerp(yf0, yf1, z.Weight);
+					});
+			});
+			break;
+		case EFNNoiseType::Perlin:
+			DispatchInterp(Interpolation, [&](auto interp)
+			{
+				bFilled = WalkLatticeGrid3D<0, 1, 4, int32>(out, xCoords, yCoords, zCoords, xSize, ySize, zSize, LatticeAxis<decltype(interp)>,
+					[this](int32* corners, int32 x, int32 y, int32 z)
+					{
+						x = LatticeX(x);
+						y = LatticeY(y);
+						z = LatticeZ(z);
+						corners[0] = GradHash3D<THash>(BaseOffset, x, y, z);
+						corners[1] = GradHash3D<THash>(BaseOffset, x, y + 1, z);
+						corners[2] = GradHash3D<THash>(BaseOffset, x, y, z + 1);
+						corners[3] = GradHash3D<THash>(BaseOffset, x, y + 1, z + 1);
+					},
+					[this](const int32* corners, const FLatticeAxis& x, const FLatticeAxis& y, const FLatticeAxis& z)
+					{
+						float xf00 = Lerp(GradDot3D<THash>(corners[0], x.Offset0, y.Offset0, z.Offset0), GradDot3D<THash>(corners[4], x.Offset1, y.Offset0, z.Offset0), x.Weight);
+						float xf10 = Lerp(GradDot3D<THash>(corners[1], x.Offset0, y.Offset1, z.Offset0), GradDot3D<THash>(corners[5], x.Offset1, y.Offset1, z.Offset0), x.Weight);
+						float xf01 = Lerp(GradDot3D<THash>(corners[2], x.Offset0, y.Offset0, z.Offset1), GradDot3D<THash>(corners[6], x.Offset1, y.Offset0, z.Offset1), x.Weight);
+						float xf11 = Lerp(GradDot3D<THash>(corners[3], x.Offset0, y.Offset1, z.Offset1), GradDot3D<THash>(corners[7], x.Offset1, y.Offset1, z.Offset1), x.Weight);
+
+						float yf0 = Lerp(xf00, xf10, y.Weight);
+						float yf1 = Lerp(xf01, xf11, y.Weight);
+
+						return Lerp(yf0, yf1, z.Weight);
+					});
+			});
+			break;
+		case EFNNoiseType::Cubic:
+			// Corner i + 4 * j of a column is at y - 1 + i, z - 1 + j
+			bFilled = WalkLatticeGrid3D<1, 2, 16, float>(out, xCoords, yCoords, zCoords, xSize, ySize, zSize, LatticeAxis<FInterpLinear>,
+				[this](float* corners, int32 x, int32 y, int32 z)
+				{
+					x = LatticeX(x);
+					y = LatticeY(y);
+					z = LatticeZ(z);
+
+					for (int32 j = 0; j < 4; j++)
+						for (int32 i = 0; i < 4; i++)
+							corners[i + 4 * j] = ValCoord3DFast<THash>(BaseOffset, x, y - 1 + i, z - 1 + j);
+				},
+				[](const float* corners, const FLatticeAxis& x, const FLatticeAxis& y, const FLatticeAxis& z)
 				{
-					uint8 lutPos = Index3D_256(0, xi, yi, zi);
+					float yf[4];
 
-					float vecX = xi - x + CELL_3D_X[lutPos] * CellularJitter;
-					float vecY = yi - y + CELL_3D_Y[lutPos] * CellularJitter;
-					float vecZ = zi - z + CELL_3D_Z[lutPos] * CellularJitter;
+					for (int32 j = 0; j < 4; j++)
+					{
+						float xf[4];
 
-					float newDistance = (FastAbs(vecX) + FastAbs(vecY) + FastAbs(vecZ)) + (vecX * vecX + vecY * vecY + vecZ * vecZ);
+						for (int32 i = 0; i < 4; i++)
+						{
+							const float* row = corners + i + 4 * j;
+							xf[i] = CubicLerp(row[0], row[16], row[32], row[48], x.Weight);
+						}
 
-					if (newDistance < distance)
-					{
-						distance = newDistance;
-						xc = xi;
-						yc = yi;
-						zc = zi;
+						yf[j] = CubicLerp(xf[0], xf[1], xf[2], xf[3], y.Weight);
 					}
-				}
-			}
+
+					return CubicLerp(yf[0], yf[1], yf[2], yf[3], z.Weight) * CUBIC_3D_BOUNDING;
+				});
+			break;
+		default:
+			break;
 		}
-		break;
-	default:
-		break;
-	}
+	});
 
-	uint8 lutPos;
-	switch (CellularReturnType)
-	{
-	case EFNCellularReturnType::CellValue:
-		return ValCoord3D(Seed, xc, yc, zc);
+	return bFilled;
+}
 
-	case EFNCellularReturnType::NoiseLookup:
-		assert(CellularNoiseLookup);
+// Cellular Noise
+float FFastNoiseParams::GetCellular3D(float x, float y, float z) const
+{
+	return SampleNoise3D(EFNNoiseType::Cellular, x * Frequency, y * Frequency, z * Frequency);
+}
 
-		lutPos = Index3D_256(0, xc, yc, zc);
-		return CellularNoiseLookup->GetNoise3D(xc + CELL_3D_X[lutPos] * CellularJitter, yc + CELL_3D_Y[lutPos] * CellularJitter, zc + CELL_3D_Z[lutPos] * CellularJitter);
+template <typename FNoiseSetFunc>
+void FFastNoiseParams::DispatchCellular3D(FNoiseSetFunc& fill) const
+{
+	DispatchHash(HashType, [&](auto hash)
+	{
+		DispatchCellularDistance(CellularDistanceFunction, [&](auto distanceFunc)
+		{
+			using THash = decltype(hash);
+			using TDistance = decltype(distanceFunc);
 
-	case EFNCellularReturnType::Distance:
-		return distance;
-	default:
-		return 0;
-	}
+			switch (CellularReturnType)
+			{
+			case EFNCellularReturnType::CellValue:
+				fill([this](float x, float y, float z) { return SingleCellular<THash, TDistance, EFNCellularReturnType::CellValue>(x, y, z); });
+				break;
+			case EFNCellularReturnType::NoiseLookup:
+				fill([this](float x, float y, float z) { return SingleCellular<THash, TDistance, EFNCellularReturnType::NoiseLookup>(x, y, z); });
+				break;
+			case EFNCellularReturnType::Distance:
+				fill([this](float x, float y, float z) { return SingleCellular<THash, TDistance, EFNCellularReturnType::Distance>(x, y, z); });
+				break;
+			case EFNCellularReturnType::Distance2:
+				DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
+				{
+					fill([this](float x, float y, float z) { return SingleCellular2Edge<THash, TDistance, EFNCellularReturnType::Distance2, decltype(index1)::value>(x, y, z); });
+				});
+				break;
+			case EFNCellularReturnType::Distance2Add:
+				DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
+				{
+					fill([this](float x, float y, float z) { return SingleCellular2Edge<THash, TDistance, EFNCellularReturnType::Distance2Add, decltype(index1)::value>(x, y, z); });
+				});
+				break;
+			case EFNCellularReturnType::Distance2Sub:
+				DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
+				{
+					fill([this](float x, float y, float z) { return SingleCellular2Edge<THash, TDistance, EFNCellularReturnType::Distance2Sub, decltype(index1)::value>(x, y, z); });
+				});
+				break;
+			case EFNCellularReturnType::Distance2Mul:
+				DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
+				{
+					fill([this](float x, float y, float z) { return SingleCellular2Edge<THash, TDistance, EFNCellularReturnType::Distance2Mul, decltype(index1)::value>(x, y, z); });
+				});
+				break;
+			case EFNCellularReturnType::Distance2Div:
+				DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
+				{
+					fill([this](float x, float y, float z) { return SingleCellular2Edge<THash, TDistance, EFNCellularReturnType::Distance2Div, decltype(index1)::value>(x, y, z); });
+				});
+				break;
+			}
+		});
+	});
 }
 
-float UFastNoise::SingleCellular2Edge(float x, float y, float z) const
+template <typename THash, typename TDistance>
+FORCEINLINE float FFastNoiseParams::SingleCellularClosest(float x, float y, float z, int32& xc, int32& yc, int32& zc) const
 {
-	int32 xr = FastRound(x);
-	int32 yr = FastRound(y);
-	int32 zr = FastRound(z);
+	float distance = 999999;
 
-	float distance[FN_CELLULAR_INDEX_MAX+1] = { 999999,999999,999999,999999 };
+	xc = 0;
+	yc = 0;
+	zc = 0;
 
-	switch (CellularDistanceFunction)
+	ForEachCellularCell<TDistance>(x, y, z, CellularJitter, distance, [&](int32 xi, int32 yi, int32 zi)
 	{
-	case EFNCellularDistanceFunction::Euclidean:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
-		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
-			{
-				for (int32 zi = zr - 1; zi <= zr + 1; zi++)
-				{
-					uint8 lutPos = Index3D_256(0, xi, yi, zi);
+		uint8 lutPos = Index3D_256<THash>(0, LatticeX(xi), LatticeY(yi), LatticeZ(zi));
 
-					float vecX = xi - x + CELL_3D_X[lutPos] * CellularJitter;
-					float vecY = yi - y + CELL_3D_Y[lutPos] * CellularJitter;
-					float vecZ = zi - z + CELL_3D_Z[lutPos] * CellularJitter;
+		float vecX = xi - x + CELL_3D_X[lutPos] * CellularJitter;
+		float vecY = yi - y + CELL_3D_Y[lutPos] * CellularJitter;
+		float vecZ = zi - z + CELL_3D_Z[lutPos] * CellularJitter;
 
-					float newDistance = vecX * vecX + vecY * vecY + vecZ * vecZ;
+		float newDistance = TDistance::Distance(vecX, vecY, vecZ);
 
-					for (int32 i = CellularDistanceIndex1; i > 0; i--)
-						distance[i] = fmax(fmin(distance[i], newDistance), distance[i - 1]);
-					distance[0] = fmin(distance[0], newDistance); 
-				}
-			}
-		}
-		break;
-	case EFNCellularDistanceFunction::Manhattan:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
+		if (newDistance < distance || (newDistance == distance && CellularScansBefore(xi, yi, zi, xc, yc, zc)))
 		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
-			{
-				for (int32 zi = zr - 1; zi <= zr + 1; zi++)
-				{
-					uint8 lutPos = Index3D_256(0, xi, yi, zi);
+			distance = newDistance;
+			xc = xi;
+			yc = yi;
+			zc = zi;
+		}
+	});
 
-					float vecX = xi - x + CELL_3D_X[lutPos] * CellularJitter;
-					float vecY = yi - y + CELL_3D_Y[lutPos] * CellularJitter;
-					float vecZ = zi - z + CELL_3D_Z[lutPos] * CellularJitter;
+	return distance;
+}
 
-					float newDistance = FastAbs(vecX) + FastAbs(vecY) + FastAbs(vecZ);
+template <typename THash, typename TDistance, EFNCellularReturnType ReturnType>
+float FFastNoiseParams::SingleCellular(float x, float y, float z) const
+{
+	int32 xc, yc, zc;
+	float distance = SingleCellularClosest<THash, TDistance>(x, y, z, xc, yc, zc);
 
-					for (int32 i = CellularDistanceIndex1; i > 0; i--)
-						distance[i] = fmax(fmin(distance[i], newDistance), distance[i - 1]);
-					distance[0] = fmin(distance[0], newDistance);
-				}
-			}
-		}
-		break;
-	case EFNCellularDistanceFunction::Natural:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
-		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
-			{
-				for (int32 zi = zr - 1; zi <= zr + 1; zi++)
-				{
-					uint8 lutPos = Index3D_256(0, xi, yi, zi);
+	uint8 lutPos;
+	switch (ReturnType)
+	{
+	case EFNCellularReturnType::CellValue:
+		return ValCoord3D(Seed, LatticeX(xc), LatticeY(yc), LatticeZ(zc));
+
+	case EFNCellularReturnType::NoiseLookup:
+		assert(Lookup);
+
+		lutPos = Index3D_256<THash>(0, LatticeX(xc), LatticeY(yc), LatticeZ(zc));
+		if (LatticeOriginX || LatticeOriginY || LatticeOriginZ)
+			return Lookup->GetNoiseLarge3D(LatticeOriginX + (xc + (double)CELL_3D_X[lutPos] * CellularJitter), LatticeOriginY + (yc + (double)CELL_3D_Y[lutPos] * CellularJitter), LatticeOriginZ + (zc + (double)CELL_3D_Z[lutPos] * CellularJitter));
+
+		return Lookup->GetNoise3D(xc + CELL_3D_X[lutPos] * CellularJitter, yc + CELL_3D_Y[lutPos] * CellularJitter, zc + CELL_3D_Z[lutPos] * CellularJitter);
+
+	case EFNCellularReturnType::Distance:
+		return distance;
+	default:
+		return 0;
+	}
+}
 
-					float vecX = xi - x + CELL_3D_X[lutPos] * CellularJitter;
-					float vecY = yi - y + CELL_3D_Y[lutPos] * CellularJitter;
-					float vecZ = zi - z + CELL_3D_Z[lutPos] * CellularJitter;
+template <typename THash, typename TDistance, EFNCellularReturnType ReturnType, int32 DistanceIndex1>
+float FFastNoiseParams::SingleCellular2Edge(float x, float y, float z) const
+{
+	// Sorted nearest distances, only up to the furthest one returned
+	float distance[DistanceIndex1 + 1];
+	for (float& d : distance)
+		d = 999999;
 
-					float newDistance = (FastAbs(vecX) + FastAbs(vecY) + FastAbs(vecZ)) + (vecX * vecX + vecY * vecY + vecZ * vecZ);
+	// Cells that cannot beat the furthest kept distance would leave the array unchanged
+	ForEachCellularCell<TDistance>(x, y, z, CellularJitter, distance[DistanceIndex1], [&](int32 xi, int32 yi, int32 zi)
+	{
+		uint8 lutPos = Index3D_256<THash>(0, LatticeX(xi), LatticeY(yi), LatticeZ(zi));
 
-					for (int32 i = CellularDistanceIndex1; i > 0; i--)
-						distance[i] = fmax(fmin(distance[i], newDistance), distance[i - 1]);
-					distance[0] = fmin(distance[0], newDistance);
-				}
-			}
-		}
-		break;
-	default:
-		break;
-	}
+		float vecX = xi - x + CELL_3D_X[lutPos] * CellularJitter;
+		float vecY = yi - y + CELL_3D_Y[lutPos] * CellularJitter;
+		float vecZ = zi - z + CELL_3D_Z[lutPos] * CellularJitter;
+
+		float newDistance = TDistance::Distance(vecX, vecY, vecZ);
 
-	switch (CellularReturnType)
+		for (int32 i = DistanceIndex1; i > 0; i--)
+			distance[i] = fmax(fmin(distance[i], newDistance), distance[i - 1]);
+		distance[0] = fmin(distance[0], newDistance);
+	});
+
+	switch (ReturnType)
 	{
 	case EFNCellularReturnType::Distance2:
-		return distance[CellularDistanceIndex1];
+		return distance[DistanceIndex1];
 	case EFNCellularReturnType::Distance2Add:
-		return distance[CellularDistanceIndex1] + distance[CellularDistanceIndex0];
+		return distance[DistanceIndex1] + distance[CellularDistanceIndex0];
 	case EFNCellularReturnType::Distance2Sub:
-		return distance[CellularDistanceIndex1] - distance[CellularDistanceIndex0];
+		return distance[DistanceIndex1] - distance[CellularDistanceIndex0];
 	case EFNCellularReturnType::Distance2Mul:
-		return distance[CellularDistanceIndex1] * distance[CellularDistanceIndex0];
+		return distance[DistanceIndex1] * distance[CellularDistanceIndex0];
 	case EFNCellularReturnType::Distance2Div:
-		return distance[CellularDistanceIndex0] / distance[CellularDistanceIndex1];
+		return distance[CellularDistanceIndex0] / distance[DistanceIndex1];
 	default:
 		return 0;
 	}
 }
 
-float UFastNoise::GetCellular2D(float x, float y) const
-{
-	x *= Frequency;
-	y *= Frequency;
-
-	switch (CellularReturnType)
-	{
-	case EFNCellularReturnType::CellValue:
-	case EFNCellularReturnType::NoiseLookup:
-	case EFNCellularReturnType::Distance:
-		return SingleCellular(x, y);
-	default:
-		return SingleCellular2Edge(x, y);
-	}
-}
-
-float UFastNoise::SingleCellular(float x, float y) const
+template <typename THash, typename TDistance, int32 DistanceIndex1>
+void FFastNoiseParams::SingleCellularSample(float x, float y, float z, FFastNoiseCellularSample& sample) const
 {
-	int32 xr = FastRound(x);
-	int32 yr = FastRound(y);
+	// Sorted nearest distances as in SingleCellular2Edge, with the closest cell tracked as in SingleCellular
+	float distance[DistanceIndex1 + 1];
+	for (float& d : distance)
+		d = 999999;
 
-	float distance = 999999;
 	int32 xc = 0;
 	int32 yc = 0;
+	int32 zc = 0;
 
-	switch (CellularDistanceFunction)
+	// distance[0] never exceeds distance[DistanceIndex1], so the cells skipped cannot be the closest either
+	ForEachCellularCell<TDistance>(x, y, z, CellularJitter, distance[DistanceIndex1], [&](int32 xi, int32 yi, int32 zi)
 	{
-	default:
-	case EFNCellularDistanceFunction::Euclidean:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
-		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
-			{
-				uint8 lutPos = Index2D_256(0, xi, yi);
+		uint8 lutPos = Index3D_256<THash>(0, LatticeX(xi), LatticeY(yi), LatticeZ(zi));
 
-				float vecX = xi - x + CELL_2D_X[lutPos] * CellularJitter;
-				float vecY = yi - y + CELL_2D_Y[lutPos] * CellularJitter;
-															
-				float newDistance = vecX * vecX + vecY * vecY;
+		float vecX = xi - x + CELL_3D_X[lutPos] * CellularJitter;
+		float vecY = yi - y + CELL_3D_Y[lutPos] * CellularJitter;
+		float vecZ = zi - z + CELL_3D_Z[lutPos] * CellularJitter;
 
-				if (newDistance < distance)
-				{
-					distance = newDistance;
-					xc = xi;
-					yc = yi;
-				}
-			}
+		float newDistance = TDistance::Distance(vecX, vecY, vecZ);
+
+		if (newDistance < distance[0] || (newDistance == distance[0] && CellularScansBefore(xi, yi, zi, xc, yc, zc)))
+		{
+			xc = xi;
+			yc = yi;
+			zc = zi;
 		}
-		break;
-	case EFNCellularDistanceFunction::Manhattan:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
+
+		for (int32 i = DistanceIndex1; i > 0; i--)
+			distance[i] = fmax(fmin(distance[i], newDistance), distance[i - 1]);
+		distance[0] = fmin(distance[0], newDistance);
+	});
+
+	sample.Distance = distance[0];
+	sample.Distance0 = distance[CellularDistanceIndex0];
+	sample.Distance1 = distance[DistanceIndex1];
+	sample.CellValue = ValCoord3D(Seed, LatticeX(xc), LatticeY(yc), LatticeZ(zc));
+	sample.Cell = FIntVector(LatticeX(xc), LatticeY(yc), LatticeZ(zc));
+
+	uint8 lutPos = Index3D_256<THash>(0, LatticeX(xc), LatticeY(yc), LatticeZ(zc));
+	sample.CellPosition.X = (xc + CELL_3D_X[lutPos] * CellularJitter) / Frequency;
+	sample.CellPosition.Y = (yc + CELL_3D_Y[lutPos] * CellularJitter) / Frequency;
+	sample.CellPosition.Z = (zc + CELL_3D_Z[lutPos] * CellularJitter) / Frequency;
+}
+
+template <typename FFunc>
+void FFastNoiseParams::DispatchCellularSample(FFunc func) const
+{
+	DispatchHash(HashType, [&](auto hash)
+	{
+		DispatchCellularDistance(CellularDistanceFunction, [&](auto distanceFunc)
 		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
+			DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
 			{
-				uint8 lutPos = Index2D_256(0, xi, yi);
+				func([this](auto&... args) { SingleCellularSample<decltype(hash), decltype(distanceFunc), decltype(index1)::value>(args...); });
+			});
+		});
+	});
+}
+
+FFastNoiseCellularSample FFastNoiseParams::GetCellularSample3D(float x, float y, float z) const
+{
+	FFastNoiseCellularSample sample;
+	DispatchCellularSample([&](auto sampleFunc)
+	{
+		float xs = x * Frequency;
+		float ys = y * Frequency;
+		float zs = z * Frequency;
+		sampleFunc(xs, ys, zs, sample);
+	});
+	return sample;
+}
 
-				float vecX = xi - x + CELL_2D_X[lutPos] * CellularJitter;
-				float vecY = yi - y + CELL_2D_Y[lutPos] * CellularJitter;
+float FFastNoiseParams::GetCellular2D(float x, float y) const
+{
+	return SampleNoise2D(EFNNoiseType::Cellular, x * Frequency, y * Frequency);
+}
 
-				float newDistance = (FastAbs(vecX) + FastAbs(vecY));
+template <typename FNoiseSetFunc>
+void FFastNoiseParams::DispatchCellular2D(FNoiseSetFunc& fill) const
+{
+	DispatchHash(HashType, [&](auto hash)
+	{
+		DispatchCellularDistance(CellularDistanceFunction, [&](auto distanceFunc)
+		{
+			using THash = decltype(hash);
+			using TDistance = decltype(distanceFunc);
 
-				if (newDistance < distance)
+			switch (CellularReturnType)
+			{
+			case EFNCellularReturnType::CellValue:
+				fill([this](float x, float y) { return SingleCellular<THash, TDistance, EFNCellularReturnType::CellValue>(x, y); });
+				break;
+			case EFNCellularReturnType::NoiseLookup:
+				fill([this](float x, float y) { return SingleCellular<THash, TDistance, EFNCellularReturnType::NoiseLookup>(x, y); });
+				break;
+			case EFNCellularReturnType::Distance:
+				fill([this](float x, float y) { return SingleCellular<THash, TDistance, EFNCellularReturnType::Distance>(x, y); });
+				break;
+			case EFNCellularReturnType::Distance2:
+				DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
 				{
-					distance = newDistance;
-					xc = xi;
-					yc = yi;
-				}
+					fill([this](float x, float y) { return SingleCellular2Edge<THash, TDistance, EFNCellularReturnType::Distance2, decltype(index1)::value>(x, y); });
+				});
+				break;
+			case EFNCellularReturnType::Distance2Add:
+				DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
+				{
+					fill([this](float x, float y) { return SingleCellular2Edge<THash, TDistance, EFNCellularReturnType::Distance2Add, decltype(index1)::value>(x, y); });
+				});
+				break;
+			case EFNCellularReturnType::Distance2Sub:
+				DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
+				{
+					fill([this](float x, float y) { return SingleCellular2Edge<THash, TDistance, EFNCellularReturnType::Distance2Sub, decltype(index1)::value>(x, y); });
+				});
+				break;
+			case EFNCellularReturnType::Distance2Mul:
+				DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
+				{
+					fill([this](float x, float y) { return SingleCellular2Edge<THash, TDistance, EFNCellularReturnType::Distance2Mul, decltype(index1)::value>(x, y); });
+				});
+				break;
+			case EFNCellularReturnType::Distance2Div:
+				DispatchCellularIndex(CellularDistanceIndex1, [&](auto index1)
+				{
+					fill([this](float x, float y) { return SingleCellular2Edge<THash, TDistance, EFNCellularReturnType::Distance2Div, decltype(index1)::value>(x, y); });
+				});
+				break;
 			}
-		}
-		break;
-	case EFNCellularDistanceFunction::Natural:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
+		});
+	});
+}
+
+// The plain 3x3 scan, pruning with ForEachCellularCell(...) skips too few of the 9 cells in 2D to pay for its bound tests here
+template <typename THash, typename TDistance>
+FORCEINLINE float FFastNoiseParams::SingleCellularClosest(float x, float y, int32& xc, int32& yc) const
+{
+	int32 xr = FastRound(x);
+	int32 yr = FastRound(y);
+
+	float distance = 999999;
+	xc = 0;
+	yc = 0;
+
+	for (int32 xi = xr - 1; xi <= xr + 1; xi++)
+	{
+		for (int32 yi = yr - 1; yi <= yr + 1; yi++)
 		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
-			{
-				uint8 lutPos = Index2D_256(0, xi, yi);
+			uint8 lutPos = Index2D_256<THash>(0, LatticeX(xi), LatticeY(yi));
 
-				float vecX = xi - x + CELL_2D_X[lutPos] * CellularJitter;
-				float vecY = yi - y + CELL_2D_Y[lutPos] * CellularJitter;
+			float vecX = xi - x + CELL_2D_X[lutPos] * CellularJitter;
+			float vecY = yi - y + CELL_2D_Y[lutPos] * CellularJitter;
 
-				float newDistance = (FastAbs(vecX) + FastAbs(vecY)) + (vecX * vecX + vecY * vecY);
+			float newDistance = TDistance::Distance(vecX, vecY);
 
-				if (newDistance < distance)
-				{
-					distance = newDistance;
-					xc = xi;
-					yc = yi;
-				}
+			if (newDistance < distance)
+			{
+				distance = newDistance;
+				xc = xi;
+				yc = yi;
 			}
 		}
-		break;
 	}
 
+	return distance;
+}
+
+template <typename THash, typename TDistance, EFNCellularReturnType ReturnType>
+float FFastNoiseParams::SingleCellular(float x, float y) const
+{
+	int32 xc, yc;
+	float distance = SingleCellularClosest<THash, TDistance>(x, y, xc, yc);
+
 	uint8 lutPos;
-	switch (CellularReturnType)
+	switch (ReturnType)
 	{
 	case EFNCellularReturnType::CellValue:
-		return ValCoord2D(Seed, xc, yc);
+		return ValCoord2D(Seed, LatticeX(xc), LatticeY(yc));
 
 	case EFNCellularReturnType::NoiseLookup:
-		assert(CellularNoiseLookup);
+		assert(Lookup);
+
+		lutPos = Index2D_256<THash>(0, LatticeX(xc), LatticeY(yc));
+		if (LatticeOriginX || LatticeOriginY)
+			return Lookup->GetNoiseLarge2D(LatticeOriginX + (xc + (double)CELL_2D_X[lutPos] * CellularJitter), LatticeOriginY + (yc + (double)CELL_2D_Y[lutPos] * CellularJitter));
 
-		lutPos = Index2D_256(0, xc, yc);
-		return CellularNoiseLookup->GetNoise2D(xc + CELL_2D_X[lutPos] * CellularJitter, yc + CELL_2D_Y[lutPos] * CellularJitter);
+		return Lookup->GetNoise2D(xc + CELL_2D_X[lutPos] * CellularJitter, yc + CELL_2D_Y[lutPos] * CellularJitter);
 
 	case EFNCellularReturnType::Distance:
 		return distance;
@@ -2060,111 +5314,170 @@ float UFastNoise::SingleCellular(float x, float y) const
 	}
 }
 
-float UFastNoise::SingleCellular2Edge(float x, float y) const
+template <typename THash, typename TDistance, EFNCellularReturnType ReturnType, int32 DistanceIndex1>
+float FFastNoiseParams::SingleCellular2Edge(float x, float y) const
 {
-	int32 xr = FastRound(x);
-	int32 yr = FastRound(y);
+	// Sorted nearest distances, only up to the furthest one returned
+	float distance[DistanceIndex1 + 1];
+	for (float& d : distance)
+		d = 999999;
+
+	// Cells that cannot beat the furthest kept distance would leave the array unchanged
+	ForEachCellularCell<TDistance>(x, y, CellularJitter, distance[DistanceIndex1], [&](int32 xi, int32 yi)
+	{
+		uint8 lutPos = Index2D_256<THash>(0, LatticeX(xi), LatticeY(yi));
 
-	float distance[FN_CELLULAR_INDEX_MAX + 1] = { 999999,999999,999999,999999 };
+		float vecX = xi - x + CELL_2D_X[lutPos] * CellularJitter;
+		float vecY = yi - y + CELL_2D_Y[lutPos] * CellularJitter;
 
-	switch (CellularDistanceFunction)
+		float newDistance = TDistance::Distance(vecX, vecY);
+
+		for (int32 i = DistanceIndex1; i > 0; i--)
+			distance[i] = fmax(fmin(distance[i], newDistance), distance[i - 1]);
+		distance[0] = fmin(distance[0], newDistance);
+	});
+
+	switch (ReturnType)
 	{
+	case EFNCellularReturnType::Distance2:
+		return distance[DistanceIndex1];
+	case EFNCellularReturnType::Distance2Add:
+		return distance[DistanceIndex1] + distance[CellularDistanceIndex0];
+	case EFNCellularReturnType::Distance2Sub:
+		return distance[DistanceIndex1] - distance[CellularDistanceIndex0];
+	case EFNCellularReturnType::Distance2Mul:
+		return distance[DistanceIndex1] * distance[CellularDistanceIndex0];
+	case EFNCellularReturnType::Distance2Div:
+		return distance[CellularDistanceIndex0] / distance[DistanceIndex1];
 	default:
-	case EFNCellularDistanceFunction::Euclidean:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
-		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
-			{
-				uint8 lutPos = Index2D_256(0, xi, yi);
+		return 0;
+	}
+}
 
-				float vecX = xi - x + CELL_2D_X[lutPos] * CellularJitter;
-				float vecY = yi - y + CELL_2D_Y[lutPos] * CellularJitter;
+template <typename THash, typename TDistance, int32 DistanceIndex1>
+void FFastNoiseParams::SingleCellularSample(float x, float y, FFastNoiseCellularSample& sample) const
+{
+	float distance[DistanceIndex1 + 1];
+	for (float& d : distance)
+		d = 999999;
 
-				float newDistance = vecX * vecX + vecY * vecY;
+	int32 xc = 0;
+	int32 yc = 0;
 
-				for (int32 i = CellularDistanceIndex1; i > 0; i--)
-					distance[i] = fmax(fmin(distance[i], newDistance), distance[i - 1]);
-				distance[0] = fmin(distance[0], newDistance);
-			}
-		}
-		break;
-	case EFNCellularDistanceFunction::Manhattan:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
-		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
-			{
-				uint8 lutPos = Index2D_256(0, xi, yi);
+	ForEachCellularCell<TDistance>(x, y, CellularJitter, distance[DistanceIndex1], [&](int32 xi, int32 yi)
+	{
+		uint8 lutPos = Index2D_256<THash>(0, LatticeX(xi), LatticeY(yi));
 
-				float vecX = xi - x + CELL_2D_X[lutPos] * CellularJitter;
-				float vecY = yi - y + CELL_2D_Y[lutPos] * CellularJitter;
+		float vecX = xi - x + CELL_2D_X[lutPos] * CellularJitter;
+		float vecY = yi - y + CELL_2D_Y[lutPos] * CellularJitter;
 
-				float newDistance = FastAbs(vecX) + FastAbs(vecY);
+		float newDistance = TDistance::Distance(vecX, vecY);
 
-				for (int32 i = CellularDistanceIndex1; i > 0; i--)
-					distance[i] = fmax(fmin(distance[i], newDistance), distance[i - 1]);
-				distance[0] = fmin(distance[0], newDistance);
-			}
-		}
-		break;
-	case EFNCellularDistanceFunction::Natural:
-		for (int32 xi = xr - 1; xi <= xr + 1; xi++)
+		if (newDistance < distance[0] || (newDistance == distance[0] && CellularScansBefore(xi, yi, xc, yc)))
 		{
-			for (int32 yi = yr - 1; yi <= yr + 1; yi++)
-			{
-				uint8 lutPos = Index2D_256(0, xi, yi);
+			xc = xi;
+			yc = yi;
+		}
+
+		for (int32 i = DistanceIndex1; i > 0; i--)
+			distance[i] = fmax(fmin(distance[i], newDistance), distance[i - 1]);
+		distance[0] = fmin(distance[0], newDistance);
+	});
+
+	sample.Distance = distance[0];
+	sample.Distance0 = distance[CellularDistanceIndex0];
+	sample.Distance1 = distance[DistanceIndex1];
+	sample.CellValue = ValCoord2D(Seed, LatticeX(xc), LatticeY(yc));
+	sample.Cell = FIntVector(LatticeX(xc), LatticeY(yc), 0);
+
+	uint8 lutPos = Index2D_256<THash>(0, LatticeX(xc), LatticeY(yc));
+	sample.CellPosition.X = (xc + CELL_2D_X[lutPos] * CellularJitter) / Frequency;
+	sample.CellPosition.Y = (yc + CELL_2D_Y[lutPos] * CellularJitter) / Frequency;
+	sample.CellPosition.Z = 0;
+}
 
-				float vecX = xi - x + CELL_2D_X[lutPos] * CellularJitter;
-				float vecY = yi - y + CELL_2D_Y[lutPos] * CellularJitter;
+FFastNoiseCellularSample FFastNoiseParams::GetCellularSample2D(float x, float y) const
+{
+	FFastNoiseCellularSample sample;
+	DispatchCellularSample([&](auto sampleFunc)
+	{
+		float xs = x * Frequency;
+		float ys = y * Frequency;
+		sampleFunc(xs, ys, sample);
+	});
+	return sample;
+}
 
-				float newDistance = (FastAbs(vecX) + FastAbs(vecY)) + (vecX * vecX + vecY * vecY);
+// Gradient Perturb
+// Falloff of a simplex corner from t = r^2 - |offset|^2, 0 outside the radius
+static FORCEINLINE float SimplexPerturbWeight(float t)
+{
+	if (t < 0)
+		return 0;
 
-				for (int32 i = CellularDistanceIndex1; i > 0; i--)
-					distance[i] = fmax(fmin(distance[i], newDistance), distance[i - 1]);
-				distance[0] = fmin(distance[0], newDistance);
-			}
-		}
-		break;
-	}
+	t *= t;
+	return t * t;
+}
 
-	switch (CellularReturnType)
+// Calls func with the warp of a single point selected by PerturbType, as perturb(offset, warpAmp, frequency, x, y[, z])
+template <typename FFunc>
+FORCEINLINE void FFastNoiseParams::DispatchPerturb(FFunc func) const
+{
+	if (PerturbType == EFNPerturbType::Simplex)
 	{
-	case EFNCellularReturnType::Distance2:
-		return distance[CellularDistanceIndex1];
-	case EFNCellularReturnType::Distance2Add:
-		return distance[CellularDistanceIndex1] + distance[CellularDistanceIndex0];
-	case EFNCellularReturnType::Distance2Sub:
-		return distance[CellularDistanceIndex1] - distance[CellularDistanceIndex0];
-	case EFNCellularReturnType::Distance2Mul:
-		return distance[CellularDistanceIndex1] * distance[CellularDistanceIndex0];
-	case EFNCellularReturnType::Distance2Div:
-		return distance[CellularDistanceIndex0] / distance[CellularDistanceIndex1];
-	default:
-		return 0;
+		DispatchHash(HashType, [&](auto hash)
+		{
+			func([this](uint8 offset, float warpAmp, float frequency, auto&... coords) { SingleSimplexPerturb<decltype(hash)>(offset, warpAmp, frequency, coords...); });
+		});
+		return;
 	}
+
+	DispatchHash(HashType, [&](auto hash)
+	{
+		DispatchInterp(Interpolation, [&](auto interp)
+		{
+			func([this](uint8 offset, float warpAmp, float frequency, auto&... coords) { SingleGradientPerturb<decltype(hash), decltype(interp)>(offset, warpAmp, frequency, coords...); });
+		});
+	});
 }
 
-void UFastNoise::GradientPerturb3D(float& x, float& y, float& z) const
+void FFastNoiseParams::GradientPerturb3D(float& x, float& y, float& z) const
+{
+	DispatchPerturb([&](auto perturb)
+	{
+		perturb(0, GradientPerturbAmp, Frequency, x, y, z);
+	});
+}
+
+void FFastNoiseParams::GradientPerturbFractal3D(float& x, float& y, float& z) const
 {
-	SingleGradientPerturb(0, GradientPerturbAmp, Frequency, x, y, z);
+	DispatchPerturb([&](auto perturb)
+	{
+		SinglePerturbFractal(perturb, x, y, z);
+	});
 }
 
-void UFastNoise::GradientPerturbFractal3D(float& x, float& y, float& z) const
+template <typename FPerturb>
+void FFastNoiseParams::SinglePerturbFractal(FPerturb& perturb, float& x, float& y, float& z) const
 {
-	float amp = GradientPerturbAmp * m_fractalBounding;
+	float amp = GradientPerturbAmp * FractalBounding;
 	float freq = Frequency;
 	int32 i = 0;
 
-	SingleGradientPerturb(m_perm[0], amp, Frequency, x, y, z);
+	perturb(OctaveOffset(0), amp, Frequency, x, y, z);
 
 	while (++i < FractalOctaves)
 	{
 		freq *= FractalLacunarity;
 		amp *= FractalGain;
-		SingleGradientPerturb(m_perm[i], amp, freq, x, y, z);
+		if (i == FractalOctaves - 1)
+			amp *= FractalFade;
+		perturb(OctaveOffset(i), amp, freq, x, y, z);
 	}
 }
 
-void UFastNoise::SingleGradientPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y, float& z) const
+template <typename THash, typename TInterp>
+void FFastNoiseParams::SingleGradientPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y, float& z) const
 {
 	float xf = x * frequency;
 	float yf = y * frequency;
@@ -2177,36 +5490,19 @@ void UFastNoise::SingleGradientPerturb(uint8 offset, float warpAmp, float freque
 	int32 y1 = y0 + 1;
 	int32 z1 = z0 + 1;
 
-	float xs, ys, zs;
-	switch (Interpolation)
-	{
-	default:
-	case EFNInterp::Linear:
-		xs = xf - (float)x0;
-		ys = yf - (float)y0;
-		zs = zf - (float)z0;
-		break;
-	case EFNInterp::Hermite:
-		xs = InterpHermiteFunc(xf - (float)x0);
-		ys = InterpHermiteFunc(yf - (float)y0);
-		zs = InterpHermiteFunc(zf - (float)z0);
-		break;
-	case EFNInterp::Quintic:
-		xs = InterpQuinticFunc(xf - (float)x0);
-		ys = InterpQuinticFunc(yf - (float)y0);
-		zs = InterpQuinticFunc(zf - (float)z0);
-		break;
-	}
+	float xs = TInterp::Apply(xf - (float)x0);
+	float ys = TInterp::Apply(yf - (float)y0);
+	float zs = TInterp::Apply(zf - (float)z0);
 
-	int32 lutPos0 = Index3D_256(offset, x0, y0, z0);
-	int32 lutPos1 = Index3D_256(offset, x1, y0, z0);
+	int32 lutPos0 = Index3D_256<THash>(offset, x0, y0, z0);
+	int32 lutPos1 = Index3D_256<THash>(offset, x1, y0, z0);
 
 	float lx0x = Lerp(CELL_3D_X[lutPos0], CELL_3D_X[lutPos1], xs);
 	float ly0x = Lerp(CELL_3D_Y[lutPos0], CELL_3D_Y[lutPos1], xs);
 	float lz0x = Lerp(CELL_3D_Z[lutPos0], CELL_3D_Z[lutPos1], xs);
 
-	lutPos0 = Index3D_256(offset, x0, y1, z0);
-	lutPos1 = Index3D_256(offset, x1, y1, z0);
+	lutPos0 = Index3D_256<THash>(offset, x0, y1, z0);
+	lutPos1 = Index3D_256<THash>(offset, x1, y1, z0);
 
 	float lx1x = Lerp(CELL_3D_X[lutPos0], CELL_3D_X[lutPos1], xs);
 	float ly1x = Lerp(CELL_3D_Y[lutPos0], CELL_3D_Y[lutPos1], xs);
@@ -2216,15 +5512,15 @@ void UFastNoise::SingleGradientPerturb(uint8 offset, float warpAmp, float freque
 	float ly0y = Lerp(ly0x, ly1x, ys);
 	float lz0y = Lerp(lz0x, lz1x, ys);
 
-	lutPos0 = Index3D_256(offset, x0, y0, z1);
-	lutPos1 = Index3D_256(offset, x1, y0, z1);
+	lutPos0 = Index3D_256<THash>(offset, x0, y0, z1);
+	lutPos1 = Index3D_256<THash>(offset, x1, y0, z1);
 
 	lx0x = Lerp(CELL_3D_X[lutPos0], CELL_3D_X[lutPos1], xs);
 	ly0x = Lerp(CELL_3D_Y[lutPos0], CELL_3D_Y[lutPos1], xs);
 	lz0x = Lerp(CELL_3D_Z[lutPos0], CELL_3D_Z[lutPos1], xs);
 
-	lutPos0 = Index3D_256(offset, x0, y1, z1);
-	lutPos1 = Index3D_256(offset, x1, y1, z1);
+	lutPos0 = Index3D_256<THash>(offset, x0, y1, z1);
+	lutPos1 = Index3D_256<THash>(offset, x1, y1, z1);
 
 	lx1x = Lerp(CELL_3D_X[lutPos0], CELL_3D_X[lutPos1], xs);
 	ly1x = Lerp(CELL_3D_Y[lutPos0], CELL_3D_Y[lutPos1], xs);
@@ -2235,28 +5531,122 @@ void UFastNoise::SingleGradientPerturb(uint8 offset, float warpAmp, float freque
 	z += Lerp(lz0y, Lerp(lz0x, lz1x, ys), zs) * warpAmp;
 }
 
-void UFastNoise::GradientPerturb2D(float& x, float& y) const
+// Sum of the corner vectors of the simplex containing the position, each weighted by its falloff as in simplex noise
+// Visits 3 corners in 2D and 4 in 3D instead of the 4 and 8 of SingleGradientPerturb, and does not use Interpolation
+template <typename THash>
+void FFastNoiseParams::SingleSimplexPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y, float& z) const
+{
+	float xf = x * frequency;
+	float yf = y * frequency;
+	float zf = z * frequency;
+
+	float t = (xf + yf + zf) * F3;
+	int32 i = FastFloor(xf + t);
+	int32 j = FastFloor(yf + t);
+	int32 k = FastFloor(zf + t);
+
+	t = (i + j + k) * G3;
+	float x0 = xf - (i - t);
+	float y0 = yf - (j - t);
+	float z0 = zf - (k - t);
+
+	int32 i1, j1, k1;
+	int32 i2, j2, k2;
+
+	if (x0 >= y0)
+	{
+		if (y0 >= z0)
+		{
+			i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 1; k2 = 0;
+		}
+		else if (x0 >= z0)
+		{
+			i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 0; k2 = 1;
+		}
+		else // x0 < z0
+		{
+			i1 = 0; j1 = 0; k1 = 1; i2 = 1; j2 = 0; k2 = 1;
+		}
+	}
+	else // x0 < y0
+	{
+		if (y0 < z0)
+		{
+			i1 = 0; j1 = 0; k1 = 1; i2 = 0; j2 = 1; k2 = 1;
+		}
+		else if (x0 < z0)
+		{
+			i1 = 0; j1 = 1; k1 = 0; i2 = 0; j2 = 1; k2 = 1;
+		}
+		else // x0 >= z0
+		{
+			i1 = 0; j1 = 1; k1 = 0; i2 = 1; j2 = 1; k2 = 0;
+		}
+	}
+
+	float x1 = x0 - i1 + G3;
+	float y1 = y0 - j1 + G3;
+	float z1 = z0 - k1 + G3;
+	float x2 = x0 - i2 + 2*G3;
+	float y2 = y0 - j2 + 2*G3;
+	float z2 = z0 - k2 + 2*G3;
+	float x3 = x0 - 1 + 3*G3;
+	float y3 = y0 - 1 + 3*G3;
+	float z3 = z0 - 1 + 3*G3;
+
+	float w0 = SimplexPerturbWeight(float(0.6) - x0*x0 - y0*y0 - z0*z0);
+	float w1 = SimplexPerturbWeight(float(0.6) - x1*x1 - y1*y1 - z1*z1);
+	float w2 = SimplexPerturbWeight(float(0.6) - x2*x2 - y2*y2 - z2*z2);
+	float w3 = SimplexPerturbWeight(float(0.6) - x3*x3 - y3*y3 - z3*z3);
+
+	int32 lutPos0 = Index3D_256<THash>(offset, i, j, k);
+	int32 lutPos1 = Index3D_256<THash>(offset, i + i1, j + j1, k + k1);
+	int32 lutPos2 = Index3D_256<THash>(offset, i + i2, j + j2, k + k2);
+	int32 lutPos3 = Index3D_256<THash>(offset, i + 1, j + 1, k + 1);
+
+	warpAmp *= SIMPLEX_PERTURB_SCALE_3D;
+	x += (w0*CELL_3D_X[lutPos0] + w1*CELL_3D_X[lutPos1] + w2*CELL_3D_X[lutPos2] + w3*CELL_3D_X[lutPos3]) * warpAmp;
+	y += (w0*CELL_3D_Y[lutPos0] + w1*CELL_3D_Y[lutPos1] + w2*CELL_3D_Y[lutPos2] + w3*CELL_3D_Y[lutPos3]) * warpAmp;
+	z += (w0*CELL_3D_Z[lutPos0] + w1*CELL_3D_Z[lutPos1] + w2*CELL_3D_Z[lutPos2] + w3*CELL_3D_Z[lutPos3]) * warpAmp;
+}
+
+void FFastNoiseParams::GradientPerturb2D(float& x, float& y) const
+{
+	DispatchPerturb([&](auto perturb)
+	{
+		perturb(0, GradientPerturbAmp, Frequency, x, y);
+	});
+}
+
+void FFastNoiseParams::GradientPerturbFractal2D(float& x, float& y) const
 {
-	SingleGradientPerturb(0, GradientPerturbAmp, Frequency, x, y);
+	DispatchPerturb([&](auto perturb)
+	{
+		SinglePerturbFractal(perturb, x, y);
+	});
 }
 
-void UFastNoise::GradientPerturbFractal2D(float& x, float& y) const
+template <typename FPerturb>
+void FFastNoiseParams::SinglePerturbFractal(FPerturb& perturb, float& x, float& y) const
 {
-	float amp = GradientPerturbAmp * m_fractalBounding;
+	float amp = GradientPerturbAmp * FractalBounding;
 	float freq = Frequency;
 	int32 i = 0;
 
-	SingleGradientPerturb(m_perm[0], amp, Frequency, x, y);
+	perturb(OctaveOffset(0), amp, Frequency, x, y);
 
 	while (++i < FractalOctaves)
 	{
 		freq *= FractalLacunarity;
 		amp *= FractalGain;
-		SingleGradientPerturb(m_perm[i], amp, freq, x, y);
+		if (i == FractalOctaves - 1)
+			amp *= FractalFade;
+		perturb(OctaveOffset(i), amp, freq, x, y);
 	}
 }
 
-void UFastNoise::SingleGradientPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y) const
+template <typename THash, typename TInterp>
+void FFastNoiseParams::SingleGradientPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y) const
 {
 	float xf = x * frequency;
 	float yf = y * frequency;
@@ -2266,32 +5656,17 @@ void UFastNoise::SingleGradientPerturb(uint8 offset, float warpAmp, float freque
 	int32 x1 = x0 + 1;
 	int32 y1 = y0 + 1;
 
-	float xs, ys;
-	switch (Interpolation)
-	{
-	default:
-	case EFNInterp::Linear:
-		xs = xf - (float)x0;
-		ys = yf - (float)y0;
-		break;
-	case EFNInterp::Hermite:
-		xs = InterpHermiteFunc(xf - (float)x0);
-		ys = InterpHermiteFunc(yf - (float)y0);
-		break;
-	case EFNInterp::Quintic:
-		xs = InterpQuinticFunc(xf - (float)x0);
-		ys = InterpQuinticFunc(yf - (float)y0);
-		break;
-	}
+	float xs = TInterp::Apply(xf - (float)x0);
+	float ys = TInterp::Apply(yf - (float)y0);
 
-	int32 lutPos0 = Index2D_256(offset, x0, y0);
-	int32 lutPos1 = Index2D_256(offset, x1, y0);
+	int32 lutPos0 = Index2D_256<THash>(offset, x0, y0);
+	int32 lutPos1 = Index2D_256<THash>(offset, x1, y0);
 
 	float lx0x = Lerp(CELL_2D_X[lutPos0], CELL_2D_X[lutPos1], xs);
 	float ly0x = Lerp(CELL_2D_Y[lutPos0], CELL_2D_Y[lutPos1], xs);
 
-	lutPos0 = Index2D_256(offset, x0, y1);
-	lutPos1 = Index2D_256(offset, x1, y1);
+	lutPos0 = Index2D_256<THash>(offset, x0, y1);
+	lutPos1 = Index2D_256<THash>(offset, x1, y1);
 
 	float lx1x = Lerp(CELL_2D_X[lutPos0], CELL_2D_X[lutPos1], xs);
 	float ly1x = Lerp(CELL_2D_Y[lutPos0], CELL_2D_Y[lutPos1], xs);
@@ -2299,3 +5674,45 @@ void UFastNoise::SingleGradientPerturb(uint8 offset, float warpAmp, float freque
 	x += Lerp(lx0x, lx1x, ys) * warpAmp;
 	y += Lerp(ly0x, ly1x, ys) * warpAmp;
 }
+
+template <typename THash>
+void FFastNoiseParams::SingleSimplexPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y) const
+{
+	float xf = x * frequency;
+	float yf = y * frequency;
+
+	float t = (xf + yf) * F2;
+	int32 i = FastFloor(xf + t);
+	int32 j = FastFloor(yf + t);
+
+	t = (i + j) * G2;
+	float x0 = xf - (i - t);
+	float y0 = yf - (j - t);
+
+	int32 i1, j1;
+	if (x0 > y0)
+	{
+		i1 = 1; j1 = 0;
+	}
+	else
+	{
+		i1 = 0; j1 = 1;
+	}
+
+	float x1 = x0 - (float)i1 + G2;
+	float y1 = y0 - (float)j1 + G2;
+	float x2 = x0 - 1 + 2*G2;
+	float y2 = y0 - 1 + 2*G2;
+
+	float w0 = SimplexPerturbWeight(float(0.5) - x0*x0 - y0*y0);
+	float w1 = SimplexPerturbWeight(float(0.5) - x1*x1 - y1*y1);
+	float w2 = SimplexPerturbWeight(float(0.5) - x2*x2 - y2*y2);
+
+	int32 lutPos0 = Index2D_256<THash>(offset, i, j);
+	int32 lutPos1 = Index2D_256<THash>(offset, i + i1, j + j1);
+	int32 lutPos2 = Index2D_256<THash>(offset, i + 1, j + 1);
+
+	warpAmp *= SIMPLEX_PERTURB_SCALE_2D;
+	x += (w0*CELL_2D_X[lutPos0] + w1*CELL_2D_X[lutPos1] + w2*CELL_2D_X[lutPos2]) * warpAmp;
+	y += (w0*CELL_2D_Y[lutPos0] + w1*CELL_2D_Y[lutPos1] + w2*CELL_2D_Y[lutPos2]) * warpAmp;
+}
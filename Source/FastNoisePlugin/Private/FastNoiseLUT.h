@@ -0,0 +1,43 @@
+// FastNoiseLUT.h
+//
+// Lookup tables and constants shared by the scalar kernels in FastNoise.cpp
+// and the vectorized kernels in SIMD/FastNoiseSIMDKernels.inl
+// The tables themselves are defined in FastNoise.cpp
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+extern const float GRAD_X[12];
+extern const float GRAD_Y[12];
+extern const float GRAD_Z[12];
+extern const float GRAD_4D[128];
+extern const float VAL_LUT[256];
+extern const float CELL_2D_X[256];
+extern const float CELL_2D_Y[256];
+extern const float CELL_3D_X[256];
+extern const float CELL_3D_Y[256];
+extern const float CELL_3D_Z[256];
+
+#define X_PRIME 1619
+#define Y_PRIME 31337
+#define Z_PRIME 6971
+#define W_PRIME 1013
+
+static const float F3 = 1 / float(3);
+static const float G3 = 1 / float(6);
+
+//static const float F2 = 1 / float(2);
+//static const float G2 = 1 / float(4);
+
+static const float SQRT3 = float(1.7320508075688772935274463415059);
+static const float F2 = float(0.5) * (SQRT3 - float(1.0));
+static const float G2 = (float(3.0) - SQRT3) / float(6.0);
+
+// Inverse of the largest weight a simplex perturb corner can have, (r^2)^4 at the corner itself, so the warp stays within its amplitude
+static const float SIMPLEX_PERTURB_SCALE_2D = 1 / float(0.0625);
+static const float SIMPLEX_PERTURB_SCALE_3D = 1 / float(0.1296);
+
+// Added to the cellular jitter when bounding the distance to a cell, keeps the bound below the distance
+// the cellular kernels compute despite the rounding of both
+static const float CELLULAR_BOUND_MARGIN = float(1) / 1024;
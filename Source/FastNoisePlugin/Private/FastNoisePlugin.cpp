@@ -1,18 +1,45 @@
 // Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
 
 #include "FastNoisePlugin.h"
+#include "FastNoise.h"
+#include "SIMD/FastNoiseSIMD.h"
+#include "HAL/IConsoleManager.h"
 
 #define LOCTEXT_NAMESPACE "FFastNoisePluginModule"
 
+// Console variables read when a noise's settings are compiled
+static const TCHAR* const FastNoiseVariables[] = { TEXT("fastnoise.SIMDLevel"), TEXT("fastnoise.FractalSetOrder") };
+
+static void OnFastNoiseVariableChanged(IConsoleVariable* variable)
+{
+	UFastNoise::UpdateAllParams();
+}
+
 void FFastNoisePluginModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+
+	// Query the CPU now rather than during the first noise set
+	FastNoiseSIMD::GetSupportedLevel();
+
+	// Noises store the kernel table of the level and the fractal set order in their compiled settings
+	for (const TCHAR* name : FastNoiseVariables)
+	{
+		if (IConsoleVariable* variable = IConsoleManager::Get().FindConsoleVariable(name))
+			variable->SetOnChangedCallback(FConsoleVariableDelegate::CreateStatic(&OnFastNoiseVariableChanged));
+	}
 }
 
 void FFastNoisePluginModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	for (const TCHAR* name : FastNoiseVariables)
+	{
+		if (IConsoleVariable* variable = IConsoleManager::Get().FindConsoleVariable(name))
+			variable->SetOnChangedCallback(FConsoleVariableDelegate());
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
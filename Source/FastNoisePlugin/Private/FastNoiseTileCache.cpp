@@ -0,0 +1,258 @@
+// FastNoiseTileCache.cpp
+//
+// Tiles live in an index linked list ordered by last use, EntryIndices finds them by key
+
+#include "FastNoiseTileCache.h"
+
+FFastNoiseTileCache::FFastNoiseTileCache(int64 maxBytes)
+	: Head(INDEX_NONE)
+	, Tail(INDEX_NONE)
+	, MaxBytes(maxBytes)
+	, ResidentBytes(0)
+	, Hits(0)
+	, Misses(0)
+{
+	check(IsInGameThread());
+	SettingsChangedHandle = UFastNoise::OnSettingsChanged().AddRaw(this, &FFastNoiseTileCache::OnNoiseChanged);
+}
+
+FFastNoiseTileCache::~FFastNoiseTileCache()
+{
+	check(IsInGameThread());
+	UFastNoise::OnSettingsChanged().Remove(SettingsChangedHandle);
+}
+
+FFastNoiseTileRef FFastNoiseTileCache::GetTile2D(const UFastNoise* noise, FIntPoint tile, int32 resolution, float stepSize)
+{
+	check(noise && resolution > 0);
+
+	// The key and the tile come from one snapshot, so a tile is never stored under the hash of other settings
+	FFastNoiseEvaluator evaluator = noise->CreateEvaluator();
+
+	FFastNoiseTileKey key;
+	key.SettingsHash = evaluator.GetSettingsHash();
+	key.Tile = FIntVector(tile.X, tile.Y, 0);
+	key.Resolution = resolution;
+	key.StepSize = stepSize;
+	key.bIs3D = false;
+
+	return GetTile(noise, evaluator, key);
+}
+
+FFastNoiseTileRef FFastNoiseTileCache::GetTile3D(const UFastNoise* noise, FIntVector tile, int32 resolution, float stepSize)
+{
+	check(noise && resolution > 0);
+
+	// The key and the tile come from one snapshot, so a tile is never stored under the hash of other settings
+	FFastNoiseEvaluator evaluator = noise->CreateEvaluator();
+
+	FFastNoiseTileKey key;
+	key.SettingsHash = evaluator.GetSettingsHash();
+	key.Tile = tile;
+	key.Resolution = resolution;
+	key.StepSize = stepSize;
+	key.bIs3D = true;
+
+	return GetTile(noise, evaluator, key);
+}
+
+FFastNoiseTileRef FFastNoiseTileCache::GetTile(const UFastNoise* noise, const FFastNoiseEvaluator& evaluator, const FFastNoiseTileKey& key)
+{
+	{
+		FScopeLock scopeLock(&Lock);
+
+		if (const int32* index = EntryIndices.Find(key))
+		{
+			Hits++;
+			Unlink(*index);
+			LinkFront(*index);
+			return Entries[*index].Noise.ToSharedRef();
+		}
+		Misses++;
+	}
+
+	// Generated without the lock, when two threads miss the same tile the first one to finish is kept
+	const int32 resolution = key.Resolution;
+	const float tileSpan = resolution * key.StepSize;
+	TArray<float>* noiseSet = new TArray<float>();
+
+	if (key.bIs3D)
+	{
+		noiseSet->SetNumUninitialized(resolution * resolution * resolution);
+		evaluator.GetNoiseSet3D(*noiseSet, key.Tile.X * tileSpan, key.Tile.Y * tileSpan, key.Tile.Z * tileSpan, resolution, resolution, resolution, key.StepSize);
+	}
+	else
+	{
+		noiseSet->SetNumUninitialized(resolution * resolution);
+		evaluator.GetNoiseSet2D(*noiseSet, key.Tile.X * tileSpan, key.Tile.Y * tileSpan, resolution, resolution, key.StepSize);
+	}
+
+	TSharedPtr<const TArray<float>, ESPMode::ThreadSafe> tileNoise = MakeShareable(noiseSet);
+
+	FScopeLock scopeLock(&Lock);
+
+	if (const int32* existing = EntryIndices.Find(key))
+		return Entries[*existing].Noise.ToSharedRef();
+
+	int32 index = FreeEntries.Num() ? FreeEntries.Pop() : Entries.AddDefaulted();
+	FEntry& entry = Entries[index];
+	entry.Key = key;
+	entry.Noise = tileNoise;
+
+	LinkFront(index);
+	EntryIndices.Add(key, index);
+	ResidentBytes += noiseSet->GetAllocatedSize();
+
+	// Remember which noises the hash depends on, so editing any of them drops the tile
+	TArray<const UFastNoise*> chain;
+	for (const UFastNoise* layer = noise; layer && !chain.Contains(layer); )
+	{
+		chain.Add(layer);
+		NoiseSettingsHashes.FindOrAdd(layer).AddUnique(key.SettingsHash);
+
+		layer = layer->GetNoiseType() == EFNNoiseType::Cellular && layer->GetCellularReturnType() == EFNCellularReturnType::NoiseLookup ? layer->GetCellularNoiseLookup() : nullptr;
+	}
+
+	EvictToBudget();
+
+	return tileNoise.ToSharedRef();
+}
+
+void FFastNoiseTileCache::LinkFront(int32 index)
+{
+	FEntry& entry = Entries[index];
+	entry.Prev = INDEX_NONE;
+	entry.Next = Head;
+
+	if (Head != INDEX_NONE)
+		Entries[Head].Prev = index;
+	else
+		Tail = index;
+
+	Head = index;
+}
+
+void FFastNoiseTileCache::Unlink(int32 index)
+{
+	FEntry& entry = Entries[index];
+
+	if (entry.Prev != INDEX_NONE)
+		Entries[entry.Prev].Next = entry.Next;
+	else
+		Head = entry.Next;
+
+	if (entry.Next != INDEX_NONE)
+		Entries[entry.Next].Prev = entry.Prev;
+	else
+		Tail = entry.Prev;
+
+	entry.Prev = entry.Next = INDEX_NONE;
+}
+
+void FFastNoiseTileCache::RemoveEntry(int32 index)
+{
+	FEntry& entry = Entries[index];
+
+	Unlink(index);
+	EntryIndices.Remove(entry.Key);
+	ResidentBytes -= entry.Noise->GetAllocatedSize();
+
+	// Callers holding the tile keep it alive, the cache only lets go of it
+	entry.Noise.Reset();
+	FreeEntries.Add(index);
+}
+
+void FFastNoiseTileCache::EvictToBudget()
+{
+	while (ResidentBytes > MaxBytes && Tail != INDEX_NONE)
+	{
+		RemoveEntry(Tail);
+	}
+}
+
+void FFastNoiseTileCache::OnNoiseChanged(const UFastNoise* noise)
+{
+	FScopeLock scopeLock(&Lock);
+
+	const TArray<uint64>* settingsHashes = NoiseSettingsHashes.Find(noise);
+	if (!settingsHashes)
+		return;
+
+	for (int32 index = Head; index != INDEX_NONE; )
+	{
+		const int32 next = Entries[index].Next;
+
+		if (settingsHashes->Contains(Entries[index].Key.SettingsHash))
+			RemoveEntry(index);
+
+		index = next;
+	}
+
+	NoiseSettingsHashes.Remove(noise);
+}
+
+void FFastNoiseTileCache::SetMaxBytes(int64 maxBytes)
+{
+	FScopeLock scopeLock(&Lock);
+
+	MaxBytes = maxBytes;
+	EvictToBudget();
+}
+
+int64 FFastNoiseTileCache::GetMaxBytes() const
+{
+	FScopeLock scopeLock(&Lock);
+	return MaxBytes;
+}
+
+void FFastNoiseTileCache::Empty()
+{
+	FScopeLock scopeLock(&Lock);
+
+	Entries.Empty();
+	FreeEntries.Empty();
+	EntryIndices.Empty();
+	NoiseSettingsHashes.Empty();
+	Head = Tail = INDEX_NONE;
+	ResidentBytes = 0;
+}
+
+int64 FFastNoiseTileCache::GetResidentBytes() const
+{
+	FScopeLock scopeLock(&Lock);
+	return ResidentBytes;
+}
+
+int32 FFastNoiseTileCache::GetNumTiles() const
+{
+	FScopeLock scopeLock(&Lock);
+	return EntryIndices.Num();
+}
+
+float FFastNoiseTileCache::GetHitRate() const
+{
+	FScopeLock scopeLock(&Lock);
+
+	const uint64 lookups = Hits + Misses;
+	return lookups ? (float)((double)Hits / lookups) : 0.0f;
+}
+
+uint64 FFastNoiseTileCache::GetHitCount() const
+{
+	FScopeLock scopeLock(&Lock);
+	return Hits;
+}
+
+uint64 FFastNoiseTileCache::GetMissCount() const
+{
+	FScopeLock scopeLock(&Lock);
+	return Misses;
+}
+
+void FFastNoiseTileCache::ResetStats()
+{
+	FScopeLock scopeLock(&Lock);
+
+	Hits = 0;
+	Misses = 0;
+}
@@ -0,0 +1,166 @@
+// FastNoiseSIMD.cpp
+//
+// Selects the kernel table used by the UFastNoise noise set functions
+// The CPU is queried once, fastnoise.SIMDLevel can lower the level, FFastNoisePluginModule recompiles the loaded noises when it changes
+
+#include "SIMD/FastNoiseSIMD.h"
+#include "HAL/IConsoleManager.h"
+
+#if FN_SIMD_SSE2
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+static TAutoConsoleVariable<int32> CVarFastNoiseSIMDLevel(
+	TEXT("fastnoise.SIMDLevel"),
+	-1,
+	TEXT("Highest instruction set used by the FastNoise noise set functions.\n")
+	TEXT(" -1: widest level supported by the CPU (default)\n")
+	TEXT("  0: scalar, the same code as GetNoise2D/GetNoise3D\n")
+	TEXT("  1: SSE2\n")
+	TEXT("  2: SSE4.1\n")
+	TEXT("  3: AVX2\n")
+	TEXT("  4: AVX-512\n")
+	TEXT("Levels the CPU does not support fall back to the widest one it does.\n")
+	TEXT("Changing it recompiles every loaded noise, evaluators created earlier keep the level they were created with."),
+	ECVF_Default);
+
+#if FN_SIMD_SSE2
+static void CPUID(int32 leaf, int32 subLeaf, uint32 (&registers)[4])
+{
+#if defined(_MSC_VER)
+	__cpuidex((int*)registers, leaf, subLeaf);
+#else
+	__cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+// Register state the OS saves on context switches, AVX is only usable if it includes the YMM (and ZMM) registers
+static uint64 XGetBV()
+{
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	uint32 eax, edx;
+	__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((uint64)edx << 32) | eax;
+#endif
+}
+
+static int32 DetectLevel()
+{
+	uint32 registers[4];
+
+	CPUID(0, 0, registers);
+	uint32 maxLeaf = registers[0];
+
+	CPUID(1, 0, registers);
+	bool bSSE41 = (registers[2] & (1 << 19)) != 0;
+	bool bOSXSAVE = (registers[2] & (1 << 27)) != 0;
+	bool bAVX = (registers[2] & (1 << 28)) != 0;
+
+	if (!bSSE41)
+		return FN_SIMD_LEVEL_SSE2;
+
+	if (!bOSXSAVE || !bAVX || maxLeaf < 7)
+		return FN_SIMD_LEVEL_SSE41;
+
+	uint64 xcr0 = XGetBV();
+	if ((xcr0 & 0x6) != 0x6)
+		return FN_SIMD_LEVEL_SSE41;
+
+	CPUID(7, 0, registers);
+	bool bAVX2 = (registers[1] & (1 << 5)) != 0;
+	bool bAVX512F = (registers[1] & (1 << 16)) != 0;
+
+	if (!bAVX2)
+		return FN_SIMD_LEVEL_SSE41;
+
+	// Opmask, upper ZMM0-15 and ZMM16-31 state
+	if (!bAVX512F || (xcr0 & 0xe0) != 0xe0)
+		return FN_SIMD_LEVEL_AVX2;
+
+	return FN_SIMD_LEVEL_AVX512;
+}
+#else
+static int32 DetectLevel()
+{
+	return FN_SIMD_LEVEL_SCALAR;
+}
+#endif
+
+int32 FastNoiseSIMD::GetSupportedLevel()
+{
+	static const int32 SupportedLevel = DetectLevel();
+	return SupportedLevel;
+}
+
+int32 FastNoiseSIMD::GetActiveLevel()
+{
+	int32 supportedLevel = GetSupportedLevel();
+	int32 forcedLevel = CVarFastNoiseSIMDLevel.GetValueOnAnyThread();
+
+	return forcedLevel < 0 ? supportedLevel : FMath::Min(forcedLevel, supportedLevel);
+}
+
+const FFastNoiseSIMDKernels* FastNoiseSIMD::GetKernels(EFNNoiseType noiseType)
+{
+	switch (noiseType)
+	{
+	case EFNNoiseType::Value:
+	case EFNNoiseType::ValueFractal:
+	case EFNNoiseType::Perlin:
+	case EFNNoiseType::PerlinFractal:
+	case EFNNoiseType::Simplex:
+	case EFNNoiseType::SimplexFractal:
+	case EFNNoiseType::Cellular:
+		break;
+	default:
+		return nullptr;
+	}
+
+	return GetLevelKernels();
+}
+
+// Kernels compiled for level, nullptr for the scalar level or one the build does not have
+static const FFastNoiseSIMDKernels* GetKernelsOfLevel(int32 level)
+{
+	switch (level)
+	{
+#if FN_SIMD_AVX512
+	case FN_SIMD_LEVEL_AVX512:
+		return &FastNoiseSIMD_AVX512::Kernels;
+#endif
+#if FN_SIMD_AVX2
+	case FN_SIMD_LEVEL_AVX2:
+		return &FastNoiseSIMD_AVX2::Kernels;
+#endif
+#if FN_SIMD_SSE41
+	case FN_SIMD_LEVEL_SSE41:
+		return &FastNoiseSIMD_SSE41::Kernels;
+#endif
+#if FN_SIMD_SSE2
+	case FN_SIMD_LEVEL_SSE2:
+		return &FastNoiseSIMD_SSE2::Kernels;
+#endif
+	default:
+		return nullptr;
+	}
+}
+
+const FFastNoiseSIMDKernels* FastNoiseSIMD::GetLevelKernels()
+{
+	return GetKernelsOfLevel(GetActiveLevel());
+}
+
+const FFastNoiseSIMDKernels* FastNoiseSIMD::GetFractalKernels(EFNHashType hashType)
+{
+	// A permutation hash reads the table three times in a row per corner, AVX2 and AVX-512 gathers make that chain slower than the scalar loop
+	if (hashType == EFNHashType::Permutation)
+		return GetKernelsOfLevel(FMath::Min(GetActiveLevel(), FN_SIMD_LEVEL_SSE41));
+
+	return GetLevelKernels();
+}
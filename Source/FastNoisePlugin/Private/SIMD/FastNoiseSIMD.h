@@ -0,0 +1,119 @@
+// FastNoiseSIMD.h
+//
+// Vectorized noise kernels used by the UFastNoise noise set functions
+// Each supported instruction set compiles SIMD/FastNoiseSIMDKernels.inl into its own
+// FastNoiseSIMD_<Level>.cpp and exposes the result as a FFastNoiseSIMDKernels table
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FastNoise.h"
+
+// Every level is compiled on x64 and the widest one the CPU supports is picked at runtime
+// SSE2 is part of the x64 baseline, the other levels compile their kernels for a higher target
+#if defined(_M_X64) || defined(__x86_64__)
+#define FN_SIMD_SSE2 1
+#define FN_SIMD_SSE41 1
+#define FN_SIMD_AVX2 1
+#define FN_SIMD_AVX512 1
+#else
+#define FN_SIMD_SSE2 0
+#define FN_SIMD_SSE41 0
+#define FN_SIMD_AVX2 0
+#define FN_SIMD_AVX512 0
+#endif
+
+#define FN_SIMD_LEVEL_SCALAR 0
+#define FN_SIMD_LEVEL_SSE2 1
+#define FN_SIMD_LEVEL_SSE41 2
+#define FN_SIMD_LEVEL_AVX2 3
+#define FN_SIMD_LEVEL_AVX512 4
+
+// Wrap the kernels of a level above the compiler baseline, MSVC accepts any intrinsic without annotation
+// Floating point contraction stays off, AVX-512 implies FMA and fused multiply-adds would no longer match the scalar results
+#if defined(__clang__)
+#define FN_SIMD_TARGET_BEGIN_SSE41 _Pragma("STDC FP_CONTRACT OFF") _Pragma("clang attribute push(__attribute__((target(\"sse4.1\"))), apply_to = function)")
+#define FN_SIMD_TARGET_BEGIN_AVX2 _Pragma("STDC FP_CONTRACT OFF") _Pragma("clang attribute push(__attribute__((target(\"avx2\"))), apply_to = function)")
+#define FN_SIMD_TARGET_BEGIN_AVX512 _Pragma("STDC FP_CONTRACT OFF") _Pragma("clang attribute push(__attribute__((target(\"avx512f\"))), apply_to = function)")
+#define FN_SIMD_TARGET_END _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+#define FN_SIMD_TARGET_BEGIN_SSE41 _Pragma("GCC push_options") _Pragma("GCC target(\"sse4.1\")") _Pragma("GCC optimize(\"fp-contract=off\")")
+#define FN_SIMD_TARGET_BEGIN_AVX2 _Pragma("GCC push_options") _Pragma("GCC target(\"avx2\")") _Pragma("GCC optimize(\"fp-contract=off\")")
+#define FN_SIMD_TARGET_BEGIN_AVX512 _Pragma("GCC push_options") _Pragma("GCC target(\"avx512f\")") _Pragma("GCC optimize(\"fp-contract=off\")")
+#define FN_SIMD_TARGET_END _Pragma("GCC pop_options")
+#else
+#define FN_SIMD_TARGET_BEGIN_SSE41
+#define FN_SIMD_TARGET_BEGIN_AVX2
+#define FN_SIMD_TARGET_BEGIN_AVX512
+#define FN_SIMD_TARGET_END
+#endif
+
+// Entry points of one instruction set
+// Set coordinates are already scaled by frequency, xCoords must be readable up to xSize + FastNoiseSIMD::MaxVectorWidth
+// Point coordinates are unscaled, matching GetNoise2D(...)/GetNoise3D(...)
+struct FFastNoiseSIMDKernels
+{
+	int32 VectorWidth;
+
+	void (*FillSet2D)(const FFastNoiseParams& params, float* noiseSet, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize);
+	void (*FillSet3D)(const FFastNoiseParams& params, float* noiseSet, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize);
+
+	void (*FillPointSet2D)(const FFastNoiseParams& params, float* noiseSet, const float* xPoints, const float* yPoints, int32 count);
+	void (*FillPointSet3D)(const FFastNoiseParams& params, float* noiseSet, const float* xPoints, const float* yPoints, const float* zPoints, int32 count);
+
+	// Cellular NoiseLookup only, writes the lattice coordinates of the closest cell to every sample instead of a noise value
+	void (*FillCellularCellSet2D)(const FFastNoiseParams& params, int32* xCell, int32* yCell, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize);
+	void (*FillCellularCellSet3D)(const FFastNoiseParams& params, int32* xCell, int32* yCell, int32* zCell, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize);
+
+	void (*FillCellularCellPointSet2D)(const FFastNoiseParams& params, int32* xCell, int32* yCell, const float* xPoints, const float* yPoints, int32 count);
+	void (*FillCellularCellPointSet3D)(const FFastNoiseParams& params, int32* xCell, int32* yCell, int32* zCell, const float* xPoints, const float* yPoints, const float* zPoints, int32 count);
+
+	// Every output of the cellular search at each point, whatever the noise type, outputs sampleSet leaves empty are skipped
+	void (*FillCellularSamplePointSet2D)(const FFastNoiseParams& params, const FFastNoiseCellularSampleSet& sampleSet, const float* xPoints, const float* yPoints, int32 count);
+	void (*FillCellularSamplePointSet3D)(const FFastNoiseParams& params, const FFastNoiseCellularSampleSet& sampleSet, const float* xPoints, const float* yPoints, const float* zPoints, int32 count);
+
+	// GradientPerturb{Fractal} of every point, the output may alias the input to warp in place
+	void (*GradientPerturbPointSet2D)(const FFastNoiseParams& params, float* xOut, float* yOut, const float* xPoints, const float* yPoints, int32 count, bool fractal);
+	void (*GradientPerturbPointSet3D)(const FFastNoiseParams& params, float* xOut, float* yOut, float* zOut, const float* xPoints, const float* yPoints, const float* zPoints, int32 count, bool fractal);
+
+	// One ValueFractal, PerlinFractal or SimplexFractal sample at frequency scaled coordinates, every octave in its own lane
+	float (*SampleFractal2D)(const FFastNoiseParams& params, EFNNoiseType noiseType, float x, float y);
+	float (*SampleFractal3D)(const FFastNoiseParams& params, EFNNoiseType noiseType, float x, float y, float z);
+};
+
+#if FN_SIMD_SSE2
+namespace FastNoiseSIMD_SSE2 { extern const FFastNoiseSIMDKernels Kernels; }
+#endif
+#if FN_SIMD_SSE41
+namespace FastNoiseSIMD_SSE41 { extern const FFastNoiseSIMDKernels Kernels; }
+#endif
+#if FN_SIMD_AVX2
+namespace FastNoiseSIMD_AVX2 { extern const FFastNoiseSIMDKernels Kernels; }
+#endif
+#if FN_SIMD_AVX512
+namespace FastNoiseSIMD_AVX512 { extern const FFastNoiseSIMDKernels Kernels; }
+#endif
+
+namespace FastNoiseSIMD
+{
+	// Widest vector width of any kernel table, used to pad set coordinates
+	static const int32 MaxVectorWidth = 16;
+
+	// Highest FN_SIMD_LEVEL_* supported by both the build and the CPU, detected once on first use
+	int32 GetSupportedLevel();
+
+	// Level used by the noise set functions, the supported level unless fastnoise.SIMDLevel lowers it
+	int32 GetActiveLevel();
+
+	// Returns the kernels of the active level for noiseType, or nullptr if it has to use the scalar implementation
+	// Called when FFastNoiseParams are compiled, the result is stored in FFastNoiseParams::Kernels
+	const FFastNoiseSIMDKernels* GetKernels(EFNNoiseType noiseType);
+
+	// Returns the kernels of the active level whatever the noise type, or nullptr for the scalar implementation
+	// Used by the GradientPerturb sets, stored in FFastNoiseParams::PerturbKernels
+	const FFastNoiseSIMDKernels* GetLevelKernels();
+
+	// Returns the kernels the single point fractals of hashType sample their octaves with, nullptr for the scalar implementation
+	// Stored in FFastNoiseParams::FractalKernels
+	const FFastNoiseSIMDKernels* GetFractalKernels(EFNHashType hashType);
+}
@@ -0,0 +1,1875 @@
+// FastNoiseSIMDKernels.inl
+//
+// Vectorized counterparts of the UFastNoise kernels in FastNoise.cpp
+// Included inside the namespace of a FastNoiseSIMD_<Level>.cpp after FastNoiseSIMDTypes.inl
+//
+// Every kernel performs the same float operations in the same order as the scalar version,
+// so a noise set returns the same values as the equivalent GetNoise2D(...)/GetNoise3D(...) calls
+
+static FORCEINLINE FSIMDInt FastFloor(FSIMDFloat f) { FSIMDInt i = ToInt(f); return Select(f >= 0, i, i - 1); }
+
+static FORCEINLINE FSIMDInt FastRound(FSIMDFloat f) { return Select(f >= 0, ToInt(f + float(0.5)), ToInt(f - float(0.5))); }
+static FORCEINLINE FSIMDFloat Lerp(FSIMDFloat a, FSIMDFloat b, FSIMDFloat t) { return a + t * (b - a); }
+
+// Interpolation
+// Selected once per set as a template argument instead of switching on EFNInterp per sample
+struct FInterpLinear { static FORCEINLINE FSIMDFloat Apply(FSIMDFloat t) { return t; } };
+struct FInterpHermite { static FORCEINLINE FSIMDFloat Apply(FSIMDFloat t) { return t*t*(3 - 2 * t); } };
+struct FInterpQuintic { static FORCEINLINE FSIMDFloat Apply(FSIMDFloat t) { return t*t*t*(t*(t * 6 - 15) + 10); } };
+
+// Cells offset by the lattice origin of the large world path, as FFastNoiseParams::LatticeX/Y/Z
+static FORCEINLINE FSIMDInt LatticeX(const FFastNoiseParams& params, FSIMDInt x) { return x + (int32)params.LatticeOriginX; }
+static FORCEINLINE FSIMDInt LatticeY(const FFastNoiseParams& params, FSIMDInt y) { return y + (int32)params.LatticeOriginY; }
+static FORCEINLINE FSIMDInt LatticeZ(const FFastNoiseParams& params, FSIMDInt z) { return z + (int32)params.LatticeOriginZ; }
+
+// Integer hashing, the same bits as FFastNoiseParams::Hash2D/3D
+static FORCEINLINE FSIMDInt HashFinish(FSIMDInt hash)
+{
+	FSIMDInt n = hash * hash * hash * 60493;
+	return (n >> 13) ^ n;
+}
+
+// offset may differ per lane, the single point fractals sample another octave in every lane
+static FORCEINLINE FSIMDInt HashSeed(const FFastNoiseParams& params, FSIMDInt offset)
+{
+	return FSIMDInt(params.Seed) + offset;
+}
+
+static FORCEINLINE FSIMDInt Hash2D(const FFastNoiseParams& params, FSIMDInt offset, FSIMDInt x, FSIMDInt y)
+{
+	FSIMDInt hash = HashSeed(params, offset);
+	hash = hash ^ (x * X_PRIME);
+	hash = hash ^ (y * Y_PRIME);
+
+	return HashFinish(hash);
+}
+static FORCEINLINE FSIMDInt Hash3D(const FFastNoiseParams& params, FSIMDInt offset, FSIMDInt x, FSIMDInt y, FSIMDInt z)
+{
+	FSIMDInt hash = HashSeed(params, offset);
+	hash = hash ^ (x * X_PRIME);
+	hash = hash ^ (y * Y_PRIME);
+	hash = hash ^ (z * Z_PRIME);
+
+	return HashFinish(hash);
+}
+
+// Matches HashGrad in FastNoise.cpp, the gradient is selected from the hash bits without a gather
+static FORCEINLINE FSIMDFloat HashGrad(FSIMDInt hash, FSIMDFloat xd, FSIMDFloat yd, FSIMDFloat zd)
+{
+	FSIMDInt h = hash & 15;
+	FSIMDFloat u = Select((h & 8) == 0, xd, yd);
+	FSIMDFloat v = Select((h & 12) == 0, yd, Select((h & 13) == 12, xd, zd));
+
+	return Select((h & 1) == 1, FSIMDFloat(0.0f) - u, u) + Select((h & 2) == 2, FSIMDFloat(0.0f) - v, v);
+}
+
+static FORCEINLINE FSIMDInt Index2D_12(const FFastNoiseParams& params, FSIMDInt offset, FSIMDInt x, FSIMDInt y)
+{
+	return Gather(params.Perm12, (x & 0xff) + Gather(params.Perm, (y & 0xff) + offset));
+}
+static FORCEINLINE FSIMDInt Index3D_12(const FFastNoiseParams& params, FSIMDInt offset, FSIMDInt x, FSIMDInt y, FSIMDInt z)
+{
+	return Gather(params.Perm12, (x & 0xff) + Gather(params.Perm, (y & 0xff) + Gather(params.Perm, (z & 0xff) + offset)));
+}
+
+static FORCEINLINE FSIMDInt Index2D_256(const FFastNoiseParams& params, FSIMDInt offset, FSIMDInt x, FSIMDInt y)
+{
+	if (params.HashType == EFNHashType::Integer)
+		return Hash2D(params, offset, x, y) & 0xff;
+
+	return Gather(params.Perm, (x & 0xff) + Gather(params.Perm, (y & 0xff) + offset));
+}
+static FORCEINLINE FSIMDInt Index3D_256(const FFastNoiseParams& params, FSIMDInt offset, FSIMDInt x, FSIMDInt y, FSIMDInt z)
+{
+	if (params.HashType == EFNHashType::Integer)
+		return Hash3D(params, offset, x, y, z) & 0xff;
+
+	return Gather(params.Perm, (x & 0xff) + Gather(params.Perm, (y & 0xff) + Gather(params.Perm, (z & 0xff) + offset)));
+}
+
+static FORCEINLINE FSIMDFloat ValCoord2D(FSIMDInt seed, FSIMDInt x, FSIMDInt y)
+{
+	FSIMDInt n = seed;
+	n = n ^ (x * X_PRIME);
+	n = n ^ (y * Y_PRIME);
+
+	return ToFloat(n * n * n * 60493) / float(2147483648);
+}
+static FORCEINLINE FSIMDFloat ValCoord3D(FSIMDInt seed, FSIMDInt x, FSIMDInt y, FSIMDInt z)
+{
+	FSIMDInt n = seed;
+	n = n ^ (x * X_PRIME);
+	n = n ^ (y * Y_PRIME);
+	n = n ^ (z * Z_PRIME);
+
+	return ToFloat(n * n * n * 60493) / float(2147483648);
+}
+
+static FORCEINLINE FSIMDFloat ValCoord2DFast(const FFastNoiseParams& params, FSIMDInt offset, FSIMDInt x, FSIMDInt y)
+{
+	if (params.HashType == EFNHashType::Integer)
+		return ValCoord2D(HashSeed(params, offset), x, y);
+
+	return Gather(VAL_LUT, Index2D_256(params, offset, x, y));
+}
+static FORCEINLINE FSIMDFloat ValCoord3DFast(const FFastNoiseParams& params, FSIMDInt offset, FSIMDInt x, FSIMDInt y, FSIMDInt z)
+{
+	if (params.HashType == EFNHashType::Integer)
+		return ValCoord3D(HashSeed(params, offset), x, y, z);
+
+	return Gather(VAL_LUT, Index3D_256(params, offset, x, y, z));
+}
+
+static FORCEINLINE FSIMDFloat GradCoord2D(const FFastNoiseParams& params, FSIMDInt offset, FSIMDInt x, FSIMDInt y, FSIMDFloat xd, FSIMDFloat yd)
+{
+	if (params.HashType == EFNHashType::Integer)
+		return HashGrad(Hash2D(params, offset, x, y), xd, yd, 0.0f);
+
+	FSIMDInt lutPos = Index2D_12(params, offset, x, y);
+
+	return xd*Gather(GRAD_X, lutPos) + yd*Gather(GRAD_Y, lutPos);
+}
+static FORCEINLINE FSIMDFloat GradCoord3D(const FFastNoiseParams& params, FSIMDInt offset, FSIMDInt x, FSIMDInt y, FSIMDInt z, FSIMDFloat xd, FSIMDFloat yd, FSIMDFloat zd)
+{
+	if (params.HashType == EFNHashType::Integer)
+		return HashGrad(Hash3D(params, offset, x, y, z), xd, yd, zd);
+
+	FSIMDInt lutPos = Index3D_12(params, offset, x, y, z);
+
+	return xd*Gather(GRAD_X, lutPos) + yd*Gather(GRAD_Y, lutPos) + zd*Gather(GRAD_Z, lutPos);
+}
+
+// Fractal
+// Octave combinators shared by every fractal noise, matching Single*FractalFBM/Billow/RigidMulti
+template <EFNFractalType FractalType>
+static FORCEINLINE FSIMDFloat FractalOctave(FSIMDFloat noise)
+{
+	switch (FractalType)
+	{
+	case EFNFractalType::Billow:
+		return FastAbs(noise) * 2 - 1;
+	case EFNFractalType::RigidMulti:
+		return 1 - FastAbs(noise);
+	default:
+		return noise;
+	}
+}
+
+template <EFNFractalType FractalType, typename FNoiseFunc>
+static FORCEINLINE FSIMDFloat SingleFractal(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FNoiseFunc noiseFunc)
+{
+	FSIMDFloat sum = FractalOctave<FractalType>(noiseFunc(params.OctaveOffset(0), x, y));
+	float amp = 1;
+	int32 i = 0;
+
+	while (++i < params.FractalOctaves)
+	{
+		x *= params.FractalLacunarity;
+		y *= params.FractalLacunarity;
+
+		amp *= params.FractalGain;
+		if (i == params.FractalOctaves - 1)
+			amp *= params.FractalFade;
+		if (FractalType == EFNFractalType::RigidMulti)
+			sum -= FractalOctave<FractalType>(noiseFunc(params.OctaveOffset(i), x, y)) * amp;
+		else
+			sum += FractalOctave<FractalType>(noiseFunc(params.OctaveOffset(i), x, y)) * amp;
+	}
+
+	return FractalType == EFNFractalType::RigidMulti ? sum : sum * params.FractalBounding;
+}
+
+template <EFNFractalType FractalType, typename FNoiseFunc>
+static FORCEINLINE FSIMDFloat SingleFractal(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z, FNoiseFunc noiseFunc)
+{
+	FSIMDFloat sum = FractalOctave<FractalType>(noiseFunc(params.OctaveOffset(0), x, y, z));
+	float amp = 1;
+	int32 i = 0;
+
+	while (++i < params.FractalOctaves)
+	{
+		x *= params.FractalLacunarity;
+		y *= params.FractalLacunarity;
+		z *= params.FractalLacunarity;
+
+		amp *= params.FractalGain;
+		if (i == params.FractalOctaves - 1)
+			amp *= params.FractalFade;
+		if (FractalType == EFNFractalType::RigidMulti)
+			sum -= FractalOctave<FractalType>(noiseFunc(params.OctaveOffset(i), x, y, z)) * amp;
+		else
+			sum += FractalOctave<FractalType>(noiseFunc(params.OctaveOffset(i), x, y, z)) * amp;
+	}
+
+	return FractalType == EFNFractalType::RigidMulti ? sum : sum * params.FractalBounding;
+}
+
+// Value Noise
+template <typename TInterp>
+static FORCEINLINE FSIMDFloat SingleValue(const FFastNoiseParams& params, FSIMDInt offset, FSIMDFloat x, FSIMDFloat y)
+{
+	FSIMDInt x0 = FastFloor(x);
+	FSIMDInt y0 = FastFloor(y);
+
+	FSIMDFloat xs = TInterp::Apply(x - ToFloat(x0));
+	FSIMDFloat ys = TInterp::Apply(y - ToFloat(y0));
+
+	x0 = LatticeX(params, x0);
+	y0 = LatticeY(params, y0);
+	FSIMDInt x1 = x0 + 1;
+	FSIMDInt y1 = y0 + 1;
+
+	FSIMDFloat xf0 = Lerp(ValCoord2DFast(params, offset, x0, y0), ValCoord2DFast(params, offset, x1, y0), xs);
+	FSIMDFloat xf1 = Lerp(ValCoord2DFast(params, offset, x0, y1), ValCoord2DFast(params, offset, x1, y1), xs);
+
+	return Lerp(xf0, xf1, ys);
+}
+
+template <typename TInterp>
+static FORCEINLINE FSIMDFloat SingleValue(const FFastNoiseParams& params, FSIMDInt offset, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z)
+{
+	FSIMDInt x0 = FastFloor(x);
+	FSIMDInt y0 = FastFloor(y);
+	FSIMDInt z0 = FastFloor(z);
+
+	FSIMDFloat xs = TInterp::Apply(x - ToFloat(x0));
+	FSIMDFloat ys = TInterp::Apply(y - ToFloat(y0));
+	FSIMDFloat zs = TInterp::Apply(z - ToFloat(z0));
+
+	x0 = LatticeX(params, x0);
+	y0 = LatticeY(params, y0);
+	z0 = LatticeZ(params, z0);
+	FSIMDInt x1 = x0 + 1;
+	FSIMDInt y1 = y0 + 1;
+	FSIMDInt z1 = z0 + 1;
+
+	FSIMDFloat xf00 = Lerp(ValCoord3DFast(params, offset, x0, y0, z0), ValCoord3DFast(params, offset, x1, y0, z0), xs);
+	FSIMDFloat xf10 = Lerp(ValCoord3DFast(params, offset, x0, y1, z0), ValCoord3DFast(params, offset, x1, y1, z0), xs);
+	FSIMDFloat xf01 = Lerp(ValCoord3DFast(params, offset, x0, y0, z1), ValCoord3DFast(params, offset, x1, y0, z1), xs);
+	FSIMDFloat xf11 = Lerp(ValCoord3DFast(params, offset, x0, y1, z1), ValCoord3DFast(params, offset, x1, y1, z1), xs);
+
+	FSIMDFloat yf0 = Lerp(xf00, xf10, ys);
+	FSIMDFloat yf1 = Lerp(xf01, xf11, ys);
+
+	return Lerp(yf0, yf1, zs);
+}
+
+// Perlin Noise
+template <typename TInterp>
+static FORCEINLINE FSIMDFloat SinglePerlin(const FFastNoiseParams& params, FSIMDInt offset, FSIMDFloat x, FSIMDFloat y)
+{
+	FSIMDInt x0 = FastFloor(x);
+	FSIMDInt y0 = FastFloor(y);
+
+	FSIMDFloat xd0 = x - ToFloat(x0);
+	FSIMDFloat yd0 = y - ToFloat(y0);
+	FSIMDFloat xd1 = xd0 - 1;
+	FSIMDFloat yd1 = yd0 - 1;
+
+	x0 = LatticeX(params, x0);
+	y0 = LatticeY(params, y0);
+	FSIMDInt x1 = x0 + 1;
+	FSIMDInt y1 = y0 + 1;
+
+	FSIMDFloat xs = TInterp::Apply(xd0);
+	FSIMDFloat ys = TInterp::Apply(yd0);
+
+	FSIMDFloat xf0 = Lerp(GradCoord2D(params, offset, x0, y0, xd0, yd0), GradCoord2D(params, offset, x1, y0, xd1, yd0), xs);
+	FSIMDFloat xf1 = Lerp(GradCoord2D(params, offset, x0, y1, xd0, yd1), GradCoord2D(params, offset, x1, y1, xd1, yd1), xs);
+
+	return Lerp(xf0, xf1, ys);
+}
+
+template <typename TInterp>
+static FORCEINLINE FSIMDFloat SinglePerlin(const FFastNoiseParams& params, FSIMDInt offset, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z)
+{
+	FSIMDInt x0 = FastFloor(x);
+	FSIMDInt y0 = FastFloor(y);
+	FSIMDInt z0 = FastFloor(z);
+
+	FSIMDFloat xd0 = x - ToFloat(x0);
+	FSIMDFloat yd0 = y - ToFloat(y0);
+	FSIMDFloat zd0 = z - ToFloat(z0);
+	FSIMDFloat xd1 = xd0 - 1;
+	FSIMDFloat yd1 = yd0 - 1;
+	FSIMDFloat zd1 = zd0 - 1;
+
+	x0 = LatticeX(params, x0);
+	y0 = LatticeY(params, y0);
+	z0 = LatticeZ(params, z0);
+	FSIMDInt x1 = x0 + 1;
+	FSIMDInt y1 = y0 + 1;
+	FSIMDInt z1 = z0 + 1;
+
+	FSIMDFloat xs = TInterp::Apply(xd0);
+	FSIMDFloat ys = TInterp::Apply(yd0);
+	FSIMDFloat zs = TInterp::Apply(zd0);
+
+	FSIMDFloat xf00 = Lerp(GradCoord3D(params, offset, x0, y0, z0, xd0, yd0, zd0), GradCoord3D(params, offset, x1, y0, z0, xd1, yd0, zd0), xs);
+	FSIMDFloat xf10 = Lerp(GradCoord3D(params, offset, x0, y1, z0, xd0, yd1, zd0), GradCoord3D(params, offset, x1, y1, z0, xd1, yd1, zd0), xs);
+	FSIMDFloat xf01 = Lerp(GradCoord3D(params, offset, x0, y0, z1, xd0, yd0, zd1), GradCoord3D(params, offset, x1, y0, z1, xd1, yd0, zd1), xs);
+	FSIMDFloat xf11 = Lerp(GradCoord3D(params, offset, x0, y1, z1, xd0, yd1, zd1), GradCoord3D(params, offset, x1, y1, z1, xd1, yd1, zd1), xs);
+
+	FSIMDFloat yf0 = Lerp(xf00, xf10, ys);
+	FSIMDFloat yf1 = Lerp(xf01, xf11, ys);
+
+	return Lerp(yf0, yf1, zs);
+}
+
+// Simplex Noise
+static FORCEINLINE FSIMDFloat SingleSimplex(const FFastNoiseParams& params, FSIMDInt offset, FSIMDFloat x, FSIMDFloat y)
+{
+	FSIMDFloat t = (x + y) * F2;
+	FSIMDInt i = FastFloor(x + t);
+	FSIMDInt j = FastFloor(y + t);
+
+	t = ToFloat(i + j) * G2;
+	FSIMDFloat X0 = ToFloat(i) - t;
+	FSIMDFloat Y0 = ToFloat(j) - t;
+
+	FSIMDFloat x0 = x - X0;
+	FSIMDFloat y0 = y - Y0;
+
+	i = LatticeX(params, i);
+	j = LatticeY(params, j);
+
+	FSIMDMask xGreater = x0 > y0;
+	FSIMDInt i1 = Select(xGreater, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt j1 = Select(xGreater, FSIMDInt(0), FSIMDInt(1));
+
+	FSIMDFloat x1 = x0 - ToFloat(i1) + G2;
+	FSIMDFloat y1 = y0 - ToFloat(j1) + G2;
+	FSIMDFloat x2 = x0 - 1 + 2*G2;
+	FSIMDFloat y2 = y0 - 1 + 2*G2;
+
+	// Corners outside the kernel radius (t < 0) contribute nothing
+	FSIMDFloat t0 = float(0.5) - x0*x0 - y0*y0;
+	FSIMDFloat t1 = float(0.5) - x1*x1 - y1*y1;
+	FSIMDFloat t2 = float(0.5) - x2*x2 - y2*y2;
+
+	FSIMDMask outside0 = t0 < 0;
+	FSIMDMask outside1 = t1 < 0;
+	FSIMDMask outside2 = t2 < 0;
+
+	t0 *= t0;
+	t1 *= t1;
+	t2 *= t2;
+
+	FSIMDFloat n0 = Select(outside0, 0, t0*t0*GradCoord2D(params, offset, i, j, x0, y0));
+	FSIMDFloat n1 = Select(outside1, 0, t1*t1*GradCoord2D(params, offset, i + i1, j + j1, x1, y1));
+	FSIMDFloat n2 = Select(outside2, 0, t2*t2*GradCoord2D(params, offset, i + 1, j + 1, x2, y2));
+
+	return 70 * (n0 + n1 + n2);
+}
+
+static FORCEINLINE FSIMDFloat SingleSimplex(const FFastNoiseParams& params, FSIMDInt offset, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z)
+{
+	FSIMDFloat t = (x + y + z) * F3;
+	FSIMDInt i = FastFloor(x + t);
+	FSIMDInt j = FastFloor(y + t);
+	FSIMDInt k = FastFloor(z + t);
+
+	t = ToFloat(i + j + k) * G3;
+	FSIMDFloat X0 = ToFloat(i) - t;
+	FSIMDFloat Y0 = ToFloat(j) - t;
+	FSIMDFloat Z0 = ToFloat(k) - t;
+
+	FSIMDFloat x0 = x - X0;
+	FSIMDFloat y0 = y - Y0;
+	FSIMDFloat z0 = z - Z0;
+
+	i = LatticeX(params, i);
+	j = LatticeY(params, j);
+	k = LatticeZ(params, k);
+
+	// Branch free version of the simplex corner ordering in UFastNoise::SingleSimplex
+	FSIMDMask xGEy = x0 >= y0;
+	FSIMDMask yGEz = y0 >= z0;
+	FSIMDMask xGEz = x0 >= z0;
+
+	FSIMDInt i1 = Select(xGEy & xGEz, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt j1 = Select(~xGEy & yGEz, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt k1 = Select(~yGEz & ~xGEz, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt i2 = Select(xGEy | xGEz, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt j2 = Select(~xGEy | yGEz, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt k2 = Select(yGEz & xGEz, FSIMDInt(0), FSIMDInt(1));
+
+	FSIMDFloat x1 = x0 - ToFloat(i1) + G3;
+	FSIMDFloat y1 = y0 - ToFloat(j1) + G3;
+	FSIMDFloat z1 = z0 - ToFloat(k1) + G3;
+	FSIMDFloat x2 = x0 - ToFloat(i2) + 2*G3;
+	FSIMDFloat y2 = y0 - ToFloat(j2) + 2*G3;
+	FSIMDFloat z2 = z0 - ToFloat(k2) + 2*G3;
+	FSIMDFloat x3 = x0 - 1 + 3*G3;
+	FSIMDFloat y3 = y0 - 1 + 3*G3;
+	FSIMDFloat z3 = z0 - 1 + 3*G3;
+
+	// Corners outside the kernel radius (t < 0) contribute nothing
+	FSIMDFloat t0 = float(0.6) - x0*x0 - y0*y0 - z0*z0;
+	FSIMDFloat t1 = float(0.6) - x1*x1 - y1*y1 - z1*z1;
+	FSIMDFloat t2 = float(0.6) - x2*x2 - y2*y2 - z2*z2;
+	FSIMDFloat t3 = float(0.6) - x3*x3 - y3*y3 - z3*z3;
+
+	FSIMDMask outside0 = t0 < 0;
+	FSIMDMask outside1 = t1 < 0;
+	FSIMDMask outside2 = t2 < 0;
+	FSIMDMask outside3 = t3 < 0;
+
+	t0 *= t0;
+	t1 *= t1;
+	t2 *= t2;
+	t3 *= t3;
+
+	FSIMDFloat n0 = Select(outside0, 0, t0*t0*GradCoord3D(params, offset, i, j, k, x0, y0, z0));
+	FSIMDFloat n1 = Select(outside1, 0, t1*t1*GradCoord3D(params, offset, i + i1, j + j1, k + k1, x1, y1, z1));
+	FSIMDFloat n2 = Select(outside2, 0, t2*t2*GradCoord3D(params, offset, i + i2, j + j2, k + k2, x2, y2, z2));
+	FSIMDFloat n3 = Select(outside3, 0, t3*t3*GradCoord3D(params, offset, i + 1, j + 1, k + 1, x3, y3, z3));
+
+	return 32 * (n0 + n1 + n2 + n3);
+}
+
+// Cellular Noise
+// Distance functions, selected once per set like the interpolation methods
+struct FCellularEuclidean
+{
+	static FORCEINLINE FSIMDFloat Distance(FSIMDFloat x, FSIMDFloat y) { return x * x + y * y; }
+	static FORCEINLINE FSIMDFloat Distance(FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return x * x + y * y + z * z; }
+};
+struct FCellularManhattan
+{
+	static FORCEINLINE FSIMDFloat Distance(FSIMDFloat x, FSIMDFloat y) { return FastAbs(x) + FastAbs(y); }
+	static FORCEINLINE FSIMDFloat Distance(FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return FastAbs(x) + FastAbs(y) + FastAbs(z); }
+};
+struct FCellularNatural
+{
+	static FORCEINLINE FSIMDFloat Distance(FSIMDFloat x, FSIMDFloat y) { return (FastAbs(x) + FastAbs(y)) + (x * x + y * y); }
+	static FORCEINLINE FSIMDFloat Distance(FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return (FastAbs(x) + FastAbs(y) + FastAbs(z)) + (x * x + y * y + z * z); }
+};
+
+// The 3 cells of the search along one axis and the gap their points cannot close, as CellularAxis in FastNoise.cpp
+static FORCEINLINE void CellularAxis(FSIMDFloat x, FSIMDFloat reach, FSIMDInt (&cells)[3], FSIMDFloat (&gaps)[3])
+{
+	FSIMDInt x0 = FastFloor(x);
+
+	cells[0] = x0;
+	cells[1] = x0 + 1;
+	cells[2] = Select(FastRound(x) == x0, x0 - 1, x0 + 2);
+
+	for (int32 i = 0; i < 3; i++)
+		gaps[i] = Max(FastAbs(ToFloat(cells[i]) - x) - reach, 0);
+}
+
+// The inner levels of Index2D_256/Index3D_256 for every row of the 3x3(x3) search,
+// only the outermost x lookup is left for each visited cell
+// Integer hashing keeps the seed and row coordinates mixed but unfinished, CellularCellIndex adds x and finishes the hash
+static FORCEINLINE void CellularRowHashes(const FFastNoiseParams& params, const FSIMDInt (&ys)[3], FSIMDInt (&yHash)[3])
+{
+	for (int32 j = 0; j < 3; j++)
+	{
+		FSIMDInt yi = LatticeY(params, ys[j]);
+
+		if (params.HashType == EFNHashType::Integer)
+			yHash[j] = HashSeed(params, 0) ^ (yi * Y_PRIME);
+		else
+			yHash[j] = Gather(params.Perm, yi & 0xff);
+	}
+}
+
+static FORCEINLINE void CellularRowHashes(const FFastNoiseParams& params, const FSIMDInt (&ys)[3], const FSIMDInt (&zs)[3], FSIMDInt (&yzHash)[3][3])
+{
+	for (int32 k = 0; k < 3; k++)
+	{
+		FSIMDInt zi = LatticeZ(params, zs[k]);
+
+		if (params.HashType == EFNHashType::Integer)
+		{
+			FSIMDInt zHash = HashSeed(params, 0) ^ (zi * Z_PRIME);
+
+			for (int32 j = 0; j < 3; j++)
+				yzHash[j][k] = zHash ^ (LatticeY(params, ys[j]) * Y_PRIME);
+			continue;
+		}
+
+		FSIMDInt zHash = Gather(params.Perm, zi & 0xff);
+
+		for (int32 j = 0; j < 3; j++)
+			yzHash[j][k] = Gather(params.Perm, (LatticeY(params, ys[j]) & 0xff) + zHash);
+	}
+}
+
+// Index2D_256/Index3D_256 of cell xi in a row hashed by CellularRowHashes, xi already offset by the lattice origin
+static FORCEINLINE FSIMDInt CellularCellIndex(const FFastNoiseParams& params, FSIMDInt xi, FSIMDInt rowHash)
+{
+	if (params.HashType == EFNHashType::Integer)
+		return HashFinish(rowHash ^ (xi * X_PRIME)) & 0xff;
+
+	return Gather(params.Perm, (xi & 0xff) + rowHash);
+}
+
+// Calls cellFunc(xi, yi, lutPos) in the order of ForEachCellularCell in FastNoise.cpp,
+// a cell is only skipped when none of the lanes can find a point closer than limit in it
+template <typename TDistance, typename FCellFunc>
+static FORCEINLINE void ForEachCellularCell(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, const FSIMDFloat& limit, FCellFunc cellFunc)
+{
+	FSIMDFloat reach = FastAbs(FSIMDFloat(params.CellularJitter)) + CELLULAR_BOUND_MARGIN;
+
+	FSIMDInt xs[3], ys[3];
+	FSIMDFloat xg[3], yg[3];
+	CellularAxis(x, reach, xs, xg);
+	CellularAxis(y, reach, ys, yg);
+
+	FSIMDInt yHash[3];
+	CellularRowHashes(params, ys, yHash);
+
+	auto visit = [&](int32 i, int32 j)
+	{
+		if (AnyLane(TDistance::Distance(xg[i], yg[j]) <= limit))
+			cellFunc(xs[i], ys[j], CellularCellIndex(params, LatticeX(params, xs[i]), yHash[j]));
+	};
+
+	for (int32 i = 0; i < 2; i++)
+		for (int32 j = 0; j < 2; j++)
+			visit(i, j);
+
+	if (!AnyLane(TDistance::Distance(Min(xg[2], yg[2]), 0) <= limit))
+		return;
+
+	for (int32 i = 0; i < 3; i++)
+		for (int32 j = 0; j < 3; j++)
+			if (i == 2 || j == 2)
+				visit(i, j);
+}
+
+template <typename TDistance, typename FCellFunc>
+static FORCEINLINE void ForEachCellularCell(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z, const FSIMDFloat& limit, FCellFunc cellFunc)
+{
+	FSIMDFloat reach = FastAbs(FSIMDFloat(params.CellularJitter)) + CELLULAR_BOUND_MARGIN;
+
+	FSIMDInt xs[3], ys[3], zs[3];
+	FSIMDFloat xg[3], yg[3], zg[3];
+	CellularAxis(x, reach, xs, xg);
+	CellularAxis(y, reach, ys, yg);
+	CellularAxis(z, reach, zs, zg);
+
+	FSIMDInt yzHash[3][3];
+	CellularRowHashes(params, ys, zs, yzHash);
+
+	auto visit = [&](int32 i, int32 j, int32 k)
+	{
+		if (AnyLane(TDistance::Distance(xg[i], yg[j], zg[k]) <= limit))
+			cellFunc(xs[i], ys[j], zs[k], CellularCellIndex(params, LatticeX(params, xs[i]), yzHash[j][k]));
+	};
+
+	for (int32 i = 0; i < 2; i++)
+		for (int32 j = 0; j < 2; j++)
+			for (int32 k = 0; k < 2; k++)
+				visit(i, j, k);
+
+	if (!AnyLane(TDistance::Distance(Min(Min(xg[2], yg[2]), zg[2]), 0, 0) <= limit))
+		return;
+
+	for (int32 i = 0; i < 3; i++)
+	{
+		for (int32 j = 0; j < 3; j++)
+		{
+			if (!AnyLane(TDistance::Distance(xg[i], yg[j], 0) <= limit))
+				continue;
+
+			for (int32 k = 0; k < 3; k++)
+				if (i == 2 || j == 2 || k == 2)
+					visit(i, j, k);
+		}
+	}
+}
+
+// Lanes where cell a comes before cell b in the x, y(, z) order of a full 3x3(x3) scan, as CellularScansBefore in FastNoise.cpp
+static FORCEINLINE FSIMDMask CellularScansBefore(FSIMDInt xa, FSIMDInt ya, FSIMDInt xb, FSIMDInt yb)
+{
+	return (xa < xb) | ((xa == xb) & (ya < yb));
+}
+
+static FORCEINLINE FSIMDMask CellularScansBefore(FSIMDInt xa, FSIMDInt ya, FSIMDInt za, FSIMDInt xb, FSIMDInt yb, FSIMDInt zb)
+{
+	return (xa < xb) | ((xa == xb) & ((ya < yb) | ((ya == yb) & (za < zb))));
+}
+
+// Finds the closest cell to every lane, returns its distance and writes its coordinates to xc, yc
+// Equal distances go to the cell the full scan reaches first, (newDistance <= distance) only adds the ties to (newDistance < distance)
+template <typename TDistance>
+static FORCEINLINE FSIMDFloat CellularClosest(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FSIMDInt& xc, FSIMDInt& yc)
+{
+	FSIMDFloat jitter = params.CellularJitter;
+
+	FSIMDFloat distance = 999999;
+	xc = 0;
+	yc = 0;
+
+	ForEachCellularCell<TDistance>(params, x, y, distance, [&](FSIMDInt xi, FSIMDInt yi, FSIMDInt lutPos)
+	{
+		FSIMDFloat vecX = ToFloat(xi) - x + Gather(CELL_2D_X, lutPos) * jitter;
+		FSIMDFloat vecY = ToFloat(yi) - y + Gather(CELL_2D_Y, lutPos) * jitter;
+
+		FSIMDFloat newDistance = TDistance::Distance(vecX, vecY);
+		FSIMDMask closer = (newDistance < distance) | ((newDistance <= distance) & CellularScansBefore(xi, yi, xc, yc));
+
+		distance = Select(closer, newDistance, distance);
+		xc = Select(closer, xi, xc);
+		yc = Select(closer, yi, yc);
+	});
+
+	return distance;
+}
+
+template <typename TDistance>
+static FORCEINLINE FSIMDFloat CellularClosest(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z, FSIMDInt& xc, FSIMDInt& yc, FSIMDInt& zc)
+{
+	FSIMDFloat jitter = params.CellularJitter;
+
+	FSIMDFloat distance = 999999;
+	xc = 0;
+	yc = 0;
+	zc = 0;
+
+	ForEachCellularCell<TDistance>(params, x, y, z, distance, [&](FSIMDInt xi, FSIMDInt yi, FSIMDInt zi, FSIMDInt lutPos)
+	{
+		FSIMDFloat vecX = ToFloat(xi) - x + Gather(CELL_3D_X, lutPos) * jitter;
+		FSIMDFloat vecY = ToFloat(yi) - y + Gather(CELL_3D_Y, lutPos) * jitter;
+		FSIMDFloat vecZ = ToFloat(zi) - z + Gather(CELL_3D_Z, lutPos) * jitter;
+
+		FSIMDFloat newDistance = TDistance::Distance(vecX, vecY, vecZ);
+		FSIMDMask closer = (newDistance < distance) | ((newDistance <= distance) & CellularScansBefore(xi, yi, zi, xc, yc, zc));
+
+		distance = Select(closer, newDistance, distance);
+		xc = Select(closer, xi, xc);
+		yc = Select(closer, yi, yc);
+		zc = Select(closer, zi, zc);
+	});
+
+	return distance;
+}
+
+// Keeps the DistanceIndex1 + 1 smallest distances sorted, the count is a template argument so they stay in registers
+// The sorted distances do not depend on the visiting order, cells that cannot beat distance[DistanceIndex1] would leave them unchanged
+template <typename TDistance, int32 DistanceIndex1>
+static FORCEINLINE void CellularDistances(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FSIMDFloat (&distance)[FN_CELLULAR_INDEX_MAX + 1])
+{
+	FSIMDFloat jitter = params.CellularJitter;
+
+	for (int32 i = 0; i <= FN_CELLULAR_INDEX_MAX; i++)
+		distance[i] = 999999;
+
+	ForEachCellularCell<TDistance>(params, x, y, distance[DistanceIndex1], [&](FSIMDInt xi, FSIMDInt yi, FSIMDInt lutPos)
+	{
+		FSIMDFloat vecX = ToFloat(xi) - x + Gather(CELL_2D_X, lutPos) * jitter;
+		FSIMDFloat vecY = ToFloat(yi) - y + Gather(CELL_2D_Y, lutPos) * jitter;
+
+		FSIMDFloat newDistance = TDistance::Distance(vecX, vecY);
+
+		for (int32 i = DistanceIndex1; i > 0; i--)
+			distance[i] = Max(Min(distance[i], newDistance), distance[i - 1]);
+		distance[0] = Min(distance[0], newDistance);
+	});
+}
+
+template <typename TDistance, int32 DistanceIndex1>
+static FORCEINLINE void CellularDistances(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z, FSIMDFloat (&distance)[FN_CELLULAR_INDEX_MAX + 1])
+{
+	FSIMDFloat jitter = params.CellularJitter;
+
+	for (int32 i = 0; i <= FN_CELLULAR_INDEX_MAX; i++)
+		distance[i] = 999999;
+
+	ForEachCellularCell<TDistance>(params, x, y, z, distance[DistanceIndex1], [&](FSIMDInt xi, FSIMDInt yi, FSIMDInt zi, FSIMDInt lutPos)
+	{
+		FSIMDFloat vecX = ToFloat(xi) - x + Gather(CELL_3D_X, lutPos) * jitter;
+		FSIMDFloat vecY = ToFloat(yi) - y + Gather(CELL_3D_Y, lutPos) * jitter;
+		FSIMDFloat vecZ = ToFloat(zi) - z + Gather(CELL_3D_Z, lutPos) * jitter;
+
+		FSIMDFloat newDistance = TDistance::Distance(vecX, vecY, vecZ);
+
+		for (int32 i = DistanceIndex1; i > 0; i--)
+			distance[i] = Max(Min(distance[i], newDistance), distance[i - 1]);
+		distance[0] = Min(distance[0], newDistance);
+	});
+}
+
+// CellularDistances(...) and CellularClosest(...) in a single search, for the cellular sample sets
+// distance[0] never exceeds distance[DistanceIndex1], so the cells it skips cannot be the closest either
+template <typename TDistance, int32 DistanceIndex1>
+static FORCEINLINE void CellularSample(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FSIMDFloat (&distance)[FN_CELLULAR_INDEX_MAX + 1], FSIMDInt& xc, FSIMDInt& yc)
+{
+	FSIMDFloat jitter = params.CellularJitter;
+
+	for (int32 i = 0; i <= FN_CELLULAR_INDEX_MAX; i++)
+		distance[i] = 999999;
+	xc = 0;
+	yc = 0;
+
+	ForEachCellularCell<TDistance>(params, x, y, distance[DistanceIndex1], [&](FSIMDInt xi, FSIMDInt yi, FSIMDInt lutPos)
+	{
+		FSIMDFloat vecX = ToFloat(xi) - x + Gather(CELL_2D_X, lutPos) * jitter;
+		FSIMDFloat vecY = ToFloat(yi) - y + Gather(CELL_2D_Y, lutPos) * jitter;
+
+		FSIMDFloat newDistance = TDistance::Distance(vecX, vecY);
+		FSIMDMask closer = (newDistance < distance[0]) | ((newDistance <= distance[0]) & CellularScansBefore(xi, yi, xc, yc));
+
+		xc = Select(closer, xi, xc);
+		yc = Select(closer, yi, yc);
+
+		for (int32 i = DistanceIndex1; i > 0; i--)
+			distance[i] = Max(Min(distance[i], newDistance), distance[i - 1]);
+		distance[0] = Min(distance[0], newDistance);
+	});
+}
+
+template <typename TDistance, int32 DistanceIndex1>
+static FORCEINLINE void CellularSample(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z, FSIMDFloat (&distance)[FN_CELLULAR_INDEX_MAX + 1], FSIMDInt& xc, FSIMDInt& yc, FSIMDInt& zc)
+{
+	FSIMDFloat jitter = params.CellularJitter;
+
+	for (int32 i = 0; i <= FN_CELLULAR_INDEX_MAX; i++)
+		distance[i] = 999999;
+	xc = 0;
+	yc = 0;
+	zc = 0;
+
+	ForEachCellularCell<TDistance>(params, x, y, z, distance[DistanceIndex1], [&](FSIMDInt xi, FSIMDInt yi, FSIMDInt zi, FSIMDInt lutPos)
+	{
+		FSIMDFloat vecX = ToFloat(xi) - x + Gather(CELL_3D_X, lutPos) * jitter;
+		FSIMDFloat vecY = ToFloat(yi) - y + Gather(CELL_3D_Y, lutPos) * jitter;
+		FSIMDFloat vecZ = ToFloat(zi) - z + Gather(CELL_3D_Z, lutPos) * jitter;
+
+		FSIMDFloat newDistance = TDistance::Distance(vecX, vecY, vecZ);
+		FSIMDMask closer = (newDistance < distance[0]) | ((newDistance <= distance[0]) & CellularScansBefore(xi, yi, zi, xc, yc, zc));
+
+		xc = Select(closer, xi, xc);
+		yc = Select(closer, yi, yc);
+		zc = Select(closer, zi, zc);
+
+		for (int32 i = DistanceIndex1; i > 0; i--)
+			distance[i] = Max(Min(distance[i], newDistance), distance[i - 1]);
+		distance[0] = Min(distance[0], newDistance);
+	});
+}
+
+// CellValue and Distance, NoiseLookup is handled by the CellularCell kernels
+template <typename TDistance>
+static FORCEINLINE FSIMDFloat SingleCellular(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y)
+{
+	FSIMDInt xc, yc;
+	FSIMDFloat distance = CellularClosest<TDistance>(params, x, y, xc, yc);
+
+	if (params.CellularReturnType == EFNCellularReturnType::CellValue)
+		return ValCoord2D(params.Seed, LatticeX(params, xc), LatticeY(params, yc));
+
+	return distance;
+}
+
+template <typename TDistance>
+static FORCEINLINE FSIMDFloat SingleCellular(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z)
+{
+	FSIMDInt xc, yc, zc;
+	FSIMDFloat distance = CellularClosest<TDistance>(params, x, y, z, xc, yc, zc);
+
+	if (params.CellularReturnType == EFNCellularReturnType::CellValue)
+		return ValCoord3D(params.Seed, LatticeX(params, xc), LatticeY(params, yc), LatticeZ(params, zc));
+
+	return distance;
+}
+
+static FORCEINLINE FSIMDFloat CellularCombineDistances(const FFastNoiseParams& params, const FSIMDFloat (&distance)[FN_CELLULAR_INDEX_MAX + 1])
+{
+	FSIMDFloat distance0 = distance[params.CellularDistanceIndex0];
+	FSIMDFloat distance1 = distance[params.CellularDistanceIndex1];
+
+	switch (params.CellularReturnType)
+	{
+	case EFNCellularReturnType::Distance2:
+		return distance1;
+	case EFNCellularReturnType::Distance2Add:
+		return distance1 + distance0;
+	case EFNCellularReturnType::Distance2Sub:
+		return distance1 - distance0;
+	case EFNCellularReturnType::Distance2Mul:
+		return distance1 * distance0;
+	case EFNCellularReturnType::Distance2Div:
+		return distance0 / distance1;
+	default:
+		return 0;
+	}
+}
+
+template <typename TDistance, int32 DistanceIndex1>
+static FORCEINLINE FSIMDFloat SingleCellular2Edge(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y)
+{
+	FSIMDFloat distance[FN_CELLULAR_INDEX_MAX + 1];
+	CellularDistances<TDistance, DistanceIndex1>(params, x, y, distance);
+
+	return CellularCombineDistances(params, distance);
+}
+
+template <typename TDistance, int32 DistanceIndex1>
+static FORCEINLINE FSIMDFloat SingleCellular2Edge(const FFastNoiseParams& params, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z)
+{
+	FSIMDFloat distance[FN_CELLULAR_INDEX_MAX + 1];
+	CellularDistances<TDistance, DistanceIndex1>(params, x, y, z, distance);
+
+	return CellularCombineDistances(params, distance);
+}
+
+// Gradient Perturb
+// Same lookups and Lerp order as FFastNoiseParams::SingleGradientPerturb, x, y (and z) are warped in registers
+template <typename TInterp>
+static FORCEINLINE void SingleGradientPerturb(const FFastNoiseParams& params, int32 offset, float warpAmp, float frequency, FSIMDFloat& x, FSIMDFloat& y)
+{
+	FSIMDFloat xf = x * frequency;
+	FSIMDFloat yf = y * frequency;
+
+	FSIMDInt x0 = FastFloor(xf);
+	FSIMDInt y0 = FastFloor(yf);
+	FSIMDInt x1 = x0 + 1;
+	FSIMDInt y1 = y0 + 1;
+
+	FSIMDFloat xs = TInterp::Apply(xf - ToFloat(x0));
+	FSIMDFloat ys = TInterp::Apply(yf - ToFloat(y0));
+
+	FSIMDInt lutPos0 = Index2D_256(params, offset, x0, y0);
+	FSIMDInt lutPos1 = Index2D_256(params, offset, x1, y0);
+
+	FSIMDFloat lx0x = Lerp(Gather(CELL_2D_X, lutPos0), Gather(CELL_2D_X, lutPos1), xs);
+	FSIMDFloat ly0x = Lerp(Gather(CELL_2D_Y, lutPos0), Gather(CELL_2D_Y, lutPos1), xs);
+
+	lutPos0 = Index2D_256(params, offset, x0, y1);
+	lutPos1 = Index2D_256(params, offset, x1, y1);
+
+	FSIMDFloat lx1x = Lerp(Gather(CELL_2D_X, lutPos0), Gather(CELL_2D_X, lutPos1), xs);
+	FSIMDFloat ly1x = Lerp(Gather(CELL_2D_Y, lutPos0), Gather(CELL_2D_Y, lutPos1), xs);
+
+	x += Lerp(lx0x, lx1x, ys) * warpAmp;
+	y += Lerp(ly0x, ly1x, ys) * warpAmp;
+}
+
+template <typename TInterp>
+static FORCEINLINE void SingleGradientPerturb(const FFastNoiseParams& params, int32 offset, float warpAmp, float frequency, FSIMDFloat& x, FSIMDFloat& y, FSIMDFloat& z)
+{
+	FSIMDFloat xf = x * frequency;
+	FSIMDFloat yf = y * frequency;
+	FSIMDFloat zf = z * frequency;
+
+	FSIMDInt x0 = FastFloor(xf);
+	FSIMDInt y0 = FastFloor(yf);
+	FSIMDInt z0 = FastFloor(zf);
+	FSIMDInt x1 = x0 + 1;
+	FSIMDInt y1 = y0 + 1;
+	FSIMDInt z1 = z0 + 1;
+
+	FSIMDFloat xs = TInterp::Apply(xf - ToFloat(x0));
+	FSIMDFloat ys = TInterp::Apply(yf - ToFloat(y0));
+	FSIMDFloat zs = TInterp::Apply(zf - ToFloat(z0));
+
+	FSIMDInt lutPos0 = Index3D_256(params, offset, x0, y0, z0);
+	FSIMDInt lutPos1 = Index3D_256(params, offset, x1, y0, z0);
+
+	FSIMDFloat lx0x = Lerp(Gather(CELL_3D_X, lutPos0), Gather(CELL_3D_X, lutPos1), xs);
+	FSIMDFloat ly0x = Lerp(Gather(CELL_3D_Y, lutPos0), Gather(CELL_3D_Y, lutPos1), xs);
+	FSIMDFloat lz0x = Lerp(Gather(CELL_3D_Z, lutPos0), Gather(CELL_3D_Z, lutPos1), xs);
+
+	lutPos0 = Index3D_256(params, offset, x0, y1, z0);
+	lutPos1 = Index3D_256(params, offset, x1, y1, z0);
+
+	FSIMDFloat lx1x = Lerp(Gather(CELL_3D_X, lutPos0), Gather(CELL_3D_X, lutPos1), xs);
+	FSIMDFloat ly1x = Lerp(Gather(CELL_3D_Y, lutPos0), Gather(CELL_3D_Y, lutPos1), xs);
+	FSIMDFloat lz1x = Lerp(Gather(CELL_3D_Z, lutPos0), Gather(CELL_3D_Z, lutPos1), xs);
+
+	FSIMDFloat lx0y = Lerp(lx0x, lx1x, ys);
+	FSIMDFloat ly0y = Lerp(ly0x, ly1x, ys);
+	FSIMDFloat lz0y = Lerp(lz0x, lz1x, ys);
+
+	lutPos0 = Index3D_256(params, offset, x0, y0, z1);
+	lutPos1 = Index3D_256(params, offset, x1, y0, z1);
+
+	lx0x = Lerp(Gather(CELL_3D_X, lutPos0), Gather(CELL_3D_X, lutPos1), xs);
+	ly0x = Lerp(Gather(CELL_3D_Y, lutPos0), Gather(CELL_3D_Y, lutPos1), xs);
+	lz0x = Lerp(Gather(CELL_3D_Z, lutPos0), Gather(CELL_3D_Z, lutPos1), xs);
+
+	lutPos0 = Index3D_256(params, offset, x0, y1, z1);
+	lutPos1 = Index3D_256(params, offset, x1, y1, z1);
+
+	lx1x = Lerp(Gather(CELL_3D_X, lutPos0), Gather(CELL_3D_X, lutPos1), xs);
+	ly1x = Lerp(Gather(CELL_3D_Y, lutPos0), Gather(CELL_3D_Y, lutPos1), xs);
+	lz1x = Lerp(Gather(CELL_3D_Z, lutPos0), Gather(CELL_3D_Z, lutPos1), xs);
+
+	x += Lerp(lx0y, Lerp(lx0x, lx1x, ys), zs) * warpAmp;
+	y += Lerp(ly0y, Lerp(ly0x, ly1x, ys), zs) * warpAmp;
+	z += Lerp(lz0y, Lerp(lz0x, lz1x, ys), zs) * warpAmp;
+}
+
+// Same weights and sums as FFastNoiseParams::SingleSimplexPerturb, the corners outside the radius get a weight of 0
+static FORCEINLINE FSIMDFloat SimplexPerturbWeight(FSIMDFloat t)
+{
+	FSIMDFloat t2 = t * t;
+	return Select(t < 0, 0, t2 * t2);
+}
+
+static FORCEINLINE void SingleSimplexPerturb(const FFastNoiseParams& params, int32 offset, float warpAmp, float frequency, FSIMDFloat& x, FSIMDFloat& y)
+{
+	FSIMDFloat xf = x * frequency;
+	FSIMDFloat yf = y * frequency;
+
+	FSIMDFloat t = (xf + yf) * F2;
+	FSIMDInt i = FastFloor(xf + t);
+	FSIMDInt j = FastFloor(yf + t);
+
+	t = ToFloat(i + j) * G2;
+	FSIMDFloat x0 = xf - (ToFloat(i) - t);
+	FSIMDFloat y0 = yf - (ToFloat(j) - t);
+
+	FSIMDMask xGreater = x0 > y0;
+	FSIMDInt i1 = Select(xGreater, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt j1 = Select(xGreater, FSIMDInt(0), FSIMDInt(1));
+
+	FSIMDFloat x1 = x0 - ToFloat(i1) + G2;
+	FSIMDFloat y1 = y0 - ToFloat(j1) + G2;
+	FSIMDFloat x2 = x0 - 1 + 2*G2;
+	FSIMDFloat y2 = y0 - 1 + 2*G2;
+
+	FSIMDFloat w0 = SimplexPerturbWeight(float(0.5) - x0*x0 - y0*y0);
+	FSIMDFloat w1 = SimplexPerturbWeight(float(0.5) - x1*x1 - y1*y1);
+	FSIMDFloat w2 = SimplexPerturbWeight(float(0.5) - x2*x2 - y2*y2);
+
+	FSIMDInt lutPos0 = Index2D_256(params, offset, i, j);
+	FSIMDInt lutPos1 = Index2D_256(params, offset, i + i1, j + j1);
+	FSIMDInt lutPos2 = Index2D_256(params, offset, i + 1, j + 1);
+
+	warpAmp *= SIMPLEX_PERTURB_SCALE_2D;
+	x += (w0*Gather(CELL_2D_X, lutPos0) + w1*Gather(CELL_2D_X, lutPos1) + w2*Gather(CELL_2D_X, lutPos2)) * warpAmp;
+	y += (w0*Gather(CELL_2D_Y, lutPos0) + w1*Gather(CELL_2D_Y, lutPos1) + w2*Gather(CELL_2D_Y, lutPos2)) * warpAmp;
+}
+
+static FORCEINLINE void SingleSimplexPerturb(const FFastNoiseParams& params, int32 offset, float warpAmp, float frequency, FSIMDFloat& x, FSIMDFloat& y, FSIMDFloat& z)
+{
+	FSIMDFloat xf = x * frequency;
+	FSIMDFloat yf = y * frequency;
+	FSIMDFloat zf = z * frequency;
+
+	FSIMDFloat t = (xf + yf + zf) * F3;
+	FSIMDInt i = FastFloor(xf + t);
+	FSIMDInt j = FastFloor(yf + t);
+	FSIMDInt k = FastFloor(zf + t);
+
+	t = ToFloat(i + j + k) * G3;
+	FSIMDFloat x0 = xf - (ToFloat(i) - t);
+	FSIMDFloat y0 = yf - (ToFloat(j) - t);
+	FSIMDFloat z0 = zf - (ToFloat(k) - t);
+
+	// Same corner ordering as SingleSimplex
+	FSIMDMask xGEy = x0 >= y0;
+	FSIMDMask yGEz = y0 >= z0;
+	FSIMDMask xGEz = x0 >= z0;
+
+	FSIMDInt i1 = Select(xGEy & xGEz, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt j1 = Select(~xGEy & yGEz, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt k1 = Select(~yGEz & ~xGEz, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt i2 = Select(xGEy | xGEz, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt j2 = Select(~xGEy | yGEz, FSIMDInt(1), FSIMDInt(0));
+	FSIMDInt k2 = Select(yGEz & xGEz, FSIMDInt(0), FSIMDInt(1));
+
+	FSIMDFloat x1 = x0 - ToFloat(i1) + G3;
+	FSIMDFloat y1 = y0 - ToFloat(j1) + G3;
+	FSIMDFloat z1 = z0 - ToFloat(k1) + G3;
+	FSIMDFloat x2 = x0 - ToFloat(i2) + 2*G3;
+	FSIMDFloat y2 = y0 - ToFloat(j2) + 2*G3;
+	FSIMDFloat z2 = z0 - ToFloat(k2) + 2*G3;
+	FSIMDFloat x3 = x0 - 1 + 3*G3;
+	FSIMDFloat y3 = y0 - 1 + 3*G3;
+	FSIMDFloat z3 = z0 - 1 + 3*G3;
+
+	FSIMDFloat w0 = SimplexPerturbWeight(float(0.6) - x0*x0 - y0*y0 - z0*z0);
+	FSIMDFloat w1 = SimplexPerturbWeight(float(0.6) - x1*x1 - y1*y1 - z1*z1);
+	FSIMDFloat w2 = SimplexPerturbWeight(float(0.6) - x2*x2 - y2*y2 - z2*z2);
+	FSIMDFloat w3 = SimplexPerturbWeight(float(0.6) - x3*x3 - y3*y3 - z3*z3);
+
+	FSIMDInt lutPos0 = Index3D_256(params, offset, i, j, k);
+	FSIMDInt lutPos1 = Index3D_256(params, offset, i + i1, j + j1, k + k1);
+	FSIMDInt lutPos2 = Index3D_256(params, offset, i + i2, j + j2, k + k2);
+	FSIMDInt lutPos3 = Index3D_256(params, offset, i + 1, j + 1, k + 1);
+
+	warpAmp *= SIMPLEX_PERTURB_SCALE_3D;
+	x += (w0*Gather(CELL_3D_X, lutPos0) + w1*Gather(CELL_3D_X, lutPos1) + w2*Gather(CELL_3D_X, lutPos2) + w3*Gather(CELL_3D_X, lutPos3)) * warpAmp;
+	y += (w0*Gather(CELL_3D_Y, lutPos0) + w1*Gather(CELL_3D_Y, lutPos1) + w2*Gather(CELL_3D_Y, lutPos2) + w3*Gather(CELL_3D_Y, lutPos3)) * warpAmp;
+	z += (w0*Gather(CELL_3D_Z, lutPos0) + w1*Gather(CELL_3D_Z, lutPos1) + w2*Gather(CELL_3D_Z, lutPos2) + w3*Gather(CELL_3D_Z, lutPos3)) * warpAmp;
+}
+
+// Matches GradientPerturbFractal2D/3D, every octave warps the result of the previous one
+template <typename FPerturb>
+static FORCEINLINE void SinglePerturbFractal(const FFastNoiseParams& params, FPerturb& perturb, FSIMDFloat& x, FSIMDFloat& y)
+{
+	float amp = params.GradientPerturbAmp * params.FractalBounding;
+	float freq = params.Frequency;
+	int32 i = 0;
+
+	perturb(params.OctaveOffset(0), amp, params.Frequency, x, y);
+
+	while (++i < params.FractalOctaves)
+	{
+		freq *= params.FractalLacunarity;
+		amp *= params.FractalGain;
+		if (i == params.FractalOctaves - 1)
+			amp *= params.FractalFade;
+		perturb(params.OctaveOffset(i), amp, freq, x, y);
+	}
+}
+
+template <typename FPerturb>
+static FORCEINLINE void SinglePerturbFractal(const FFastNoiseParams& params, FPerturb& perturb, FSIMDFloat& x, FSIMDFloat& y, FSIMDFloat& z)
+{
+	float amp = params.GradientPerturbAmp * params.FractalBounding;
+	float freq = params.Frequency;
+	int32 i = 0;
+
+	perturb(params.OctaveOffset(0), amp, params.Frequency, x, y, z);
+
+	while (++i < params.FractalOctaves)
+	{
+		freq *= params.FractalLacunarity;
+		amp *= params.FractalGain;
+		if (i == params.FractalOctaves - 1)
+			amp *= params.FractalFade;
+		perturb(params.OctaveOffset(i), amp, freq, x, y, z);
+	}
+}
+
+// Noise Sets
+// Calls vectorFunc(index, count, x, y) for every vector of samples, count is the number of lanes inside the set
+template <typename FVectorFunc>
+static void ForEachNoiseSet(const float* xCoords, const float* yCoords, int32 xSize, int32 ySize, FVectorFunc vectorFunc)
+{
+	int32 index = 0;
+
+	for (int32 y = 0; y < ySize; y++)
+	{
+		FSIMDFloat yf = yCoords[y];
+
+		for (int32 x = 0; x < xSize; x += FSIMDFloat::Width)
+			vectorFunc(index + x, xSize - x, FSIMDFloat::Load(xCoords + x), yf);
+
+		index += xSize;
+	}
+}
+
+template <typename FVectorFunc>
+static void ForEachNoiseSet(const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize, FVectorFunc vectorFunc)
+{
+	int32 index = 0;
+
+	for (int32 z = 0; z < zSize; z++)
+	{
+		FSIMDFloat zf = zCoords[z];
+
+		for (int32 y = 0; y < ySize; y++)
+		{
+			FSIMDFloat yf = yCoords[y];
+
+			for (int32 x = 0; x < xSize; x += FSIMDFloat::Width)
+				vectorFunc(index + x, xSize - x, FSIMDFloat::Load(xCoords + x), yf, zf);
+
+			index += xSize;
+		}
+	}
+}
+
+template <typename FVectorFunc>
+static void ForEachNoisePointSet(const float* xPoints, const float* yPoints, int32 count, float frequency, FVectorFunc vectorFunc)
+{
+	for (int32 i = 0; i < count; i += FSIMDFloat::Width)
+	{
+		FSIMDFloat x = LoadN(xPoints + i, count - i) * frequency;
+		FSIMDFloat y = LoadN(yPoints + i, count - i) * frequency;
+
+		vectorFunc(i, count - i, x, y);
+	}
+}
+
+template <typename FVectorFunc>
+static void ForEachNoisePointSet(const float* xPoints, const float* yPoints, const float* zPoints, int32 count, float frequency, FVectorFunc vectorFunc)
+{
+	for (int32 i = 0; i < count; i += FSIMDFloat::Width)
+	{
+		FSIMDFloat x = LoadN(xPoints + i, count - i) * frequency;
+		FSIMDFloat y = LoadN(yPoints + i, count - i) * frequency;
+		FSIMDFloat z = LoadN(zPoints + i, count - i) * frequency;
+
+		vectorFunc(i, count - i, x, y, z);
+	}
+}
+
+// Stores noiseFunc(x, y) for every sample of a set
+template <typename FNoiseFunc>
+static FORCEINLINE auto StoreNoise2D(float* noiseSet, FNoiseFunc& noiseFunc)
+{
+	return [noiseSet, &noiseFunc](int32 index, int32 count, FSIMDFloat x, FSIMDFloat y) { StoreN(noiseSet + index, noiseFunc(x, y), count); };
+}
+
+template <typename FNoiseFunc>
+static FORCEINLINE auto StoreNoise3D(float* noiseSet, FNoiseFunc& noiseFunc)
+{
+	return [noiseSet, &noiseFunc](int32 index, int32 count, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { StoreN(noiseSet + index, noiseFunc(x, y, z), count); };
+}
+
+// Passes fill the kernel at BaseOffset, or the fractal kernel for the current fractal type
+template <typename FFill, typename FNoise>
+static FORCEINLINE void DispatchFractal2D(const FFastNoiseParams& params, FFill& fill, bool fractal, FNoise noise)
+{
+	if (!fractal)
+	{
+		fill([&](FSIMDFloat x, FSIMDFloat y) { return noise(params.BaseOffset, x, y); });
+		return;
+	}
+
+	switch (params.FractalType)
+	{
+	case EFNFractalType::FBM:
+		fill([&](FSIMDFloat x, FSIMDFloat y) { return SingleFractal<EFNFractalType::FBM>(params, x, y, noise); });
+		break;
+	case EFNFractalType::Billow:
+		fill([&](FSIMDFloat x, FSIMDFloat y) { return SingleFractal<EFNFractalType::Billow>(params, x, y, noise); });
+		break;
+	case EFNFractalType::RigidMulti:
+		fill([&](FSIMDFloat x, FSIMDFloat y) { return SingleFractal<EFNFractalType::RigidMulti>(params, x, y, noise); });
+		break;
+	}
+}
+
+template <typename FFill, typename FNoise>
+static FORCEINLINE void DispatchFractal3D(const FFastNoiseParams& params, FFill& fill, bool fractal, FNoise noise)
+{
+	if (!fractal)
+	{
+		fill([&](FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return noise(params.BaseOffset, x, y, z); });
+		return;
+	}
+
+	switch (params.FractalType)
+	{
+	case EFNFractalType::FBM:
+		fill([&](FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleFractal<EFNFractalType::FBM>(params, x, y, z, noise); });
+		break;
+	case EFNFractalType::Billow:
+		fill([&](FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleFractal<EFNFractalType::Billow>(params, x, y, z, noise); });
+		break;
+	case EFNFractalType::RigidMulti:
+		fill([&](FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleFractal<EFNFractalType::RigidMulti>(params, x, y, z, noise); });
+		break;
+	}
+}
+
+// Passes func an instance of the distance function type selected by CellularDistanceFunction
+template <typename FFunc>
+static FORCEINLINE void DispatchCellularDistance(const FFastNoiseParams& params, FFunc func)
+{
+	switch (params.CellularDistanceFunction)
+	{
+	case EFNCellularDistanceFunction::Euclidean:
+		func(FCellularEuclidean());
+		break;
+	case EFNCellularDistanceFunction::Manhattan:
+		func(FCellularManhattan());
+		break;
+	case EFNCellularDistanceFunction::Natural:
+		func(FCellularNatural());
+		break;
+	}
+}
+
+template <typename TDistance, typename FFill>
+static void DispatchCellularNoise2D(const FFastNoiseParams& params, FFill& fill)
+{
+	switch (params.CellularReturnType)
+	{
+	case EFNCellularReturnType::CellValue:
+	case EFNCellularReturnType::Distance:
+		fill([&params](FSIMDFloat x, FSIMDFloat y) { return SingleCellular<TDistance>(params, x, y); });
+		break;
+	case EFNCellularReturnType::NoiseLookup:
+		checkNoEntry();
+		break;
+	default:
+		switch (params.CellularDistanceIndex1)
+		{
+		case 0:
+			fill([&params](FSIMDFloat x, FSIMDFloat y) { return SingleCellular2Edge<TDistance, 0>(params, x, y); });
+			break;
+		case 1:
+			fill([&params](FSIMDFloat x, FSIMDFloat y) { return SingleCellular2Edge<TDistance, 1>(params, x, y); });
+			break;
+		case 2:
+			fill([&params](FSIMDFloat x, FSIMDFloat y) { return SingleCellular2Edge<TDistance, 2>(params, x, y); });
+			break;
+		default:
+			fill([&params](FSIMDFloat x, FSIMDFloat y) { return SingleCellular2Edge<TDistance, FN_CELLULAR_INDEX_MAX>(params, x, y); });
+			break;
+		}
+		break;
+	}
+}
+
+template <typename TDistance, typename FFill>
+static void DispatchCellularNoise3D(const FFastNoiseParams& params, FFill& fill)
+{
+	switch (params.CellularReturnType)
+	{
+	case EFNCellularReturnType::CellValue:
+	case EFNCellularReturnType::Distance:
+		fill([&params](FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleCellular<TDistance>(params, x, y, z); });
+		break;
+	case EFNCellularReturnType::NoiseLookup:
+		checkNoEntry();
+		break;
+	default:
+		switch (params.CellularDistanceIndex1)
+		{
+		case 0:
+			fill([&params](FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleCellular2Edge<TDistance, 0>(params, x, y, z); });
+			break;
+		case 1:
+			fill([&params](FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleCellular2Edge<TDistance, 1>(params, x, y, z); });
+			break;
+		case 2:
+			fill([&params](FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleCellular2Edge<TDistance, 2>(params, x, y, z); });
+			break;
+		default:
+			fill([&params](FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleCellular2Edge<TDistance, FN_CELLULAR_INDEX_MAX>(params, x, y, z); });
+			break;
+		}
+		break;
+	}
+}
+
+// Value and Perlin noise for one interpolation method
+template <typename TInterp, typename FFill>
+static void DispatchInterpNoise2D(const FFastNoiseParams& params, FFill& fill)
+{
+	switch (params.NoiseType)
+	{
+	case EFNNoiseType::Value:
+	case EFNNoiseType::ValueFractal:
+		DispatchFractal2D(params, fill, params.NoiseType == EFNNoiseType::ValueFractal,
+			[&params](int32 offset, FSIMDFloat x, FSIMDFloat y) { return SingleValue<TInterp>(params, offset, x, y); });
+		break;
+	default:
+		DispatchFractal2D(params, fill, params.NoiseType == EFNNoiseType::PerlinFractal,
+			[&params](int32 offset, FSIMDFloat x, FSIMDFloat y) { return SinglePerlin<TInterp>(params, offset, x, y); });
+		break;
+	}
+}
+
+template <typename TInterp, typename FFill>
+static void DispatchInterpNoise3D(const FFastNoiseParams& params, FFill& fill)
+{
+	switch (params.NoiseType)
+	{
+	case EFNNoiseType::Value:
+	case EFNNoiseType::ValueFractal:
+		DispatchFractal3D(params, fill, params.NoiseType == EFNNoiseType::ValueFractal,
+			[&params](int32 offset, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleValue<TInterp>(params, offset, x, y, z); });
+		break;
+	default:
+		DispatchFractal3D(params, fill, params.NoiseType == EFNNoiseType::PerlinFractal,
+			[&params](int32 offset, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SinglePerlin<TInterp>(params, offset, x, y, z); });
+		break;
+	}
+}
+
+// Resolves the noise type once and passes the matching kernel to fill
+template <typename FFill>
+static void DispatchNoise2D(const FFastNoiseParams& params, FFill fill)
+{
+	switch (params.NoiseType)
+	{
+	case EFNNoiseType::Value:
+	case EFNNoiseType::ValueFractal:
+	case EFNNoiseType::Perlin:
+	case EFNNoiseType::PerlinFractal:
+		switch (params.Interpolation)
+		{
+		case EFNInterp::Linear:
+			DispatchInterpNoise2D<FInterpLinear>(params, fill);
+			break;
+		case EFNInterp::Hermite:
+			DispatchInterpNoise2D<FInterpHermite>(params, fill);
+			break;
+		case EFNInterp::Quintic:
+			DispatchInterpNoise2D<FInterpQuintic>(params, fill);
+			break;
+		}
+		break;
+	case EFNNoiseType::Simplex:
+	case EFNNoiseType::SimplexFractal:
+		DispatchFractal2D(params, fill, params.NoiseType == EFNNoiseType::SimplexFractal,
+			[&params](int32 offset, FSIMDFloat x, FSIMDFloat y) { return SingleSimplex(params, offset, x, y); });
+		break;
+	case EFNNoiseType::Cellular:
+		DispatchCellularDistance(params, [&](auto distanceFunc) { DispatchCellularNoise2D<decltype(distanceFunc)>(params, fill); });
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
+}
+
+template <typename FFill>
+static void DispatchNoise3D(const FFastNoiseParams& params, FFill fill)
+{
+	switch (params.NoiseType)
+	{
+	case EFNNoiseType::Value:
+	case EFNNoiseType::ValueFractal:
+	case EFNNoiseType::Perlin:
+	case EFNNoiseType::PerlinFractal:
+		switch (params.Interpolation)
+		{
+		case EFNInterp::Linear:
+			DispatchInterpNoise3D<FInterpLinear>(params, fill);
+			break;
+		case EFNInterp::Hermite:
+			DispatchInterpNoise3D<FInterpHermite>(params, fill);
+			break;
+		case EFNInterp::Quintic:
+			DispatchInterpNoise3D<FInterpQuintic>(params, fill);
+			break;
+		}
+		break;
+	case EFNNoiseType::Simplex:
+	case EFNNoiseType::SimplexFractal:
+		DispatchFractal3D(params, fill, params.NoiseType == EFNNoiseType::SimplexFractal,
+			[&params](int32 offset, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleSimplex(params, offset, x, y, z); });
+		break;
+	case EFNNoiseType::Cellular:
+		DispatchCellularDistance(params, [&](auto distanceFunc) { DispatchCellularNoise3D<decltype(distanceFunc)>(params, fill); });
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
+}
+
+// Single point fractals
+// Octave i runs in lane i, its position, amplitude and OctaveOffset(i) are computed up front in the order SingleFractal uses
+// The lanes are summed in octave order afterwards, so the result matches the scalar fractal bit for bit
+template <EFNFractalType FractalType, typename FNoiseFunc>
+static FORCEINLINE float SingleOctaveFractal(const FFastNoiseParams& params, float x, float y, FNoiseFunc noiseFunc)
+{
+	int32 offsets[FSIMDFloat::Width] = {};
+	float xs[FSIMDFloat::Width] = {};
+	float ys[FSIMDFloat::Width] = {};
+	float amps[FSIMDFloat::Width] = {};
+	float values[FSIMDFloat::Width];
+
+	float sum = 0;
+	float amp = 1;
+	int32 i = 0;
+
+	while (i < params.FractalOctaves)
+	{
+		int32 lanes = FMath::Min(params.FractalOctaves - i, FSIMDFloat::Width);
+
+		for (int32 lane = 0; lane < lanes; lane++, i++)
+		{
+			if (i > 0)
+			{
+				x *= params.FractalLacunarity;
+				y *= params.FractalLacunarity;
+
+				amp *= params.FractalGain;
+				if (i == params.FractalOctaves - 1)
+					amp *= params.FractalFade;
+			}
+
+			offsets[lane] = params.OctaveOffset(i);
+			xs[lane] = x;
+			ys[lane] = y;
+			amps[lane] = amp;
+		}
+
+		FSIMDFloat octaves = FractalOctave<FractalType>(noiseFunc(FSIMDInt::Load(offsets), FSIMDFloat::Load(xs), FSIMDFloat::Load(ys)));
+		(octaves * FSIMDFloat::Load(amps)).Store(values);
+
+		// RigidMulti subtracts every octave after the first
+		for (int32 lane = 0, octave = i - lanes; lane < lanes; lane++, octave++)
+		{
+			if (octave == 0)
+				sum = values[lane];
+			else if (FractalType == EFNFractalType::RigidMulti)
+				sum -= values[lane];
+			else
+				sum += values[lane];
+		}
+	}
+
+	return FractalType == EFNFractalType::RigidMulti ? sum : sum * params.FractalBounding;
+}
+
+template <EFNFractalType FractalType, typename FNoiseFunc>
+static FORCEINLINE float SingleOctaveFractal(const FFastNoiseParams& params, float x, float y, float z, FNoiseFunc noiseFunc)
+{
+	int32 offsets[FSIMDFloat::Width] = {};
+	float xs[FSIMDFloat::Width] = {};
+	float ys[FSIMDFloat::Width] = {};
+	float zs[FSIMDFloat::Width] = {};
+	float amps[FSIMDFloat::Width] = {};
+	float values[FSIMDFloat::Width];
+
+	float sum = 0;
+	float amp = 1;
+	int32 i = 0;
+
+	while (i < params.FractalOctaves)
+	{
+		int32 lanes = FMath::Min(params.FractalOctaves - i, FSIMDFloat::Width);
+
+		for (int32 lane = 0; lane < lanes; lane++, i++)
+		{
+			if (i > 0)
+			{
+				x *= params.FractalLacunarity;
+				y *= params.FractalLacunarity;
+				z *= params.FractalLacunarity;
+
+				amp *= params.FractalGain;
+				if (i == params.FractalOctaves - 1)
+					amp *= params.FractalFade;
+			}
+
+			offsets[lane] = params.OctaveOffset(i);
+			xs[lane] = x;
+			ys[lane] = y;
+			zs[lane] = z;
+			amps[lane] = amp;
+		}
+
+		FSIMDFloat octaves = FractalOctave<FractalType>(noiseFunc(FSIMDInt::Load(offsets), FSIMDFloat::Load(xs), FSIMDFloat::Load(ys), FSIMDFloat::Load(zs)));
+		(octaves * FSIMDFloat::Load(amps)).Store(values);
+
+		for (int32 lane = 0, octave = i - lanes; lane < lanes; lane++, octave++)
+		{
+			if (octave == 0)
+				sum = values[lane];
+			else if (FractalType == EFNFractalType::RigidMulti)
+				sum -= values[lane];
+			else
+				sum += values[lane];
+		}
+	}
+
+	return FractalType == EFNFractalType::RigidMulti ? sum : sum * params.FractalBounding;
+}
+
+// Passes func the octave kernel of a Value, Perlin or Simplex fractal, with the offset given per lane
+template <typename FFunc>
+static FORCEINLINE void DispatchOctaveNoise2D(const FFastNoiseParams& params, EFNNoiseType noiseType, FFunc func)
+{
+	auto interpNoise = [&](auto interp)
+	{
+		using TInterp = decltype(interp);
+
+		if (noiseType == EFNNoiseType::ValueFractal)
+			func([&params](FSIMDInt offset, FSIMDFloat x, FSIMDFloat y) { return SingleValue<TInterp>(params, offset, x, y); });
+		else
+			func([&params](FSIMDInt offset, FSIMDFloat x, FSIMDFloat y) { return SinglePerlin<TInterp>(params, offset, x, y); });
+	};
+
+	switch (noiseType)
+	{
+	case EFNNoiseType::ValueFractal:
+	case EFNNoiseType::PerlinFractal:
+		switch (params.Interpolation)
+		{
+		case EFNInterp::Linear:
+			interpNoise(FInterpLinear());
+			break;
+		case EFNInterp::Hermite:
+			interpNoise(FInterpHermite());
+			break;
+		case EFNInterp::Quintic:
+			interpNoise(FInterpQuintic());
+			break;
+		}
+		break;
+	case EFNNoiseType::SimplexFractal:
+		func([&params](FSIMDInt offset, FSIMDFloat x, FSIMDFloat y) { return SingleSimplex(params, offset, x, y); });
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
+}
+
+template <typename FFunc>
+static FORCEINLINE void DispatchOctaveNoise3D(const FFastNoiseParams& params, EFNNoiseType noiseType, FFunc func)
+{
+	auto interpNoise = [&](auto interp)
+	{
+		using TInterp = decltype(interp);
+
+		if (noiseType == EFNNoiseType::ValueFractal)
+			func([&params](FSIMDInt offset, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleValue<TInterp>(params, offset, x, y, z); });
+		else
+			func([&params](FSIMDInt offset, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SinglePerlin<TInterp>(params, offset, x, y, z); });
+	};
+
+	switch (noiseType)
+	{
+	case EFNNoiseType::ValueFractal:
+	case EFNNoiseType::PerlinFractal:
+		switch (params.Interpolation)
+		{
+		case EFNInterp::Linear:
+			interpNoise(FInterpLinear());
+			break;
+		case EFNInterp::Hermite:
+			interpNoise(FInterpHermite());
+			break;
+		case EFNInterp::Quintic:
+			interpNoise(FInterpQuintic());
+			break;
+		}
+		break;
+	case EFNNoiseType::SimplexFractal:
+		func([&params](FSIMDInt offset, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z) { return SingleSimplex(params, offset, x, y, z); });
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
+}
+
+// Kernel table entry points
+static void FillSet2D(const FFastNoiseParams& params, float* noiseSet, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize)
+{
+	DispatchNoise2D(params, [&](auto noiseFunc) { ForEachNoiseSet(xCoords, yCoords, xSize, ySize, StoreNoise2D(noiseSet, noiseFunc)); });
+}
+
+static void FillSet3D(const FFastNoiseParams& params, float* noiseSet, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize)
+{
+	DispatchNoise3D(params, [&](auto noiseFunc) { ForEachNoiseSet(xCoords, yCoords, zCoords, xSize, ySize, zSize, StoreNoise3D(noiseSet, noiseFunc)); });
+}
+
+static void FillPointSet2D(const FFastNoiseParams& params, float* noiseSet, const float* xPoints, const float* yPoints, int32 count)
+{
+	DispatchNoise2D(params, [&](auto noiseFunc) { ForEachNoisePointSet(xPoints, yPoints, count, params.Frequency, StoreNoise2D(noiseSet, noiseFunc)); });
+}
+
+static void FillPointSet3D(const FFastNoiseParams& params, float* noiseSet, const float* xPoints, const float* yPoints, const float* zPoints, int32 count)
+{
+	DispatchNoise3D(params, [&](auto noiseFunc) { ForEachNoisePointSet(xPoints, yPoints, zPoints, count, params.Frequency, StoreNoise3D(noiseSet, noiseFunc)); });
+}
+
+static void FillCellularCellSet2D(const FFastNoiseParams& params, int32* xCell, int32* yCell, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize)
+{
+	DispatchCellularDistance(params, [&](auto distanceFunc)
+	{
+		ForEachNoiseSet(xCoords, yCoords, xSize, ySize, [&](int32 index, int32 count, FSIMDFloat x, FSIMDFloat y)
+		{
+			FSIMDInt xc, yc;
+			CellularClosest<decltype(distanceFunc)>(params, x, y, xc, yc);
+			StoreN(xCell + index, xc, count);
+			StoreN(yCell + index, yc, count);
+		});
+	});
+}
+
+static void FillCellularCellSet3D(const FFastNoiseParams& params, int32* xCell, int32* yCell, int32* zCell, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize)
+{
+	DispatchCellularDistance(params, [&](auto distanceFunc)
+	{
+		ForEachNoiseSet(xCoords, yCoords, zCoords, xSize, ySize, zSize, [&](int32 index, int32 count, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z)
+		{
+			FSIMDInt xc, yc, zc;
+			CellularClosest<decltype(distanceFunc)>(params, x, y, z, xc, yc, zc);
+			StoreN(xCell + index, xc, count);
+			StoreN(yCell + index, yc, count);
+			StoreN(zCell + index, zc, count);
+		});
+	});
+}
+
+static void FillCellularCellPointSet2D(const FFastNoiseParams& params, int32* xCell, int32* yCell, const float* xPoints, const float* yPoints, int32 count)
+{
+	DispatchCellularDistance(params, [&](auto distanceFunc)
+	{
+		ForEachNoisePointSet(xPoints, yPoints, count, params.Frequency, [&](int32 index, int32 lanes, FSIMDFloat x, FSIMDFloat y)
+		{
+			FSIMDInt xc, yc;
+			CellularClosest<decltype(distanceFunc)>(params, x, y, xc, yc);
+			StoreN(xCell + index, xc, lanes);
+			StoreN(yCell + index, yc, lanes);
+		});
+	});
+}
+
+static void FillCellularCellPointSet3D(const FFastNoiseParams& params, int32* xCell, int32* yCell, int32* zCell, const float* xPoints, const float* yPoints, const float* zPoints, int32 count)
+{
+	DispatchCellularDistance(params, [&](auto distanceFunc)
+	{
+		ForEachNoisePointSet(xPoints, yPoints, zPoints, count, params.Frequency, [&](int32 index, int32 lanes, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z)
+		{
+			FSIMDInt xc, yc, zc;
+			CellularClosest<decltype(distanceFunc)>(params, x, y, z, xc, yc, zc);
+			StoreN(xCell + index, xc, lanes);
+			StoreN(yCell + index, yc, lanes);
+			StoreN(zCell + index, zc, lanes);
+		});
+	});
+}
+
+// Passes func CellularDistanceIndex1 as an std::integral_constant, the cellular kernels only track as many distances as they need
+template <typename FFunc>
+static FORCEINLINE void DispatchCellularIndex(const FFastNoiseParams& params, FFunc func)
+{
+	switch (params.CellularDistanceIndex1)
+	{
+	case 0:
+		func(std::integral_constant<int32, 0>());
+		break;
+	case 1:
+		func(std::integral_constant<int32, 1>());
+		break;
+	case 2:
+		func(std::integral_constant<int32, 2>());
+		break;
+	default:
+		func(std::integral_constant<int32, FN_CELLULAR_INDEX_MAX>());
+		break;
+	}
+}
+
+// Stores the outputs sampleSet does not skip for the lanes of one vector of points, cell positions are divided by Frequency again
+static FORCEINLINE void StoreCellularSample(const FFastNoiseParams& params, const FFastNoiseCellularSampleSet& sampleSet, int32 index, int32 lanes, const FSIMDFloat (&distance)[FN_CELLULAR_INDEX_MAX + 1], FSIMDInt xc, FSIMDInt yc)
+{
+	FSIMDInt xl = LatticeX(params, xc);
+	FSIMDInt yl = LatticeY(params, yc);
+
+	if (sampleSet.Distance.Num())
+		StoreN(sampleSet.Distance.GetData() + index, distance[0], lanes);
+	if (sampleSet.Distance0.Num())
+		StoreN(sampleSet.Distance0.GetData() + index, distance[params.CellularDistanceIndex0], lanes);
+	if (sampleSet.Distance1.Num())
+		StoreN(sampleSet.Distance1.GetData() + index, distance[params.CellularDistanceIndex1], lanes);
+	if (sampleSet.CellValue.Num())
+		StoreN(sampleSet.CellValue.GetData() + index, ValCoord2D(params.Seed, xl, yl), lanes);
+	if (sampleSet.CellX.Num())
+		StoreN(sampleSet.CellX.GetData() + index, xl, lanes);
+	if (sampleSet.CellY.Num())
+		StoreN(sampleSet.CellY.GetData() + index, yl, lanes);
+
+	if (sampleSet.CellPositionX.Num() || sampleSet.CellPositionY.Num())
+	{
+		FSIMDInt lutPos = Index2D_256(params, 0, xl, yl);
+		FSIMDFloat frequency = params.Frequency;
+
+		if (sampleSet.CellPositionX.Num())
+			StoreN(sampleSet.CellPositionX.GetData() + index, (ToFloat(xc) + Gather(CELL_2D_X, lutPos) * params.CellularJitter) / frequency, lanes);
+		if (sampleSet.CellPositionY.Num())
+			StoreN(sampleSet.CellPositionY.GetData() + index, (ToFloat(yc) + Gather(CELL_2D_Y, lutPos) * params.CellularJitter) / frequency, lanes);
+	}
+}
+
+static FORCEINLINE void StoreCellularSample(const FFastNoiseParams& params, const FFastNoiseCellularSampleSet& sampleSet, int32 index, int32 lanes, const FSIMDFloat (&distance)[FN_CELLULAR_INDEX_MAX + 1], FSIMDInt xc, FSIMDInt yc, FSIMDInt zc)
+{
+	FSIMDInt xl = LatticeX(params, xc);
+	FSIMDInt yl = LatticeY(params, yc);
+	FSIMDInt zl = LatticeZ(params, zc);
+
+	if (sampleSet.Distance.Num())
+		StoreN(sampleSet.Distance.GetData() + index, distance[0], lanes);
+	if (sampleSet.Distance0.Num())
+		StoreN(sampleSet.Distance0.GetData() + index, distance[params.CellularDistanceIndex0], lanes);
+	if (sampleSet.Distance1.Num())
+		StoreN(sampleSet.Distance1.GetData() + index, distance[params.CellularDistanceIndex1], lanes);
+	if (sampleSet.CellValue.Num())
+		StoreN(sampleSet.CellValue.GetData() + index, ValCoord3D(params.Seed, xl, yl, zl), lanes);
+	if (sampleSet.CellX.Num())
+		StoreN(sampleSet.CellX.GetData() + index, xl, lanes);
+	if (sampleSet.CellY.Num())
+		StoreN(sampleSet.CellY.GetData() + index, yl, lanes);
+	if (sampleSet.CellZ.Num())
+		StoreN(sampleSet.CellZ.GetData() + index, zl, lanes);
+
+	if (sampleSet.CellPositionX.Num() || sampleSet.CellPositionY.Num() || sampleSet.CellPositionZ.Num())
+	{
+		FSIMDInt lutPos = Index3D_256(params, 0, xl, yl, zl);
+		FSIMDFloat frequency = params.Frequency;
+
+		if (sampleSet.CellPositionX.Num())
+			StoreN(sampleSet.CellPositionX.GetData() + index, (ToFloat(xc) + Gather(CELL_3D_X, lutPos) * params.CellularJitter) / frequency, lanes);
+		if (sampleSet.CellPositionY.Num())
+			StoreN(sampleSet.CellPositionY.GetData() + index, (ToFloat(yc) + Gather(CELL_3D_Y, lutPos) * params.CellularJitter) / frequency, lanes);
+		if (sampleSet.CellPositionZ.Num())
+			StoreN(sampleSet.CellPositionZ.GetData() + index, (ToFloat(zc) + Gather(CELL_3D_Z, lutPos) * params.CellularJitter) / frequency, lanes);
+	}
+}
+
+static void FillCellularSamplePointSet2D(const FFastNoiseParams& params, const FFastNoiseCellularSampleSet& sampleSet, const float* xPoints, const float* yPoints, int32 count)
+{
+	DispatchCellularDistance(params, [&](auto distanceFunc)
+	{
+		DispatchCellularIndex(params, [&](auto index1)
+		{
+			ForEachNoisePointSet(xPoints, yPoints, count, params.Frequency, [&](int32 index, int32 lanes, FSIMDFloat x, FSIMDFloat y)
+			{
+				FSIMDFloat distance[FN_CELLULAR_INDEX_MAX + 1];
+				FSIMDInt xc, yc;
+				CellularSample<decltype(distanceFunc), decltype(index1)::value>(params, x, y, distance, xc, yc);
+				StoreCellularSample(params, sampleSet, index, lanes, distance, xc, yc);
+			});
+		});
+	});
+}
+
+static void FillCellularSamplePointSet3D(const FFastNoiseParams& params, const FFastNoiseCellularSampleSet& sampleSet, const float* xPoints, const float* yPoints, const float* zPoints, int32 count)
+{
+	DispatchCellularDistance(params, [&](auto distanceFunc)
+	{
+		DispatchCellularIndex(params, [&](auto index1)
+		{
+			ForEachNoisePointSet(xPoints, yPoints, zPoints, count, params.Frequency, [&](int32 index, int32 lanes, FSIMDFloat x, FSIMDFloat y, FSIMDFloat z)
+			{
+				FSIMDFloat distance[FN_CELLULAR_INDEX_MAX + 1];
+				FSIMDInt xc, yc, zc;
+				CellularSample<decltype(distanceFunc), decltype(index1)::value>(params, x, y, z, distance, xc, yc, zc);
+				StoreCellularSample(params, sampleSet, index, lanes, distance, xc, yc, zc);
+			});
+		});
+	});
+}
+
+// Passes func the single vector warp selected by PerturbType and Interpolation, called as perturb(offset, warpAmp, frequency, x, y[, z])
+template <typename FFunc>
+static FORCEINLINE void DispatchPerturb(const FFastNoiseParams& params, FFunc func)
+{
+	if (params.PerturbType == EFNPerturbType::Simplex)
+	{
+		func([&params](int32 offset, float warpAmp, float frequency, auto&... coords) { SingleSimplexPerturb(params, offset, warpAmp, frequency, coords...); });
+		return;
+	}
+
+	switch (params.Interpolation)
+	{
+	case EFNInterp::Linear:
+		func([&params](int32 offset, float warpAmp, float frequency, auto&... coords) { SingleGradientPerturb<FInterpLinear>(params, offset, warpAmp, frequency, coords...); });
+		break;
+	case EFNInterp::Hermite:
+		func([&params](int32 offset, float warpAmp, float frequency, auto&... coords) { SingleGradientPerturb<FInterpHermite>(params, offset, warpAmp, frequency, coords...); });
+		break;
+	case EFNInterp::Quintic:
+		func([&params](int32 offset, float warpAmp, float frequency, auto&... coords) { SingleGradientPerturb<FInterpQuintic>(params, offset, warpAmp, frequency, coords...); });
+		break;
+	}
+}
+
+static void GradientPerturbPointSet2D(const FFastNoiseParams& params, float* xOut, float* yOut, const float* xPoints, const float* yPoints, int32 count, bool fractal)
+{
+	DispatchPerturb(params, [&](auto perturb)
+	{
+		for (int32 i = 0; i < count; i += FSIMDFloat::Width)
+		{
+			FSIMDFloat x = LoadN(xPoints + i, count - i);
+			FSIMDFloat y = LoadN(yPoints + i, count - i);
+
+			if (fractal)
+				SinglePerturbFractal(params, perturb, x, y);
+			else
+				perturb(0, params.GradientPerturbAmp, params.Frequency, x, y);
+
+			StoreN(xOut + i, x, count - i);
+			StoreN(yOut + i, y, count - i);
+		}
+	});
+}
+
+static void GradientPerturbPointSet3D(const FFastNoiseParams& params, float* xOut, float* yOut, float* zOut, const float* xPoints, const float* yPoints, const float* zPoints, int32 count, bool fractal)
+{
+	DispatchPerturb(params, [&](auto perturb)
+	{
+		for (int32 i = 0; i < count; i += FSIMDFloat::Width)
+		{
+			FSIMDFloat x = LoadN(xPoints + i, count - i);
+			FSIMDFloat y = LoadN(yPoints + i, count - i);
+			FSIMDFloat z = LoadN(zPoints + i, count - i);
+
+			if (fractal)
+				SinglePerturbFractal(params, perturb, x, y, z);
+			else
+				perturb(0, params.GradientPerturbAmp, params.Frequency, x, y, z);
+
+			StoreN(xOut + i, x, count - i);
+			StoreN(yOut + i, y, count - i);
+			StoreN(zOut + i, z, count - i);
+		}
+	});
+}
+
+static float SampleFractal2D(const FFastNoiseParams& params, EFNNoiseType noiseType, float x, float y)
+{
+	float noise = 0;
+
+	DispatchOctaveNoise2D(params, noiseType, [&](auto noiseFunc)
+	{
+		switch (params.FractalType)
+		{
+		case EFNFractalType::FBM:
+			noise = SingleOctaveFractal<EFNFractalType::FBM>(params, x, y, noiseFunc);
+			break;
+		case EFNFractalType::Billow:
+			noise = SingleOctaveFractal<EFNFractalType::Billow>(params, x, y, noiseFunc);
+			break;
+		case EFNFractalType::RigidMulti:
+			noise = SingleOctaveFractal<EFNFractalType::RigidMulti>(params, x, y, noiseFunc);
+			break;
+		}
+	});
+
+	return noise;
+}
+
+static float SampleFractal3D(const FFastNoiseParams& params, EFNNoiseType noiseType, float x, float y, float z)
+{
+	float noise = 0;
+
+	DispatchOctaveNoise3D(params, noiseType, [&](auto noiseFunc)
+	{
+		switch (params.FractalType)
+		{
+		case EFNFractalType::FBM:
+			noise = SingleOctaveFractal<EFNFractalType::FBM>(params, x, y, z, noiseFunc);
+			break;
+		case EFNFractalType::Billow:
+			noise = SingleOctaveFractal<EFNFractalType::Billow>(params, x, y, z, noiseFunc);
+			break;
+		case EFNFractalType::RigidMulti:
+			noise = SingleOctaveFractal<EFNFractalType::RigidMulti>(params, x, y, z, noiseFunc);
+			break;
+		}
+	});
+
+	return noise;
+}
+
+const FFastNoiseSIMDKernels Kernels =
+{
+	FSIMDFloat::Width,
+	&FillSet2D,
+	&FillSet3D,
+	&FillPointSet2D,
+	&FillPointSet3D,
+	&FillCellularCellSet2D,
+	&FillCellularCellSet3D,
+	&FillCellularCellPointSet2D,
+	&FillCellularCellPointSet3D,
+	&FillCellularSamplePointSet2D,
+	&FillCellularSamplePointSet3D,
+	&GradientPerturbPointSet2D,
+	&GradientPerturbPointSet3D,
+	&SampleFractal2D,
+	&SampleFractal3D,
+};
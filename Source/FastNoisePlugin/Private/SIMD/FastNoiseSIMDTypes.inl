@@ -0,0 +1,299 @@
+// FastNoiseSIMDTypes.inl
+//
+// Vector types used by FastNoiseSIMDKernels.inl
+// Included inside the namespace of a FastNoiseSIMD_<Level>.cpp after FN_SIMD_LEVEL is defined
+//
+// FSIMDFloat, FSIMDInt and FSIMDMask wrap one register of FSIMDFloat::Width lanes and provide
+// the operators the kernels need, so the kernels read like their scalar counterparts
+
+#if FN_SIMD_LEVEL == FN_SIMD_LEVEL_SSE2 || FN_SIMD_LEVEL == FN_SIMD_LEVEL_SSE41
+
+struct FSIMDMask
+{
+	__m128 V;
+
+	FORCEINLINE FSIMDMask(__m128 v) : V(v) {}
+};
+
+struct FSIMDInt
+{
+	__m128i V;
+
+	FORCEINLINE FSIMDInt() {}
+	FORCEINLINE FSIMDInt(__m128i v) : V(v) {}
+	FORCEINLINE FSIMDInt(int32 i) : V(_mm_set1_epi32(i)) {}
+
+	static FORCEINLINE FSIMDInt Load(const int32* p) { return _mm_loadu_si128((const __m128i*)p); }
+	FORCEINLINE void Store(int32* p) const { _mm_storeu_si128((__m128i*)p, V); }
+};
+
+struct FSIMDFloat
+{
+	static const int32 Width = 4;
+
+	__m128 V;
+
+	FORCEINLINE FSIMDFloat() {}
+	FORCEINLINE FSIMDFloat(__m128 v) : V(v) {}
+	FORCEINLINE FSIMDFloat(float f) : V(_mm_set1_ps(f)) {}
+
+	static FORCEINLINE FSIMDFloat Load(const float* p) { return _mm_loadu_ps(p); }
+	FORCEINLINE void Store(float* p) const { _mm_storeu_ps(p, V); }
+};
+
+FORCEINLINE FSIMDMask operator&(FSIMDMask a, FSIMDMask b) { return _mm_and_ps(a.V, b.V); }
+FORCEINLINE FSIMDMask operator|(FSIMDMask a, FSIMDMask b) { return _mm_or_ps(a.V, b.V); }
+FORCEINLINE FSIMDMask operator~(FSIMDMask a) { return _mm_xor_ps(a.V, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+FORCEINLINE bool AnyLane(FSIMDMask a) { return _mm_movemask_ps(a.V) != 0; }
+
+FORCEINLINE FSIMDFloat operator+(FSIMDFloat a, FSIMDFloat b) { return _mm_add_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat operator-(FSIMDFloat a, FSIMDFloat b) { return _mm_sub_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat operator*(FSIMDFloat a, FSIMDFloat b) { return _mm_mul_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat operator/(FSIMDFloat a, FSIMDFloat b) { return _mm_div_ps(a.V, b.V); }
+FORCEINLINE FSIMDMask operator<(FSIMDFloat a, FSIMDFloat b) { return _mm_cmplt_ps(a.V, b.V); }
+FORCEINLINE FSIMDMask operator>(FSIMDFloat a, FSIMDFloat b) { return _mm_cmpgt_ps(a.V, b.V); }
+FORCEINLINE FSIMDMask operator<=(FSIMDFloat a, FSIMDFloat b) { return _mm_cmple_ps(a.V, b.V); }
+FORCEINLINE FSIMDMask operator>=(FSIMDFloat a, FSIMDFloat b) { return _mm_cmpge_ps(a.V, b.V); }
+
+FORCEINLINE FSIMDFloat Min(FSIMDFloat a, FSIMDFloat b) { return _mm_min_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat Max(FSIMDFloat a, FSIMDFloat b) { return _mm_max_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat FastAbs(FSIMDFloat f) { return _mm_and_ps(f.V, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff))); }
+#if FN_SIMD_LEVEL == FN_SIMD_LEVEL_SSE41
+FORCEINLINE FSIMDFloat Select(FSIMDMask m, FSIMDFloat a, FSIMDFloat b) { return _mm_blendv_ps(b.V, a.V, m.V); }
+#else
+FORCEINLINE FSIMDFloat Select(FSIMDMask m, FSIMDFloat a, FSIMDFloat b) { return _mm_or_ps(_mm_and_ps(m.V, a.V), _mm_andnot_ps(m.V, b.V)); }
+#endif
+
+FORCEINLINE FSIMDInt operator+(FSIMDInt a, FSIMDInt b) { return _mm_add_epi32(a.V, b.V); }
+FORCEINLINE FSIMDInt operator-(FSIMDInt a, FSIMDInt b) { return _mm_sub_epi32(a.V, b.V); }
+FORCEINLINE FSIMDInt operator&(FSIMDInt a, FSIMDInt b) { return _mm_and_si128(a.V, b.V); }
+FORCEINLINE FSIMDInt operator|(FSIMDInt a, FSIMDInt b) { return _mm_or_si128(a.V, b.V); }
+FORCEINLINE FSIMDInt operator^(FSIMDInt a, FSIMDInt b) { return _mm_xor_si128(a.V, b.V); }
+FORCEINLINE FSIMDInt operator>>(FSIMDInt a, int32 shift) { return _mm_srai_epi32(a.V, shift); }
+FORCEINLINE FSIMDMask operator==(FSIMDInt a, FSIMDInt b) { return _mm_castsi128_ps(_mm_cmpeq_epi32(a.V, b.V)); }
+FORCEINLINE FSIMDMask operator<(FSIMDInt a, FSIMDInt b) { return _mm_castsi128_ps(_mm_cmplt_epi32(a.V, b.V)); }
+#if FN_SIMD_LEVEL == FN_SIMD_LEVEL_SSE41
+FORCEINLINE FSIMDInt operator*(FSIMDInt a, FSIMDInt b) { return _mm_mullo_epi32(a.V, b.V); }
+FORCEINLINE FSIMDInt Select(FSIMDMask m, FSIMDInt a, FSIMDInt b) { return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(b.V), _mm_castsi128_ps(a.V), m.V)); }
+#else
+FORCEINLINE FSIMDInt operator*(FSIMDInt a, FSIMDInt b)
+{
+	// SSE2 has no 32 bit multiply, multiply even and odd lanes as 64 bit and keep the low halves
+	__m128i even = _mm_mul_epu32(a.V, b.V);
+	__m128i odd = _mm_mul_epu32(_mm_srli_si128(a.V, 4), _mm_srli_si128(b.V, 4));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+FORCEINLINE FSIMDInt Select(FSIMDMask m, FSIMDInt a, FSIMDInt b)
+{
+	__m128i mi = _mm_castps_si128(m.V);
+	return _mm_or_si128(_mm_and_si128(mi, a.V), _mm_andnot_si128(mi, b.V));
+}
+#endif
+
+FORCEINLINE FSIMDInt ToInt(FSIMDFloat f) { return _mm_cvttps_epi32(f.V); }
+FORCEINLINE FSIMDFloat ToFloat(FSIMDInt i) { return _mm_cvtepi32_ps(i.V); }
+
+FORCEINLINE FSIMDInt Gather(const int32* table, FSIMDInt index)
+{
+	alignas(16) int32 i[4];
+	_mm_store_si128((__m128i*)i, index.V);
+	return _mm_set_epi32(table[i[3]], table[i[2]], table[i[1]], table[i[0]]);
+}
+FORCEINLINE FSIMDFloat Gather(const float* table, FSIMDInt index)
+{
+	alignas(16) int32 i[4];
+	_mm_store_si128((__m128i*)i, index.V);
+	return _mm_set_ps(table[i[3]], table[i[2]], table[i[1]], table[i[0]]);
+}
+
+#elif FN_SIMD_LEVEL == FN_SIMD_LEVEL_AVX2
+
+struct FSIMDMask
+{
+	__m256 V;
+
+	FORCEINLINE FSIMDMask(__m256 v) : V(v) {}
+};
+
+struct FSIMDInt
+{
+	__m256i V;
+
+	FORCEINLINE FSIMDInt() {}
+	FORCEINLINE FSIMDInt(__m256i v) : V(v) {}
+	FORCEINLINE FSIMDInt(int32 i) : V(_mm256_set1_epi32(i)) {}
+
+	static FORCEINLINE FSIMDInt Load(const int32* p) { return _mm256_loadu_si256((const __m256i*)p); }
+	FORCEINLINE void Store(int32* p) const { _mm256_storeu_si256((__m256i*)p, V); }
+};
+
+struct FSIMDFloat
+{
+	static const int32 Width = 8;
+
+	__m256 V;
+
+	FORCEINLINE FSIMDFloat() {}
+	FORCEINLINE FSIMDFloat(__m256 v) : V(v) {}
+	FORCEINLINE FSIMDFloat(float f) : V(_mm256_set1_ps(f)) {}
+
+	static FORCEINLINE FSIMDFloat Load(const float* p) { return _mm256_loadu_ps(p); }
+	FORCEINLINE void Store(float* p) const { _mm256_storeu_ps(p, V); }
+};
+
+FORCEINLINE FSIMDMask operator&(FSIMDMask a, FSIMDMask b) { return _mm256_and_ps(a.V, b.V); }
+FORCEINLINE FSIMDMask operator|(FSIMDMask a, FSIMDMask b) { return _mm256_or_ps(a.V, b.V); }
+FORCEINLINE FSIMDMask operator~(FSIMDMask a) { return _mm256_xor_ps(a.V, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+FORCEINLINE bool AnyLane(FSIMDMask a) { return _mm256_movemask_ps(a.V) != 0; }
+
+FORCEINLINE FSIMDFloat operator+(FSIMDFloat a, FSIMDFloat b) { return _mm256_add_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat operator-(FSIMDFloat a, FSIMDFloat b) { return _mm256_sub_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat operator*(FSIMDFloat a, FSIMDFloat b) { return _mm256_mul_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat operator/(FSIMDFloat a, FSIMDFloat b) { return _mm256_div_ps(a.V, b.V); }
+FORCEINLINE FSIMDMask operator<(FSIMDFloat a, FSIMDFloat b) { return _mm256_cmp_ps(a.V, b.V, _CMP_LT_OQ); }
+FORCEINLINE FSIMDMask operator>(FSIMDFloat a, FSIMDFloat b) { return _mm256_cmp_ps(a.V, b.V, _CMP_GT_OQ); }
+FORCEINLINE FSIMDMask operator<=(FSIMDFloat a, FSIMDFloat b) { return _mm256_cmp_ps(a.V, b.V, _CMP_LE_OQ); }
+FORCEINLINE FSIMDMask operator>=(FSIMDFloat a, FSIMDFloat b) { return _mm256_cmp_ps(a.V, b.V, _CMP_GE_OQ); }
+
+FORCEINLINE FSIMDFloat Min(FSIMDFloat a, FSIMDFloat b) { return _mm256_min_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat Max(FSIMDFloat a, FSIMDFloat b) { return _mm256_max_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat FastAbs(FSIMDFloat f) { return _mm256_and_ps(f.V, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff))); }
+FORCEINLINE FSIMDFloat Select(FSIMDMask m, FSIMDFloat a, FSIMDFloat b) { return _mm256_blendv_ps(b.V, a.V, m.V); }
+
+FORCEINLINE FSIMDInt operator+(FSIMDInt a, FSIMDInt b) { return _mm256_add_epi32(a.V, b.V); }
+FORCEINLINE FSIMDInt operator-(FSIMDInt a, FSIMDInt b) { return _mm256_sub_epi32(a.V, b.V); }
+FORCEINLINE FSIMDInt operator&(FSIMDInt a, FSIMDInt b) { return _mm256_and_si256(a.V, b.V); }
+FORCEINLINE FSIMDInt operator|(FSIMDInt a, FSIMDInt b) { return _mm256_or_si256(a.V, b.V); }
+FORCEINLINE FSIMDInt operator^(FSIMDInt a, FSIMDInt b) { return _mm256_xor_si256(a.V, b.V); }
+FORCEINLINE FSIMDInt operator>>(FSIMDInt a, int32 shift) { return _mm256_srai_epi32(a.V, shift); }
+FORCEINLINE FSIMDMask operator==(FSIMDInt a, FSIMDInt b) { return _mm256_castsi256_ps(_mm256_cmpeq_epi32(a.V, b.V)); }
+FORCEINLINE FSIMDMask operator<(FSIMDInt a, FSIMDInt b) { return _mm256_castsi256_ps(_mm256_cmpgt_epi32(b.V, a.V)); }
+FORCEINLINE FSIMDInt operator*(FSIMDInt a, FSIMDInt b) { return _mm256_mullo_epi32(a.V, b.V); }
+FORCEINLINE FSIMDInt Select(FSIMDMask m, FSIMDInt a, FSIMDInt b) { return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(b.V), _mm256_castsi256_ps(a.V), m.V)); }
+
+FORCEINLINE FSIMDInt ToInt(FSIMDFloat f) { return _mm256_cvttps_epi32(f.V); }
+FORCEINLINE FSIMDFloat ToFloat(FSIMDInt i) { return _mm256_cvtepi32_ps(i.V); }
+
+FORCEINLINE FSIMDInt Gather(const int32* table, FSIMDInt index) { return _mm256_i32gather_epi32((const int*)table, index.V, 4); }
+FORCEINLINE FSIMDFloat Gather(const float* table, FSIMDInt index) { return _mm256_i32gather_ps(table, index.V, 4); }
+
+#elif FN_SIMD_LEVEL == FN_SIMD_LEVEL_AVX512
+
+// AVX-512 compares write to a mask register instead of a vector
+struct FSIMDMask
+{
+	__mmask16 V;
+
+	FORCEINLINE FSIMDMask(__mmask16 v) : V(v) {}
+};
+
+struct FSIMDInt
+{
+	__m512i V;
+
+	FORCEINLINE FSIMDInt() {}
+	FORCEINLINE FSIMDInt(__m512i v) : V(v) {}
+	FORCEINLINE FSIMDInt(int32 i) : V(_mm512_set1_epi32(i)) {}
+
+	static FORCEINLINE FSIMDInt Load(const int32* p) { return _mm512_loadu_si512(p); }
+	FORCEINLINE void Store(int32* p) const { _mm512_storeu_si512(p, V); }
+};
+
+struct FSIMDFloat
+{
+	static const int32 Width = 16;
+
+	__m512 V;
+
+	FORCEINLINE FSIMDFloat() {}
+	FORCEINLINE FSIMDFloat(__m512 v) : V(v) {}
+	FORCEINLINE FSIMDFloat(float f) : V(_mm512_set1_ps(f)) {}
+
+	static FORCEINLINE FSIMDFloat Load(const float* p) { return _mm512_loadu_ps(p); }
+	FORCEINLINE void Store(float* p) const { _mm512_storeu_ps(p, V); }
+};
+
+FORCEINLINE FSIMDMask operator&(FSIMDMask a, FSIMDMask b) { return _mm512_kand(a.V, b.V); }
+FORCEINLINE FSIMDMask operator|(FSIMDMask a, FSIMDMask b) { return _mm512_kor(a.V, b.V); }
+FORCEINLINE FSIMDMask operator~(FSIMDMask a) { return _mm512_knot(a.V); }
+FORCEINLINE bool AnyLane(FSIMDMask a) { return a.V != 0; }
+
+FORCEINLINE FSIMDFloat operator+(FSIMDFloat a, FSIMDFloat b) { return _mm512_add_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat operator-(FSIMDFloat a, FSIMDFloat b) { return _mm512_sub_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat operator*(FSIMDFloat a, FSIMDFloat b) { return _mm512_mul_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat operator/(FSIMDFloat a, FSIMDFloat b) { return _mm512_div_ps(a.V, b.V); }
+FORCEINLINE FSIMDMask operator<(FSIMDFloat a, FSIMDFloat b) { return _mm512_cmp_ps_mask(a.V, b.V, _CMP_LT_OQ); }
+FORCEINLINE FSIMDMask operator>(FSIMDFloat a, FSIMDFloat b) { return _mm512_cmp_ps_mask(a.V, b.V, _CMP_GT_OQ); }
+FORCEINLINE FSIMDMask operator<=(FSIMDFloat a, FSIMDFloat b) { return _mm512_cmp_ps_mask(a.V, b.V, _CMP_LE_OQ); }
+FORCEINLINE FSIMDMask operator>=(FSIMDFloat a, FSIMDFloat b) { return _mm512_cmp_ps_mask(a.V, b.V, _CMP_GE_OQ); }
+
+FORCEINLINE FSIMDFloat Min(FSIMDFloat a, FSIMDFloat b) { return _mm512_min_ps(a.V, b.V); }
+FORCEINLINE FSIMDFloat Max(FSIMDFloat a, FSIMDFloat b) { return _mm512_max_ps(a.V, b.V); }
+// Float and/andnot need AVX-512DQ, use the integer versions so AVX-512F is enough
+FORCEINLINE FSIMDFloat FastAbs(FSIMDFloat f) { return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(f.V), _mm512_set1_epi32(0x7fffffff))); }
+FORCEINLINE FSIMDFloat Select(FSIMDMask m, FSIMDFloat a, FSIMDFloat b) { return _mm512_mask_blend_ps(m.V, b.V, a.V); }
+
+FORCEINLINE FSIMDInt operator+(FSIMDInt a, FSIMDInt b) { return _mm512_add_epi32(a.V, b.V); }
+FORCEINLINE FSIMDInt operator-(FSIMDInt a, FSIMDInt b) { return _mm512_sub_epi32(a.V, b.V); }
+FORCEINLINE FSIMDInt operator&(FSIMDInt a, FSIMDInt b) { return _mm512_and_si512(a.V, b.V); }
+FORCEINLINE FSIMDInt operator|(FSIMDInt a, FSIMDInt b) { return _mm512_or_si512(a.V, b.V); }
+FORCEINLINE FSIMDInt operator^(FSIMDInt a, FSIMDInt b) { return _mm512_xor_si512(a.V, b.V); }
+FORCEINLINE FSIMDInt operator>>(FSIMDInt a, int32 shift) { return _mm512_srai_epi32(a.V, shift); }
+FORCEINLINE FSIMDMask operator==(FSIMDInt a, FSIMDInt b) { return _mm512_cmpeq_epi32_mask(a.V, b.V); }
+FORCEINLINE FSIMDMask operator<(FSIMDInt a, FSIMDInt b) { return _mm512_cmplt_epi32_mask(a.V, b.V); }
+FORCEINLINE FSIMDInt operator*(FSIMDInt a, FSIMDInt b) { return _mm512_mullo_epi32(a.V, b.V); }
+FORCEINLINE FSIMDInt Select(FSIMDMask m, FSIMDInt a, FSIMDInt b) { return _mm512_mask_blend_epi32(m.V, b.V, a.V); }
+
+FORCEINLINE FSIMDInt ToInt(FSIMDFloat f) { return _mm512_cvttps_epi32(f.V); }
+FORCEINLINE FSIMDFloat ToFloat(FSIMDInt i) { return _mm512_cvtepi32_ps(i.V); }
+
+FORCEINLINE FSIMDInt Gather(const int32* table, FSIMDInt index) { return _mm512_i32gather_epi32(index.V, table, 4); }
+FORCEINLINE FSIMDFloat Gather(const float* table, FSIMDInt index) { return _mm512_i32gather_ps(index.V, table, 4); }
+
+#else
+#error "FastNoiseSIMDTypes.inl included without a supported FN_SIMD_LEVEL"
+#endif
+
+// Shared helpers built on the level specific operators above
+
+FORCEINLINE FSIMDFloat& operator+=(FSIMDFloat& a, FSIMDFloat b) { return a = a + b; }
+FORCEINLINE FSIMDFloat& operator-=(FSIMDFloat& a, FSIMDFloat b) { return a = a - b; }
+FORCEINLINE FSIMDFloat& operator*=(FSIMDFloat& a, FSIMDFloat b) { return a = a * b; }
+
+// Stores the first count lanes of v, count may exceed the vector width
+FORCEINLINE void StoreN(float* p, FSIMDFloat v, int32 count)
+{
+	if (count >= FSIMDFloat::Width)
+	{
+		v.Store(p);
+		return;
+	}
+
+	float lanes[FSIMDFloat::Width];
+	v.Store(lanes);
+	FMemory::Memcpy(p, lanes, count * sizeof(float));
+}
+
+FORCEINLINE void StoreN(int32* p, FSIMDInt v, int32 count)
+{
+	if (count >= FSIMDFloat::Width)
+	{
+		v.Store(p);
+		return;
+	}
+
+	int32 lanes[FSIMDFloat::Width];
+	v.Store(lanes);
+	FMemory::Memcpy(p, lanes, count * sizeof(int32));
+}
+
+// Loads the first count lanes of p and zeroes the rest, count may exceed the vector width
+FORCEINLINE FSIMDFloat LoadN(const float* p, int32 count)
+{
+	if (count >= FSIMDFloat::Width)
+		return FSIMDFloat::Load(p);
+
+	float lanes[FSIMDFloat::Width] = {};
+	FMemory::Memcpy(lanes, p, count * sizeof(float));
+	return FSIMDFloat::Load(lanes);
+}
@@ -0,0 +1,25 @@
+// FastNoiseSIMD_AVX2.cpp
+//
+// AVX2 instantiation of the vectorized noise kernels
+// Only called after FastNoiseSIMD has checked that the CPU supports AVX2
+
+#include "SIMD/FastNoiseSIMD.h"
+
+#if FN_SIMD_AVX2
+#include "FastNoiseLUT.h"
+
+#include <immintrin.h>
+
+FN_SIMD_TARGET_BEGIN_AVX2
+
+namespace FastNoiseSIMD_AVX2
+{
+#define FN_SIMD_LEVEL FN_SIMD_LEVEL_AVX2
+#include "SIMD/FastNoiseSIMDTypes.inl"
+#include "SIMD/FastNoiseSIMDKernels.inl"
+#undef FN_SIMD_LEVEL
+}
+
+FN_SIMD_TARGET_END
+
+#endif
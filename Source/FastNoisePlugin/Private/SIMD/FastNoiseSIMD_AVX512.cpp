@@ -0,0 +1,25 @@
+// FastNoiseSIMD_AVX512.cpp
+//
+// AVX-512 instantiation of the vectorized noise kernels
+// Only called after FastNoiseSIMD has checked that the CPU supports AVX-512
+
+#include "SIMD/FastNoiseSIMD.h"
+
+#if FN_SIMD_AVX512
+#include "FastNoiseLUT.h"
+
+#include <immintrin.h>
+
+FN_SIMD_TARGET_BEGIN_AVX512
+
+namespace FastNoiseSIMD_AVX512
+{
+#define FN_SIMD_LEVEL FN_SIMD_LEVEL_AVX512
+#include "SIMD/FastNoiseSIMDTypes.inl"
+#include "SIMD/FastNoiseSIMDKernels.inl"
+#undef FN_SIMD_LEVEL
+}
+
+FN_SIMD_TARGET_END
+
+#endif
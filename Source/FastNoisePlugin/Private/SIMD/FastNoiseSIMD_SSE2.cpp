@@ -0,0 +1,20 @@
+// FastNoiseSIMD_SSE2.cpp
+//
+// SSE2 instantiation of the vectorized noise kernels
+
+#include "SIMD/FastNoiseSIMD.h"
+
+#if FN_SIMD_SSE2
+#include "FastNoiseLUT.h"
+
+#include <emmintrin.h>
+
+namespace FastNoiseSIMD_SSE2
+{
+#define FN_SIMD_LEVEL FN_SIMD_LEVEL_SSE2
+#include "SIMD/FastNoiseSIMDTypes.inl"
+#include "SIMD/FastNoiseSIMDKernels.inl"
+#undef FN_SIMD_LEVEL
+}
+
+#endif
@@ -0,0 +1,25 @@
+// FastNoiseSIMD_SSE41.cpp
+//
+// SSE4.1 instantiation of the vectorized noise kernels
+// Only called after FastNoiseSIMD has checked that the CPU supports SSE4.1
+
+#include "SIMD/FastNoiseSIMD.h"
+
+#if FN_SIMD_SSE41
+#include "FastNoiseLUT.h"
+
+#include <smmintrin.h>
+
+FN_SIMD_TARGET_BEGIN_SSE41
+
+namespace FastNoiseSIMD_SSE41
+{
+#define FN_SIMD_LEVEL FN_SIMD_LEVEL_SSE41
+#include "SIMD/FastNoiseSIMDTypes.inl"
+#include "SIMD/FastNoiseSIMDKernels.inl"
+#undef FN_SIMD_LEVEL
+}
+
+FN_SIMD_TARGET_END
+
+#endif
@@ -0,0 +1,84 @@
+// FastNoiseAsyncTest.cpp
+//
+// An async request completes with the floats of GetNoiseSet2D/3D(...), a cancelled one completes with an empty array
+// The completion delegates run on the game thread, which the test occupies, so only the futures are checked
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseAsyncTest, "FastNoise.Async", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Long enough to wait for a worker that is still filling a large grid, short enough to fail rather than hang
+static const double ResultTimeout = 60.0;
+
+static const TArray<float>* WaitForResult(FAutomationTestBase& test, const FString& what, const FFastNoiseAsyncRequestRef& request)
+{
+	if (!request->Result.WaitFor(FTimespan::FromSeconds(ResultTimeout)))
+	{
+		test.AddError(what + TEXT(": the request did not complete"));
+		return nullptr;
+	}
+
+	return &request->Result.Get();
+}
+
+bool FFastNoiseAsyncTest::RunTest(const FString& Parameters)
+{
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetNoiseType(EFNNoiseType::SimplexFractal);
+	noise->SetFrequency(0.05f);
+
+	// Several tiles each, the last one partial
+	const int32 xSize = 97, ySize = 83, zSize = 5;
+
+	TArray<float> expected2D, expected3D;
+	expected2D.SetNumUninitialized(xSize * ySize);
+	expected3D.SetNumUninitialized(xSize * ySize * zSize);
+
+	FFastNoiseAsyncRequestRef request2D = noise->GetNoiseSet2DAsync(-20.5f, 3.25f, xSize, ySize, 0.5f);
+	FFastNoiseAsyncRequestRef request3D = noise->GetNoiseSet3DAsync(-20.5f, 3.25f, 7.0f, xSize, ySize, zSize, 0.5f);
+
+	noise->GetNoiseSet2D(expected2D, -20.5f, 3.25f, xSize, ySize, 0.5f);
+	noise->GetNoiseSet3D(expected3D, -20.5f, 3.25f, 7.0f, xSize, ySize, zSize, 0.5f);
+
+	// The requests work on snapshots, changing the noise now must not reach them
+	noise->SetSeed(noise->GetSeed() + 1);
+
+	if (const TArray<float>* result = WaitForResult(*this, TEXT("GetNoiseSet2DAsync"), request2D))
+	{
+		if (TestEqual(TEXT("GetNoiseSet2DAsync result size"), result->Num(), xSize * ySize))
+			FastNoiseTest::TestValues(*this, TEXT("GetNoiseSet2DAsync"), result->GetData(), expected2D.GetData(), xSize * ySize);
+	}
+
+	if (const TArray<float>* result = WaitForResult(*this, TEXT("GetNoiseSet3DAsync"), request3D))
+	{
+		if (TestEqual(TEXT("GetNoiseSet3DAsync result size"), result->Num(), xSize * ySize * zSize))
+			FastNoiseTest::TestValues(*this, TEXT("GetNoiseSet3DAsync"), result->GetData(), expected3D.GetData(), xSize * ySize * zSize);
+	}
+
+	// Hundreds of tiles, the worker is still on the first ones when the request is cancelled
+	noise->SetFractalOctaves(8);
+
+	FFastNoiseAsyncRequestRef cancelled2D = noise->GetNoiseSet2DAsync(0.0f, 0.0f, 2048, 2048);
+	FFastNoiseAsyncRequestRef cancelled3D = noise->GetNoiseSet3DAsync(0.0f, 0.0f, 0.0f, 160, 160, 160);
+	cancelled2D->Cancel();
+	cancelled3D->Cancel();
+
+	TestTrue(TEXT("Cancelled 2D request IsCancelled()"), cancelled2D->IsCancelled());
+	TestTrue(TEXT("Cancelled 3D request IsCancelled()"), cancelled3D->IsCancelled());
+
+	// Completing at all shows the worker stopped, an empty array shows it dropped the tiles instead of finishing the set
+	if (const TArray<float>* result = WaitForResult(*this, TEXT("Cancelled GetNoiseSet2DAsync"), cancelled2D))
+		TestEqual(TEXT("Cancelled GetNoiseSet2DAsync result size"), result->Num(), 0);
+
+	if (const TArray<float>* result = WaitForResult(*this, TEXT("Cancelled GetNoiseSet3DAsync"), cancelled3D))
+		TestEqual(TEXT("Cancelled GetNoiseSet3DAsync result size"), result->Num(), 0);
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,139 @@
+// FastNoiseBandLimitedTest.cpp
+//
+// Band limited noise with a footprint too small to drop an octave promises the floats of the full fractal,
+// one too large for all but the first octave gives that octave at the full fractal's amplitude, and between the two
+// the octaves fade out without a jump as the footprint grows
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseBandLimitedTest, "FastNoise.BandLimited", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+static const float NoiseFrequency = 0.11f;
+static const int32 NoiseOctaves = 4;
+
+// The finest octave has cells of 1 / (0.11 * 8) units, both footprints are a small fraction of that
+static const float SmallFootprint = 0.01f;
+static const float SmallStep = 0.02f;
+
+// Half a cell of the first octave and more
+static const float LargeFootprint = 50.0f;
+
+// A 5% wider footprint at a time, over the range the octaves are dropped in
+static const float SweepStart = 0.05f;
+static const float SweepFactor = 1.05f;
+static const int32 SweepSteps = 120;
+
+// A fade step removes under a tenth of an octave, dropping the second octave outright could move the noise by 0.25
+static const float MaxSweepChange = 0.04f;
+
+static const int32 PointCount = 31;
+
+static const int32 GridSize[3] = { 13, 9, 3 };
+
+bool FFastNoiseBandLimitedTest::RunTest(const FString& Parameters)
+{
+	TArray<float> xPoints, yPoints, zPoints;
+	for (int32 i = 0; i < PointCount; i++)
+	{
+		xPoints.Add(i * 6.13f - 95.3f);
+		yPoints.Add((i * 13 % PointCount) * -4.07f + 52.9f);
+		zPoints.Add((i * 17 % PointCount) * 2.71f - 33.1f);
+	}
+
+	const int32 count2D = GridSize[0] * GridSize[1];
+	const int32 count3D = count2D * GridSize[2];
+
+	TArray<float> values, expected;
+	values.SetNumUninitialized(count3D);
+	expected.SetNumUninitialized(count3D);
+
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetFrequency(NoiseFrequency);
+	noise->SetFractalOctaves(NoiseOctaves);
+
+	for (int32 type = 0; type <= (int32)EFNNoiseType::CubicFractal; type++)
+	{
+		noise->SetNoiseType((EFNNoiseType)type);
+
+		for (int32 fractal = 0; fractal <= (int32)EFNFractalType::RigidMulti; fractal++)
+		{
+			noise->SetFractalType((EFNFractalType)fractal);
+			const FString settings = FString::Printf(TEXT("NoiseType %d FractalType %d"), type, fractal);
+
+			for (int32 i = 0; i < PointCount; i++)
+			{
+				values[i] = noise->GetNoiseBandLimited2D(xPoints[i], yPoints[i], SmallFootprint);
+				expected[i] = noise->GetNoise2D(xPoints[i], yPoints[i]);
+			}
+			FastNoiseTest::TestValues(*this, TEXT("GetNoiseBandLimited2D with a small footprint ") + settings, values.GetData(), expected.GetData(), PointCount);
+
+			for (int32 i = 0; i < PointCount; i++)
+			{
+				values[i] = noise->GetNoiseBandLimited3D(xPoints[i], yPoints[i], zPoints[i], SmallFootprint);
+				expected[i] = noise->GetNoise3D(xPoints[i], yPoints[i], zPoints[i]);
+			}
+			FastNoiseTest::TestValues(*this, TEXT("GetNoiseBandLimited3D with a small footprint ") + settings, values.GetData(), expected.GetData(), PointCount);
+
+			noise->GetNoiseSetBandLimited2D(values, xPoints[0], yPoints[0], GridSize[0], GridSize[1], SmallStep);
+			noise->GetNoiseSet2D(expected, xPoints[0], yPoints[0], GridSize[0], GridSize[1], SmallStep);
+			FastNoiseTest::TestValues(*this, TEXT("GetNoiseSetBandLimited2D with a small step ") + settings, values.GetData(), expected.GetData(), count2D);
+
+			noise->GetNoiseSetBandLimited3D(values, xPoints[0], yPoints[0], zPoints[0], GridSize[0], GridSize[1], GridSize[2], SmallStep);
+			noise->GetNoiseSet3D(expected, xPoints[0], yPoints[0], zPoints[0], GridSize[0], GridSize[1], GridSize[2], SmallStep);
+			FastNoiseTest::TestValues(*this, TEXT("GetNoiseSetBandLimited3D with a small step ") + settings, values.GetData(), expected.GetData(), count3D);
+		}
+	}
+
+	// FBM sums the octaves as they are, so the first octave alone is the one octave noise scaled to the full fractal's bounding
+	const EFNNoiseType fractalTypes[] = { EFNNoiseType::ValueFractal, EFNNoiseType::PerlinFractal, EFNNoiseType::SimplexFractal, EFNNoiseType::CubicFractal };
+
+	UFastNoise* firstOctave = NewObject<UFastNoise>();
+	firstOctave->SetFrequency(NoiseFrequency);
+	firstOctave->SetFractalOctaves(1);
+
+	noise->SetFractalType(EFNFractalType::FBM);
+	const float bounding = FFastNoiseParams::CalculateFractalBounding(NoiseOctaves, noise->GetFractalGain());
+
+	for (EFNNoiseType noiseType : fractalTypes)
+	{
+		noise->SetNoiseType(noiseType);
+		firstOctave->SetNoiseType(noiseType);
+
+		for (int32 i = 0; i < PointCount; i++)
+		{
+			const FString what = FString::Printf(TEXT("NoiseType %d point %d"), (int32)noiseType, i);
+
+			TestEqual(TEXT("GetNoiseBandLimited2D with a large footprint ") + what, noise->GetNoiseBandLimited2D(xPoints[i], yPoints[i], LargeFootprint), firstOctave->GetNoise2D(xPoints[i], yPoints[i]) * bounding, 1e-6f);
+			TestEqual(TEXT("GetNoiseBandLimited3D with a large footprint ") + what, noise->GetNoiseBandLimited3D(xPoints[i], yPoints[i], zPoints[i], LargeFootprint), firstOctave->GetNoise3D(xPoints[i], yPoints[i], zPoints[i]) * bounding, 1e-6f);
+		}
+
+		for (int32 i = 0; i < PointCount; i++)
+		{
+			float footprint = SweepStart;
+			float previous2D = noise->GetNoiseBandLimited2D(xPoints[i], yPoints[i], footprint);
+			float previous3D = noise->GetNoiseBandLimited3D(xPoints[i], yPoints[i], zPoints[i], footprint);
+
+			for (int32 step = 0; step < SweepSteps; step++)
+			{
+				footprint *= SweepFactor;
+				const float value2D = noise->GetNoiseBandLimited2D(xPoints[i], yPoints[i], footprint);
+				const float value3D = noise->GetNoiseBandLimited3D(xPoints[i], yPoints[i], zPoints[i], footprint);
+				const FString what = FString::Printf(TEXT("NoiseType %d point %d footprint %g"), (int32)noiseType, i, footprint);
+
+				TestEqual(TEXT("GetNoiseBandLimited2D sweep ") + what, value2D, previous2D, MaxSweepChange);
+				TestEqual(TEXT("GetNoiseBandLimited3D sweep ") + what, value3D, previous3D, MaxSweepChange);
+				previous2D = value2D;
+				previous3D = value3D;
+			}
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,94 @@
+// FastNoiseBaselineTest.cpp
+//
+// GetNoise2D/3D(...) on the scalar path has to keep the results the plugin gave before the SIMD kernels
+// The expected values were taken from the plain scalar implementation with its default settings, frequency 0.11 and a Perlin lookup
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "SIMD/FastNoiseSIMD.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseBaselineTest, "FastNoise.Baseline", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+static const float BaselinePoints[4][3] = { { -13.7f, 7.3f, 2.1f }, { 0.4f, -0.9f, 19.6f }, { 101.25f, 56.5f, -7.75f }, { -250.3f, -333.9f, 41.2f } };
+
+struct FFastNoiseBaseline
+{
+	EFNNoiseType NoiseType;
+	EFNFractalType FractalType;
+	EFNCellularReturnType CellularReturnType;
+	float Noise2D[4];
+	float Noise3D[4];
+};
+
+static const FFastNoiseBaseline Baselines[] =
+{
+	{ EFNNoiseType::Value, EFNFractalType::FBM, EFNCellularReturnType::CellValue, { -0.423231214f, 0.508330166f, 0.745359719f, 0.233966753f }, { -0.59829694f, 0.0490796939f, 0.134357408f, -0.0631874651f } },
+	{ EFNNoiseType::ValueFractal, EFNFractalType::FBM, EFNCellularReturnType::CellValue, { -0.583188653f, 0.091364421f, -0.599897265f, -0.21428971f }, { 0.017218437f, 0.427637428f, 0.096933268f, -0.0534652658f } },
+	{ EFNNoiseType::ValueFractal, EFNFractalType::Billow, EFNCellularReturnType::CellValue, { 0.166377157f, -0.610163927f, 0.199794382f, 0.486823589f }, { -0.614698172f, -0.0861250535f, -0.581303596f, -0.86084497f } },
+	{ EFNNoiseType::ValueFractal, EFNFractalType::RigidMulti, EFNCellularReturnType::CellValue, { -0.0697696507f, 0.164982229f, -0.327322602f, -0.125006959f }, { 0.280132294f, 0.240068123f, 0.0857304037f, 0.343564212f } },
+	{ EFNNoiseType::Perlin, EFNFractalType::FBM, EFNCellularReturnType::CellValue, { -0.283551395f, -0.096898675f, 0.00124603882f, -0.259315491f }, { -0.0866831243f, -0.218573779f, 0.300361484f, 0.15299122f } },
+	{ EFNNoiseType::PerlinFractal, EFNFractalType::FBM, EFNCellularReturnType::CellValue, { 0.190002784f, -0.105785452f, 0.0795391127f, -0.293800682f }, { 0.164466009f, 0.089754656f, -0.161745906f, -0.140778258f } },
+	{ EFNNoiseType::PerlinFractal, EFNFractalType::Billow, EFNCellularReturnType::CellValue, { -0.619994462f, -0.788429081f, -0.62953037f, -0.412398696f }, { -0.581910074f, -0.649045825f, -0.387657851f, -0.718443573f } },
+	{ EFNNoiseType::PerlinFractal, EFNFractalType::RigidMulti, EFNCellularReturnType::CellValue, { 0.304255396f, 0.223086253f, 0.110806584f, -0.241797999f }, { 0.184139669f, 0.2754969f, 0.160549179f, 0.256121635f } },
+	{ EFNNoiseType::Simplex, EFNFractalType::FBM, EFNCellularReturnType::CellValue, { 0.295041412f, -0.393865973f, -0.0679765642f, -0.611621261f }, { -0.169993296f, -0.342498243f, -0.137843654f, 0.0696898699f } },
+	{ EFNNoiseType::SimplexFractal, EFNFractalType::FBM, EFNCellularReturnType::CellValue, { -0.209884733f, -0.337360173f, 0.443808466f, 0.451204091f }, { 0.235342652f, 0.294612139f, 0.266601801f, -0.220328957f } },
+	{ EFNNoiseType::SimplexFractal, EFNFractalType::Billow, EFNCellularReturnType::CellValue, { -0.281500727f, -0.325279683f, 0.208763897f, -0.0975918993f }, { -0.136102945f, -0.301143765f, -0.466796458f, -0.559342146f } },
+	{ EFNNoiseType::SimplexFractal, EFNFractalType::RigidMulti, EFNCellularReturnType::CellValue, { 0.192160338f, 0.0526483655f, 0.0783494264f, -0.178785875f }, { -0.148184061f, -0.265571207f, 0.648417354f, 0.0525690019f } },
+	{ EFNNoiseType::Cellular, EFNFractalType::FBM, EFNCellularReturnType::CellValue, { -0.955828071f, -0.0670178458f, -0.100560412f, 0.792442977f }, { 0.492200136f, -0.0868985802f, -0.22018005f, -0.447542816f } },
+	{ EFNNoiseType::Cellular, EFNFractalType::FBM, EFNCellularReturnType::NoiseLookup, { 0.216339394f, -0.0577857271f, 0.153369561f, 0.441269279f }, { -0.0466133878f, -0.0967390239f, -0.571821213f, 0.221233472f } },
+	{ EFNNoiseType::Cellular, EFNFractalType::FBM, EFNCellularReturnType::Distance, { 0.0283842403f, 0.183969662f, 0.401370525f, 0.239070103f }, { 0.278122902f, 0.163876325f, 0.221893162f, 0.566706181f } },
+	{ EFNNoiseType::Cellular, EFNFractalType::FBM, EFNCellularReturnType::Distance2, { 0.306552023f, 0.830440283f, 0.627395749f, 0.482307613f }, { 0.550406218f, 0.466313958f, 0.240075186f, 0.801590145f } },
+	{ EFNNoiseType::Cellular, EFNFractalType::FBM, EFNCellularReturnType::Distance2Add, { 0.334936261f, 1.0144099f, 1.02876627f, 0.72137773f }, { 0.828529119f, 0.630190253f, 0.461968362f, 1.36829638f } },
+	{ EFNNoiseType::Cellular, EFNFractalType::FBM, EFNCellularReturnType::Distance2Sub, { 0.278167784f, 0.646470606f, 0.226025224f, 0.24323751f }, { 0.272283316f, 0.302437633f, 0.0181820244f, 0.234883964f } },
+	{ EFNNoiseType::Cellular, EFNFractalType::FBM, EFNCellularReturnType::Distance2Mul, { 0.00870124623f, 0.152775824f, 0.25181815f, 0.115305327f }, { 0.153080568f, 0.0764178187f, 0.0532710403f, 0.454266101f } },
+	{ EFNNoiseType::Cellular, EFNFractalType::FBM, EFNCellularReturnType::Distance2Div, { 0.092591919f, 0.221532688f, 0.639740586f, 0.495679706f }, { 0.505304813f, 0.351429164f, 0.924265265f, 0.706977487f } },
+	{ EFNNoiseType::WhiteNoise, EFNFractalType::FBM, EFNCellularReturnType::CellValue, { 0.81709528f, 0.876033306f, 0.697265863f, 0.944211543f }, { -0.377871275f, -0.248611614f, -0.432846397f, 0.326393753f } },
+	{ EFNNoiseType::Cubic, EFNFractalType::FBM, EFNCellularReturnType::CellValue, { -0.142216444f, 0.224591359f, 0.442309171f, 0.133580878f }, { -0.218563825f, 0.00184789195f, -0.0948959813f, -0.0335505381f } },
+	{ EFNNoiseType::CubicFractal, EFNFractalType::FBM, EFNCellularReturnType::CellValue, { -0.310435385f, 0.0600089617f, -0.27422747f, -0.191442192f }, { 0.00530794729f, 0.0702472553f, 0.0637990162f, 0.0385609493f } },
+	{ EFNNoiseType::CubicFractal, EFNFractalType::Billow, EFNCellularReturnType::CellValue, { -0.379129261f, -0.879123747f, -0.451545119f, -0.055791799f }, { -0.88570261f, -0.763347805f, -0.797649264f, -0.893302083f } },
+	{ EFNNoiseType::CubicFractal, EFNFractalType::RigidMulti, EFNCellularReturnType::CellValue, { 0.0274039507f, 0.189363033f, -0.0510916561f, -0.0850238204f }, { 0.259288907f, 0.344880998f, 0.161665231f, 0.197007477f } },
+};
+
+bool FFastNoiseBaselineTest::RunTest(const FString& Parameters)
+{
+	FastNoiseTest::FScopedConsoleVariable simdLevel(*this, TEXT("fastnoise.SIMDLevel"));
+	if (!simdLevel.IsValid())
+		return false;
+
+	// The setters below recompile the noises with the scalar kernels
+	simdLevel.Set(FN_SIMD_LEVEL_SCALAR);
+
+	UFastNoise* lookup = NewObject<UFastNoise>();
+	lookup->SetNoiseType(EFNNoiseType::Perlin);
+	lookup->SetFrequency(0.2f);
+
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetFrequency(0.11f);
+	noise->SetCellularNoiseLookup(lookup);
+
+	for (const FFastNoiseBaseline& baseline : Baselines)
+	{
+		noise->SetNoiseType(baseline.NoiseType);
+		noise->SetFractalType(baseline.FractalType);
+		noise->SetCellularReturnType(baseline.CellularReturnType);
+
+		float noise2D[4], noise3D[4];
+		for (int32 i = 0; i < 4; i++)
+		{
+			noise2D[i] = noise->GetNoise2D(BaselinePoints[i][0], BaselinePoints[i][1]);
+			noise3D[i] = noise->GetNoise3D(BaselinePoints[i][0], BaselinePoints[i][1], BaselinePoints[i][2]);
+		}
+
+		const FString settings = FString::Printf(TEXT("NoiseType %d FractalType %d CellularReturnType %d"), (int32)baseline.NoiseType, (int32)baseline.FractalType, (int32)baseline.CellularReturnType);
+		FastNoiseTest::TestValues(*this, TEXT("GetNoise2D ") + settings, noise2D, baseline.Noise2D, 4);
+		FastNoiseTest::TestValues(*this, TEXT("GetNoise3D ") + settings, noise3D, baseline.Noise3D, 4);
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,203 @@
+// FastNoiseCellularSampleTest.cpp
+//
+// The fields of GetCellularSample2D/3D(...) against GetNoise2D/3D(...) with the return type each stands for,
+// and GetCellularSamplePointSet2D/3D(...) against the single samples, at each fastnoise.SIMDLevel the CPU supports
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "SIMD/FastNoiseSIMD.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseCellularSampleTest, "FastNoise.CellularSample", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Not a multiple of any vector width, so every level also searches a partial vector
+static const int32 PointCount = 67;
+
+static const float NoiseFrequency = 0.11f;
+
+// The lookup is sampled at CellPosition * NoiseFrequency, which only rounds back to the cell point the kernels use
+static const float LookupTolerance = 1e-4f;
+
+// The default pair, and a pair past the closest point
+static const int32 DistanceIndices[][2] = { { 0, 1 }, { 1, 3 } };
+
+// Each sample field in the 2 or 3 dimensions the sample was taken in
+struct FCellularSampleFields
+{
+	TArray<float> Distance, Distance0, Distance1, CellValue, CellPositionX, CellPositionY, CellPositionZ;
+	TArray<int32> CellX, CellY, CellZ;
+
+	FCellularSampleFields()
+	{
+		for (TArray<float>* field : { &Distance, &Distance0, &Distance1, &CellValue, &CellPositionX, &CellPositionY, &CellPositionZ })
+			field->SetNumUninitialized(PointCount);
+		for (TArray<int32>* field : { &CellX, &CellY, &CellZ })
+			field->SetNumUninitialized(PointCount);
+	}
+
+	FFastNoiseCellularSampleSet GetSampleSet(bool b3D)
+	{
+		FFastNoiseCellularSampleSet sampleSet;
+		sampleSet.Distance = Distance;
+		sampleSet.Distance0 = Distance0;
+		sampleSet.Distance1 = Distance1;
+		sampleSet.CellValue = CellValue;
+		sampleSet.CellX = CellX;
+		sampleSet.CellY = CellY;
+		sampleSet.CellPositionX = CellPositionX;
+		sampleSet.CellPositionY = CellPositionY;
+
+		if (b3D)
+		{
+			sampleSet.CellZ = CellZ;
+			sampleSet.CellPositionZ = CellPositionZ;
+		}
+		return sampleSet;
+	}
+
+	void Store(int32 i, const FFastNoiseCellularSample& sample)
+	{
+		Distance[i] = sample.Distance;
+		Distance0[i] = sample.Distance0;
+		Distance1[i] = sample.Distance1;
+		CellValue[i] = sample.CellValue;
+		CellX[i] = sample.Cell.X;
+		CellY[i] = sample.Cell.Y;
+		CellZ[i] = sample.Cell.Z;
+		CellPositionX[i] = sample.CellPosition.X;
+		CellPositionY[i] = sample.CellPosition.Y;
+		CellPositionZ[i] = sample.CellPosition.Z;
+	}
+};
+
+// The value GetNoise2D/3D(...) returns for returnType, built from the sample fields
+static float ReturnTypeValue(EFNCellularReturnType returnType, const FFastNoiseCellularSample& sample, const UFastNoise& lookup, bool b3D)
+{
+	switch (returnType)
+	{
+	case EFNCellularReturnType::CellValue:
+		return sample.CellValue;
+	case EFNCellularReturnType::NoiseLookup:
+		return b3D ? lookup.GetNoise3D(sample.CellPosition.X * NoiseFrequency, sample.CellPosition.Y * NoiseFrequency, sample.CellPosition.Z * NoiseFrequency) :
+			lookup.GetNoise2D(sample.CellPosition.X * NoiseFrequency, sample.CellPosition.Y * NoiseFrequency);
+	case EFNCellularReturnType::Distance:
+		return sample.Distance;
+	case EFNCellularReturnType::Distance2:
+		return sample.Distance1;
+	case EFNCellularReturnType::Distance2Add:
+		return sample.Distance1 + sample.Distance0;
+	case EFNCellularReturnType::Distance2Sub:
+		return sample.GetEdgeDistance();
+	case EFNCellularReturnType::Distance2Mul:
+		return sample.Distance1 * sample.Distance0;
+	case EFNCellularReturnType::Distance2Div:
+		return sample.Distance0 / sample.Distance1;
+	default:
+		return 0;
+	}
+}
+
+static void TestSampleSet(FAutomationTestBase& test, const FString& what, FCellularSampleFields& values, const FCellularSampleFields& expected, bool b3D)
+{
+	FastNoiseTest::TestValues(test, what + TEXT(" Distance"), values.Distance.GetData(), expected.Distance.GetData(), PointCount);
+	FastNoiseTest::TestValues(test, what + TEXT(" Distance0"), values.Distance0.GetData(), expected.Distance0.GetData(), PointCount);
+	FastNoiseTest::TestValues(test, what + TEXT(" Distance1"), values.Distance1.GetData(), expected.Distance1.GetData(), PointCount);
+	FastNoiseTest::TestValues(test, what + TEXT(" CellValue"), values.CellValue.GetData(), expected.CellValue.GetData(), PointCount);
+	FastNoiseTest::TestValues(test, what + TEXT(" CellPositionX"), values.CellPositionX.GetData(), expected.CellPositionX.GetData(), PointCount);
+	FastNoiseTest::TestValues(test, what + TEXT(" CellPositionY"), values.CellPositionY.GetData(), expected.CellPositionY.GetData(), PointCount);
+	if (b3D)
+		FastNoiseTest::TestValues(test, what + TEXT(" CellPositionZ"), values.CellPositionZ.GetData(), expected.CellPositionZ.GetData(), PointCount);
+
+	for (int32 i = 0; i < PointCount; i++)
+	{
+		if (values.CellX[i] != expected.CellX[i] || values.CellY[i] != expected.CellY[i] || (b3D && values.CellZ[i] != expected.CellZ[i]))
+		{
+			test.AddError(FString::Printf(TEXT("%s Cell: point %d is in cell %d, %d, %d, GetCellularSample gives %d, %d, %d"), *what, i,
+				values.CellX[i], values.CellY[i], b3D ? values.CellZ[i] : 0, expected.CellX[i], expected.CellY[i], b3D ? expected.CellZ[i] : 0));
+			return;
+		}
+	}
+}
+
+bool FFastNoiseCellularSampleTest::RunTest(const FString& Parameters)
+{
+	FastNoiseTest::FScopedConsoleVariable simdLevel(*this, TEXT("fastnoise.SIMDLevel"));
+	if (!simdLevel.IsValid())
+		return false;
+
+	TArray<float> xPoints, yPoints, zPoints;
+	for (int32 i = 0; i < PointCount; i++)
+	{
+		xPoints.Add(i * 3.17f - 101.3f);
+		yPoints.Add((i * 37 % PointCount) * -1.31f + 40.7f);
+		zPoints.Add((i * 53 % PointCount) * 0.71f - 20.1f);
+	}
+
+	UFastNoise* lookup = NewObject<UFastNoise>();
+	lookup->SetNoiseType(EFNNoiseType::Perlin);
+	lookup->SetFrequency(0.2f);
+
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetNoiseType(EFNNoiseType::Cellular);
+	noise->SetFrequency(NoiseFrequency);
+	noise->SetCellularNoiseLookup(lookup);
+
+	FCellularSampleFields values, expected;
+
+	for (int32 level = FN_SIMD_LEVEL_SCALAR; level <= FastNoiseSIMD::GetSupportedLevel(); level++)
+	{
+		simdLevel.Set(level);
+
+		for (const int32* indices : DistanceIndices)
+		{
+			for (int32 distance = 0; distance <= (int32)EFNCellularDistanceFunction::Natural; distance++)
+			{
+				// The setters recompile the noise, so it picks the level up whether or not the change callback ran
+				noise->SetCellularDistance2Indices(indices[0], indices[1]);
+				noise->SetCellularDistanceFunction((EFNCellularDistanceFunction)distance);
+				const FString settings = FString::Printf(TEXT("SIMDLevel %d CellularDistanceIndices %d, %d CellularDistanceFunction %d"), level, indices[0], indices[1], distance);
+
+				for (int32 returnType = 0; returnType <= (int32)EFNCellularReturnType::Distance2Div; returnType++)
+				{
+					noise->SetCellularReturnType((EFNCellularReturnType)returnType);
+					const FString what = FString::Printf(TEXT("%s CellularReturnType %d"), *settings, returnType);
+					const float tolerance = (EFNCellularReturnType)returnType == EFNCellularReturnType::NoiseLookup ? LookupTolerance : 0.0f;
+
+					for (int32 i = 0; i < PointCount; i++)
+					{
+						const FFastNoiseCellularSample sample2D = noise->GetCellularSample2D(xPoints[i], yPoints[i]);
+						const FFastNoiseCellularSample sample3D = noise->GetCellularSample3D(xPoints[i], yPoints[i], zPoints[i]);
+
+						TestEqual(FString::Printf(TEXT("GetCellularSample2D %s point %d"), *what, i), ReturnTypeValue((EFNCellularReturnType)returnType, sample2D, *lookup, false), noise->GetNoise2D(xPoints[i], yPoints[i]), tolerance);
+						TestEqual(FString::Printf(TEXT("GetCellularSample3D %s point %d"), *what, i), ReturnTypeValue((EFNCellularReturnType)returnType, sample3D, *lookup, true), noise->GetNoise3D(xPoints[i], yPoints[i], zPoints[i]), tolerance);
+					}
+				}
+
+				// The sample is independent of the return type, the sets are checked once per search
+				for (int32 i = 0; i < PointCount; i++)
+					expected.Store(i, noise->GetCellularSample2D(xPoints[i], yPoints[i]));
+				noise->GetCellularSamplePointSet2D(values.GetSampleSet(false), xPoints, yPoints);
+				TestSampleSet(*this, TEXT("GetCellularSamplePointSet2D ") + settings, values, expected, false);
+
+				for (int32 i = 0; i < PointCount; i++)
+					expected.Store(i, noise->GetCellularSample3D(xPoints[i], yPoints[i], zPoints[i]));
+				noise->GetCellularSamplePointSet3D(values.GetSampleSet(true), xPoints, yPoints, zPoints);
+				TestSampleSet(*this, TEXT("GetCellularSamplePointSet3D ") + settings, values, expected, true);
+			}
+		}
+	}
+
+	// A skipped output is left as it was
+	FFastNoiseCellularSampleSet distanceOnly;
+	distanceOnly.Distance = values.Distance;
+	values.CellValue.Init(-2.0f, PointCount);
+	noise->GetCellularSamplePointSet2D(distanceOnly, xPoints, yPoints);
+	TestTrue(TEXT("A skipped CellValue output is not written"), values.CellValue[0] == -2.0f && values.CellValue[PointCount - 1] == -2.0f);
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
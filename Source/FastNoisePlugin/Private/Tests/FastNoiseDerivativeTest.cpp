@@ -0,0 +1,132 @@
+// FastNoiseDerivativeTest.cpp
+//
+// The analytic gradients of GetNoiseDerivative2D/3D(...) against central differences of GetNoise2D/3D(...)
+// and the derivative sets against the single point derivative
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseDerivativeTest, "FastNoise.Derivatives", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+static const float NoiseFrequency = 0.05f;
+
+// Small next to a cell, 20 units at this frequency, large next to the float spacing of the positions
+static const float DifferenceStep = 0.001f;
+
+// Gradients are around NoiseFrequency in size, the differences lose about 1e-4 to rounding
+static const float GradientTolerance = 2e-3f;
+
+// Billow and RigidMulti fold every octave at 0 and Linear interpolation bends at cell edges, the one sided differences
+// of a smooth stretch agree to a few 1e-4, across a crease they differ by the jump in slope and say nothing of the gradient
+static const float CreaseTolerance = 0.01f;
+
+static const int32 PointCount = 31;
+
+// The noise types with analytic derivatives
+static const EFNNoiseType NoiseTypes[] = { EFNNoiseType::Value, EFNNoiseType::ValueFractal, EFNNoiseType::Perlin, EFNNoiseType::PerlinFractal, EFNNoiseType::Simplex, EFNNoiseType::SimplexFractal };
+
+// Compares one gradient component with the central difference of the samples around it, returns false if a crease lies between them
+static bool TestGradient(FAutomationTestBase& test, const FString& what, float gradient, float minus, float center, float plus)
+{
+	const float backward = (center - minus) / DifferenceStep;
+	const float forward = (plus - center) / DifferenceStep;
+
+	if (FMath::Abs(forward - backward) > CreaseTolerance)
+		return false;
+
+	test.TestEqual(what, gradient, (forward + backward) / 2, GradientTolerance);
+	return true;
+}
+
+bool FFastNoiseDerivativeTest::RunTest(const FString& Parameters)
+{
+	TArray<float> xPoints, yPoints, zPoints;
+	for (int32 i = 0; i < PointCount; i++)
+	{
+		xPoints.Add(i * 6.13f - 95.3f);
+		yPoints.Add((i * 13 % PointCount) * -4.07f + 52.9f);
+		zPoints.Add((i * 17 % PointCount) * 2.71f - 33.1f);
+	}
+
+	TArray<float> values, expected;
+	TArray<FVector2D> gradients2D;
+	TArray<FVector> gradients3D;
+	values.SetNumUninitialized(PointCount);
+	expected.SetNumUninitialized(PointCount);
+	gradients2D.SetNumUninitialized(PointCount);
+	gradients3D.SetNumUninitialized(PointCount);
+
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetFrequency(NoiseFrequency);
+
+	const float h = DifferenceStep;
+
+	for (int32 interp = 0; interp <= (int32)EFNInterp::Quintic; interp++)
+	{
+		noise->SetInterp((EFNInterp)interp);
+
+		for (EFNNoiseType noiseType : NoiseTypes)
+		{
+			noise->SetNoiseType(noiseType);
+
+			for (int32 fractal = 0; fractal <= (int32)EFNFractalType::RigidMulti; fractal++)
+			{
+				noise->SetFractalType((EFNFractalType)fractal);
+				const FString settings = FString::Printf(TEXT("Interp %d NoiseType %d FractalType %d"), interp, (int32)noiseType, fractal);
+
+				int32 compared = 0, components = 0;
+
+				for (int32 i = 0; i < PointCount; i++)
+				{
+					const float x = xPoints[i], y = yPoints[i], z = zPoints[i];
+					const FString what = FString::Printf(TEXT("%s point %d"), *settings, i);
+
+					FVector2D gradient2D;
+					const float noise2D = noise->GetNoise2D(x, y);
+					TestEqual(TEXT("GetNoiseDerivative2D value ") + what, noise->GetNoiseDerivative2D(x, y, gradient2D), noise2D, 1e-6f);
+					compared += TestGradient(*this, TEXT("GetNoiseDerivative2D X ") + what, gradient2D.X, noise->GetNoise2D(x - h, y), noise2D, noise->GetNoise2D(x + h, y));
+					compared += TestGradient(*this, TEXT("GetNoiseDerivative2D Y ") + what, gradient2D.Y, noise->GetNoise2D(x, y - h), noise2D, noise->GetNoise2D(x, y + h));
+
+					FVector gradient3D;
+					const float noise3D = noise->GetNoise3D(x, y, z);
+					TestEqual(TEXT("GetNoiseDerivative3D value ") + what, noise->GetNoiseDerivative3D(x, y, z, gradient3D), noise3D, 1e-6f);
+					compared += TestGradient(*this, TEXT("GetNoiseDerivative3D X ") + what, gradient3D.X, noise->GetNoise3D(x - h, y, z), noise3D, noise->GetNoise3D(x + h, y, z));
+					compared += TestGradient(*this, TEXT("GetNoiseDerivative3D Y ") + what, gradient3D.Y, noise->GetNoise3D(x, y - h, z), noise3D, noise->GetNoise3D(x, y + h, z));
+					compared += TestGradient(*this, TEXT("GetNoiseDerivative3D Z ") + what, gradient3D.Z, noise->GetNoise3D(x, y, z - h), noise3D, noise->GetNoise3D(x, y, z + h));
+
+					components += 5;
+				}
+
+				// Creases are thin, skipping most components would mean the differences were too coarse to test anything
+				TestTrue(TEXT("Most gradient components are away from creases ") + settings, compared * 10 >= components * 9);
+
+				// The point sets promise the floats of the single point derivative
+				noise->GetNoiseDerivativePointSet2D(values, gradients2D, xPoints, yPoints);
+				for (int32 i = 0; i < PointCount; i++)
+				{
+					FVector2D gradient;
+					expected[i] = noise->GetNoiseDerivative2D(xPoints[i], yPoints[i], gradient);
+					TestTrue(FString::Printf(TEXT("GetNoiseDerivativePointSet2D gradient %s point %d"), *settings, i), gradients2D[i].X == gradient.X && gradients2D[i].Y == gradient.Y);
+				}
+				FastNoiseTest::TestValues(*this, TEXT("GetNoiseDerivativePointSet2D ") + settings, values.GetData(), expected.GetData(), PointCount);
+
+				noise->GetNoiseDerivativePointSet3D(values, gradients3D, xPoints, yPoints, zPoints);
+				for (int32 i = 0; i < PointCount; i++)
+				{
+					FVector gradient;
+					expected[i] = noise->GetNoiseDerivative3D(xPoints[i], yPoints[i], zPoints[i], gradient);
+					TestTrue(FString::Printf(TEXT("GetNoiseDerivativePointSet3D gradient %s point %d"), *settings, i), gradients3D[i].X == gradient.X && gradients3D[i].Y == gradient.Y && gradients3D[i].Z == gradient.Z);
+				}
+				FastNoiseTest::TestValues(*this, TEXT("GetNoiseDerivativePointSet3D ") + settings, values.GetData(), expected.GetData(), PointCount);
+			}
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,123 @@
+// FastNoiseHeightmapTest.cpp
+//
+// GetHeightmap2D(...) heights against the scaled noise set, normals and slopes against the surface normals of the
+// analytic gradients or of central differences of GetNoise2D(...), and the normals of adjacent tiles along their seam
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseHeightmapTest, "FastNoise.Heightmap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+static const float GridStart[2] = { -37.25f, 18.5f };
+static const float GridStep = 0.75f;
+static const int32 GridSize[2] = { 24, 17 };
+
+// Steep enough that the normals lean well away from +Z
+static const float HeightScale = 40.0f;
+
+// The heightmap and the reference compute the sample positions in their own order, the floats differ in rounding only
+static const float HeightTolerance = 1e-4f;
+static const float NormalTolerance = 1e-3f;
+static const float SlopeTolerance = 0.05f;
+
+// Analytic derivatives first, then types the heightmap differences itself
+static const EFNNoiseType AnalyticTypes[] = { EFNNoiseType::Value, EFNNoiseType::PerlinFractal, EFNNoiseType::SimplexFractal };
+static const EFNNoiseType DifferencedTypes[] = { EFNNoiseType::Cubic, EFNNoiseType::CubicFractal, EFNNoiseType::Cellular };
+
+static FVector SurfaceNormal(const FVector2D& gradient)
+{
+	return FVector(-gradient.X * HeightScale, -gradient.Y * HeightScale, 1).GetSafeNormal();
+}
+
+static void TestHeightmap(FAutomationTestBase& test, const FString& what, const TArray<float>& heights, const TArray<FVector>& normals, const TArray<float>& slopes,
+	const TArray<float>& expectedNoise, const TArray<FVector2D>& expectedGradients)
+{
+	for (int32 i = 0; i < heights.Num(); i++)
+	{
+		const FString where = FString::Printf(TEXT("%s texel %d"), *what, i);
+		const FVector normal = SurfaceNormal(expectedGradients[i]);
+
+		test.TestEqual(TEXT("Height ") + where, heights[i], expectedNoise[i] * HeightScale, HeightTolerance * HeightScale);
+		test.TestEqual(TEXT("Normal ") + where, normals[i], normal, NormalTolerance);
+		test.TestEqual(TEXT("Slope ") + where, slopes[i], FMath::RadiansToDegrees(FMath::Acos(normal.Z)), SlopeTolerance);
+	}
+}
+
+bool FFastNoiseHeightmapTest::RunTest(const FString& Parameters)
+{
+	const int32 count = GridSize[0] * GridSize[1];
+
+	TArray<float> heights, slopes, expectedNoise;
+	TArray<FVector> normals;
+	TArray<FVector2D> expectedGradients;
+	heights.SetNumUninitialized(count);
+	slopes.SetNumUninitialized(count);
+	normals.SetNumUninitialized(count);
+	expectedNoise.SetNumUninitialized(count);
+	expectedGradients.SetNumUninitialized(count);
+
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetFrequency(0.05f);
+	noise->SetCellularReturnType(EFNCellularReturnType::Distance);
+
+	for (EFNNoiseType noiseType : AnalyticTypes)
+	{
+		noise->SetNoiseType(noiseType);
+		noise->GetHeightmap2D(heights, normals, slopes, GridStart[0], GridStart[1], GridSize[0], GridSize[1], GridStep, HeightScale);
+		noise->GetNoiseDerivativeSet2D(expectedNoise, expectedGradients, GridStart[0], GridStart[1], GridSize[0], GridSize[1], GridStep);
+
+		TestHeightmap(*this, FString::Printf(TEXT("NoiseType %d"), (int32)noiseType), heights, normals, slopes, expectedNoise, expectedGradients);
+	}
+
+	for (EFNNoiseType noiseType : DifferencedTypes)
+	{
+		noise->SetNoiseType(noiseType);
+		noise->GetHeightmap2D(heights, normals, slopes, GridStart[0], GridStart[1], GridSize[0], GridSize[1], GridStep, HeightScale);
+
+		// The texels either side of each one, including the apron around the grid
+		for (int32 y = 0, i = 0; y < GridSize[1]; y++)
+		{
+			for (int32 x = 0; x < GridSize[0]; x++, i++)
+			{
+				const float xf = GridStart[0] + x * GridStep, yf = GridStart[1] + y * GridStep;
+
+				expectedNoise[i] = noise->GetNoise2D(xf, yf);
+				expectedGradients[i] = FVector2D(noise->GetNoise2D(xf + GridStep, yf) - noise->GetNoise2D(xf - GridStep, yf),
+					noise->GetNoise2D(xf, yf + GridStep) - noise->GetNoise2D(xf, yf - GridStep)) / (2 * GridStep);
+			}
+		}
+
+		TestHeightmap(*this, FString::Printf(TEXT("NoiseType %d"), (int32)noiseType), heights, normals, slopes, expectedNoise, expectedGradients);
+	}
+
+	// Two tiles side by side against one heightmap over both, the apron has to give the seam texels the same normals
+	const int32 tileXSize = GridSize[0] / 2;
+	const int32 tileCount = tileXSize * GridSize[1];
+
+	TArray<float> tileHeights;
+	TArray<FVector> tileNormals;
+	tileHeights.SetNumUninitialized(tileCount);
+	tileNormals.SetNumUninitialized(tileCount);
+
+	noise->SetNoiseType(EFNNoiseType::CubicFractal);
+	noise->GetHeightmap2D(heights, normals, TArrayView<float>(), GridStart[0], GridStart[1], GridSize[0], GridSize[1], GridStep, HeightScale);
+
+	for (int32 tile = 0; tile < 2; tile++)
+	{
+		noise->GetHeightmap2D(tileHeights, tileNormals, TArrayView<float>(), GridStart[0] + tile * tileXSize * GridStep, GridStart[1], tileXSize, GridSize[1], GridStep, HeightScale);
+
+		for (int32 y = 0; y < GridSize[1]; y++)
+		{
+			for (int32 x = 0; x < tileXSize; x++)
+				TestEqual(FString::Printf(TEXT("Tile %d normal %d, %d"), tile, x, y), tileNormals[y * tileXSize + x], normals[y * GridSize[0] + tile * tileXSize + x], NormalTolerance);
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,81 @@
+// FastNoiseLargeWorldTest.cpp
+//
+// GetNoiseLarge2D/3D(...) follow GetNoise2D/3D(...) near the origin, where floats still resolve the lattice,
+// and stay smooth across a lattice origin a billion units out, where GetNoise2D/3D(...) can only return steps
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseLargeWorldTest, "FastNoise.LargeWorld", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The double positions only differ from the float ones in rounding
+static const float NearOriginTolerance = 1e-4f;
+
+// 1e9 * NoiseFrequency is a whole number, so the samples straddle a lattice cell boundary of the first octave
+static const double FarOrigin = 1e9;
+static const float NoiseFrequency = 0.01f;
+
+// Half a unit is 1/200 of a cell, far below the 64 unit spacing of floats out there
+static const double FarStep = 0.5;
+static const int32 FarSteps = 16;
+
+// Noise changes by well under 0.05 over 1/200 of a cell, a lattice origin placed wrong shows up as a jump
+static const float MaxFarStepChange = 0.05f;
+
+// Only the continuous noise types, cellular values and white noise jump between cells by design
+static const EFNNoiseType NoiseTypes[] = { EFNNoiseType::Value, EFNNoiseType::ValueFractal, EFNNoiseType::Perlin, EFNNoiseType::PerlinFractal, EFNNoiseType::Simplex, EFNNoiseType::SimplexFractal, EFNNoiseType::Cubic, EFNNoiseType::CubicFractal };
+
+static void TestFarRow(FAutomationTestBase& test, const FString& what, const float* values)
+{
+	float minValue = values[0], maxValue = values[0];
+
+	for (int32 i = 1; i <= FarSteps; i++)
+	{
+		test.TestEqual(FString::Printf(TEXT("%s step %d"), *what, i), values[i], values[i - 1], MaxFarStepChange);
+		minValue = FMath::Min(minValue, values[i]);
+		maxValue = FMath::Max(maxValue, values[i]);
+	}
+
+	// A position rounded to float would give the same value at every step
+	test.TestTrue(what + TEXT(" resolves steps below the float spacing"), maxValue > minValue);
+}
+
+bool FFastNoiseLargeWorldTest::RunTest(const FString& Parameters)
+{
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetFrequency(NoiseFrequency);
+	noise->SetFractalOctaves(4);
+
+	for (EFNNoiseType noiseType : NoiseTypes)
+	{
+		noise->SetNoiseType(noiseType);
+
+		for (int32 i = 0; i < 25; i++)
+		{
+			const float x = i * 7.3f - 90.1f, y = (i * 11 % 25) * -5.9f + 61.3f, z = (i * 7 % 25) * 3.7f - 40.2f;
+			const FString what = FString::Printf(TEXT("NoiseType %d point %d"), (int32)noiseType, i);
+
+			TestEqual(TEXT("GetNoiseLarge2D near the origin ") + what, noise->GetNoiseLarge2D(x, y), noise->GetNoise2D(x, y), NearOriginTolerance);
+			TestEqual(TEXT("GetNoiseLarge3D near the origin ") + what, noise->GetNoiseLarge3D(x, y, z), noise->GetNoise3D(x, y, z), NearOriginTolerance);
+		}
+
+		float row2D[FarSteps + 1], row3D[FarSteps + 1];
+		for (int32 i = 0; i <= FarSteps; i++)
+		{
+			const double offset = (i - FarSteps / 2) * FarStep;
+			row2D[i] = noise->GetNoiseLarge2D(FarOrigin + offset, -FarOrigin + 0.3 * offset);
+			row3D[i] = noise->GetNoiseLarge3D(FarOrigin + offset, -FarOrigin + 0.3 * offset, FarOrigin - 0.7 * offset);
+		}
+
+		TestFarRow(*this, FString::Printf(TEXT("GetNoiseLarge2D far out NoiseType %d"), (int32)noiseType), row2D);
+		TestFarRow(*this, FString::Printf(TEXT("GetNoiseLarge3D far out NoiseType %d"), (int32)noiseType), row3D);
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,67 @@
+// FastNoiseParallelTest.cpp
+//
+// GetNoiseSetParallel2D/3D(...) promise the floats of GetNoiseSet2D/3D(...) however the grid is split between threads
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseParallelTest, "FastNoise.Parallel", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Sizes that do not divide into whole batches, so the last task fills fewer rows than the others
+static const float GridStart[3] = { -31.5f, 12.25f, -4.0f };
+static const float GridStep = 0.61f;
+static const int32 GridSize[3] = { 45, 37, 11 };
+
+// 1 gives a task per row, the largest fills the whole grid in one task
+static const int32 MinBatchSizes[] = { 1, 100, 45 * 5, 4096, 45 * 37 * 11 };
+
+bool FFastNoiseParallelTest::RunTest(const FString& Parameters)
+{
+	const int32 count2D = GridSize[0] * GridSize[1];
+	const int32 count3D = count2D * GridSize[2];
+
+	TArray<float> values, expected;
+	values.SetNumUninitialized(count3D);
+	expected.SetNumUninitialized(count3D);
+
+	UFastNoise* lookup = NewObject<UFastNoise>();
+	lookup->SetNoiseType(EFNNoiseType::Simplex);
+	lookup->SetFrequency(0.2f);
+
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetFrequency(0.07f);
+	noise->SetCellularNoiseLookup(lookup);
+
+	// A SIMD kernel, a scalar only type, a fractal and the per cell lookup fill
+	const EFNNoiseType noiseTypes[] = { EFNNoiseType::Simplex, EFNNoiseType::Cubic, EFNNoiseType::PerlinFractal, EFNNoiseType::Cellular };
+
+	for (EFNNoiseType noiseType : noiseTypes)
+	{
+		noise->SetNoiseType(noiseType);
+		noise->SetCellularReturnType(noiseType == EFNNoiseType::Cellular ? EFNCellularReturnType::NoiseLookup : EFNCellularReturnType::CellValue);
+
+		noise->GetNoiseSet2D(expected, GridStart[0], GridStart[1], GridSize[0], GridSize[1], GridStep);
+
+		for (int32 minBatchSize : MinBatchSizes)
+		{
+			noise->GetNoiseSetParallel2D(values, GridStart[0], GridStart[1], GridSize[0], GridSize[1], GridStep, minBatchSize);
+			FastNoiseTest::TestValues(*this, FString::Printf(TEXT("GetNoiseSetParallel2D NoiseType %d minBatchSize %d"), (int32)noiseType, minBatchSize), values.GetData(), expected.GetData(), count2D);
+		}
+
+		noise->GetNoiseSet3D(expected, GridStart[0], GridStart[1], GridStart[2], GridSize[0], GridSize[1], GridSize[2], GridStep);
+
+		for (int32 minBatchSize : MinBatchSizes)
+		{
+			noise->GetNoiseSetParallel3D(values, GridStart[0], GridStart[1], GridStart[2], GridSize[0], GridSize[1], GridSize[2], GridStep, minBatchSize);
+			FastNoiseTest::TestValues(*this, FString::Printf(TEXT("GetNoiseSetParallel3D NoiseType %d minBatchSize %d"), (int32)noiseType, minBatchSize), values.GetData(), expected.GetData(), count3D);
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
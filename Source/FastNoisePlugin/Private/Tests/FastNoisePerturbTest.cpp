@@ -0,0 +1,132 @@
+// FastNoisePerturbTest.cpp
+//
+// GradientPerturb{Fractal}Set2D/3D(...) promise the floats of GradientPerturb{Fractal}2D/3D(...) of every point,
+// GetPerturbedNoisePointSet2D/3D(...) those of GetNoise2D/3D(...) at the warped points, at each fastnoise.SIMDLevel the CPU supports
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "SIMD/FastNoiseSIMD.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoisePerturbTest, "FastNoise.Perturb", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Not a multiple of any vector width, so every level also warps a partial vector
+static const int32 PointCount = 67;
+
+static void TestPerturbSets(FAutomationTestBase& test, const UFastNoise& noise, const UFastNoise& perturb, const FString& settings, const TArray<float>& xPoints, const TArray<float>& yPoints, const TArray<float>& zPoints)
+{
+	TArray<float> xSet, ySet, zSet, xExpected, yExpected, zExpected, values, expected;
+	values.SetNumUninitialized(PointCount);
+	expected.SetNumUninitialized(PointCount);
+
+	for (int32 fractal = 0; fractal < 2; fractal++)
+	{
+		const bool bFractal = fractal != 0;
+		const FString what = (bFractal ? TEXT("GradientPerturbFractalSet") : TEXT("GradientPerturbSet"));
+
+		xSet = xPoints; ySet = yPoints;
+		xExpected = xPoints; yExpected = yPoints;
+
+		if (bFractal)
+			perturb.GradientPerturbFractalSet2D(xSet, ySet);
+		else
+			perturb.GradientPerturbSet2D(xSet, ySet);
+
+		for (int32 i = 0; i < PointCount; i++)
+		{
+			if (bFractal)
+				perturb.GradientPerturbFractal2D(xExpected[i], yExpected[i]);
+			else
+				perturb.GradientPerturb2D(xExpected[i], yExpected[i]);
+
+			expected[i] = noise.GetNoise2D(xExpected[i], yExpected[i]);
+		}
+
+		FastNoiseTest::TestValues(test, what + TEXT("2D x ") + settings, xSet.GetData(), xExpected.GetData(), PointCount);
+		FastNoiseTest::TestValues(test, what + TEXT("2D y ") + settings, ySet.GetData(), yExpected.GetData(), PointCount);
+
+		noise.GetPerturbedNoisePointSet2D(values, xPoints, yPoints, bFractal, &perturb);
+		FastNoiseTest::TestValues(test, FString::Printf(TEXT("GetPerturbedNoisePointSet2D fractalPerturb %d "), fractal) + settings, values.GetData(), expected.GetData(), PointCount);
+
+		xSet = xPoints; ySet = yPoints; zSet = zPoints;
+		xExpected = xPoints; yExpected = yPoints; zExpected = zPoints;
+
+		if (bFractal)
+			perturb.GradientPerturbFractalSet3D(xSet, ySet, zSet);
+		else
+			perturb.GradientPerturbSet3D(xSet, ySet, zSet);
+
+		for (int32 i = 0; i < PointCount; i++)
+		{
+			if (bFractal)
+				perturb.GradientPerturbFractal3D(xExpected[i], yExpected[i], zExpected[i]);
+			else
+				perturb.GradientPerturb3D(xExpected[i], yExpected[i], zExpected[i]);
+
+			expected[i] = noise.GetNoise3D(xExpected[i], yExpected[i], zExpected[i]);
+		}
+
+		FastNoiseTest::TestValues(test, what + TEXT("3D x ") + settings, xSet.GetData(), xExpected.GetData(), PointCount);
+		FastNoiseTest::TestValues(test, what + TEXT("3D y ") + settings, ySet.GetData(), yExpected.GetData(), PointCount);
+		FastNoiseTest::TestValues(test, what + TEXT("3D z ") + settings, zSet.GetData(), zExpected.GetData(), PointCount);
+
+		noise.GetPerturbedNoisePointSet3D(values, xPoints, yPoints, zPoints, bFractal, &perturb);
+		FastNoiseTest::TestValues(test, FString::Printf(TEXT("GetPerturbedNoisePointSet3D fractalPerturb %d "), fractal) + settings, values.GetData(), expected.GetData(), PointCount);
+	}
+}
+
+bool FFastNoisePerturbTest::RunTest(const FString& Parameters)
+{
+	FastNoiseTest::FScopedConsoleVariable simdLevel(*this, TEXT("fastnoise.SIMDLevel"));
+	if (!simdLevel.IsValid())
+		return false;
+
+	TArray<float> xPoints, yPoints, zPoints;
+	for (int32 i = 0; i < PointCount; i++)
+	{
+		xPoints.Add(i * 3.17f - 101.3f);
+		yPoints.Add((i * 37 % PointCount) * -1.31f + 40.7f);
+		zPoints.Add((i * 53 % PointCount) * 0.71f - 20.1f);
+	}
+
+	// The noise sampled at the warped points, a SIMD kernel type so the fused set runs its vector path too
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetNoiseType(EFNNoiseType::SimplexFractal);
+	noise->SetFrequency(0.11f);
+
+	UFastNoise* perturb = NewObject<UFastNoise>();
+	perturb->SetSeed(1729);
+	perturb->SetFrequency(0.07f);
+	perturb->SetFractalOctaves(4);
+	perturb->SetGradientPerturbAmp(2.5f);
+
+	for (int32 level = FN_SIMD_LEVEL_SCALAR; level <= FastNoiseSIMD::GetSupportedLevel(); level++)
+	{
+		// The setters below recompile both noises, so they pick the level up whether or not the change callback ran
+		simdLevel.Set(level);
+		noise->SetSeed(noise->GetSeed());
+
+		for (int32 hash = 0; hash <= (int32)EFNHashType::Integer; hash++)
+		{
+			perturb->SetHashType((EFNHashType)hash);
+
+			for (int32 interp = 0; interp <= (int32)EFNInterp::Quintic; interp++)
+			{
+				perturb->SetInterp((EFNInterp)interp);
+
+				for (int32 perturbType = 0; perturbType <= (int32)EFNPerturbType::Simplex; perturbType++)
+				{
+					perturb->SetPerturbType((EFNPerturbType)perturbType);
+					TestPerturbSets(*this, *noise, *perturb, FString::Printf(TEXT("SIMDLevel %d HashType %d Interp %d PerturbType %d"), level, hash, interp, perturbType), xPoints, yPoints, zPoints);
+				}
+			}
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
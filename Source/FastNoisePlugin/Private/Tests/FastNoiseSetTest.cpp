@@ -0,0 +1,150 @@
+// FastNoiseSetTest.cpp
+//
+// The set functions promise the same floats as the single point functions they stand for
+// Every grid and point set is compared to GetNoise2D/3D(...) of each of its positions, at each fastnoise.SIMDLevel the CPU supports
+// and in both fastnoise.FractalSetOrder orders
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "SIMD/FastNoiseSIMD.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseSetTest, "FastNoise.Sets", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Grids of the noise sets, the lattice walkers keep corners from sample to sample so each grid crosses cells differently
+// A few samples per cell off the lattice, backwards from the origin where every axis starts on a cell edge,
+// and over a cell apart, where the fills go back to sampling every position on its own
+static const float GridStarts[][3] = { { -13.5f, 7.25f, 2.0f }, { 0.0f, 0.0f, 0.0f }, { -13.5f, 7.25f, 2.0f } };
+static const float GridSteps[] = { 0.37f, -0.37f, 13.0f };
+static const int32 GridSize[3] = { 19, 7, 3 };
+
+static const int32 PointCount = 67;
+
+static void TestNoiseSets(FAutomationTestBase& test, const UFastNoise& noise, const FString& settings, const TArray<float>& xPoints, const TArray<float>& yPoints, const TArray<float>& zPoints)
+{
+	const int32 count2D = GridSize[0] * GridSize[1];
+	const int32 count3D = count2D * GridSize[2];
+
+	TArray<float> values, expected;
+	values.SetNumUninitialized(count3D);
+	expected.SetNumUninitialized(count3D);
+
+	for (int32 grid = 0; grid < UE_ARRAY_COUNT(GridSteps); grid++)
+	{
+		const float* start = GridStarts[grid];
+		const float step = GridSteps[grid];
+
+		noise.GetNoiseSet2D(values, start[0], start[1], GridSize[0], GridSize[1], step);
+		for (int32 y = 0, index = 0; y < GridSize[1]; y++)
+		{
+			for (int32 x = 0; x < GridSize[0]; x++, index++)
+				expected[index] = noise.GetNoise2D(start[0] + x * step, start[1] + y * step);
+		}
+		FastNoiseTest::TestValues(test, FString::Printf(TEXT("GetNoiseSet2D grid %d "), grid) + settings, values.GetData(), expected.GetData(), count2D);
+
+		noise.GetNoiseSet3D(values, start[0], start[1], start[2], GridSize[0], GridSize[1], GridSize[2], step);
+		for (int32 z = 0, index = 0; z < GridSize[2]; z++)
+		{
+			for (int32 y = 0; y < GridSize[1]; y++)
+			{
+				for (int32 x = 0; x < GridSize[0]; x++, index++)
+					expected[index] = noise.GetNoise3D(start[0] + x * step, start[1] + y * step, start[2] + z * step);
+			}
+		}
+		FastNoiseTest::TestValues(test, FString::Printf(TEXT("GetNoiseSet3D grid %d "), grid) + settings, values.GetData(), expected.GetData(), count3D);
+	}
+
+	noise.GetNoisePointSet2D(TArrayView<float>(values.GetData(), PointCount), xPoints, yPoints);
+	for (int32 i = 0; i < PointCount; i++)
+		expected[i] = noise.GetNoise2D(xPoints[i], yPoints[i]);
+	FastNoiseTest::TestValues(test, TEXT("GetNoisePointSet2D ") + settings, values.GetData(), expected.GetData(), PointCount);
+
+	noise.GetNoisePointSet3D(TArrayView<float>(values.GetData(), PointCount), xPoints, yPoints, zPoints);
+	for (int32 i = 0; i < PointCount; i++)
+		expected[i] = noise.GetNoise3D(xPoints[i], yPoints[i], zPoints[i]);
+	FastNoiseTest::TestValues(test, TEXT("GetNoisePointSet3D ") + settings, values.GetData(), expected.GetData(), PointCount);
+}
+
+bool FFastNoiseSetTest::RunTest(const FString& Parameters)
+{
+	FastNoiseTest::FScopedConsoleVariable simdLevel(*this, TEXT("fastnoise.SIMDLevel"));
+	FastNoiseTest::FScopedConsoleVariable fractalSetOrder(*this, TEXT("fastnoise.FractalSetOrder"));
+	if (!simdLevel.IsValid() || !fractalSetOrder.IsValid())
+		return false;
+
+	// Spread over both signs and many cells, not on a grid the set fills could follow
+	TArray<float> xPoints, yPoints, zPoints;
+	for (int32 i = 0; i < PointCount; i++)
+	{
+		xPoints.Add(i * 3.17f - 101.3f);
+		yPoints.Add((i * 37 % PointCount) * -1.31f + 40.7f);
+		zPoints.Add((i * 53 % PointCount) * 0.71f - 20.1f);
+	}
+
+	UFastNoise* lookup = NewObject<UFastNoise>();
+	lookup->SetNoiseType(EFNNoiseType::PerlinFractal);
+	lookup->SetFrequency(0.2f);
+
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetFrequency(0.11f);
+	noise->SetFractalOctaves(4);
+	noise->SetCellularNoiseLookup(lookup);
+
+	for (int32 level = FN_SIMD_LEVEL_SCALAR; level <= FastNoiseSIMD::GetSupportedLevel(); level++)
+	{
+		for (int32 order = 0; order < 2; order++)
+		{
+			// The setters below recompile the noise, so it picks both variables up whether or not their change callbacks ran
+			simdLevel.Set(level);
+			fractalSetOrder.Set(order);
+
+			for (int32 hash = 0; hash <= (int32)EFNHashType::Integer; hash++)
+			{
+				noise->SetHashType((EFNHashType)hash);
+
+				for (int32 interp = 0; interp <= (int32)EFNInterp::Quintic; interp++)
+				{
+					noise->SetInterp((EFNInterp)interp);
+
+					for (int32 type = 0; type <= (int32)EFNNoiseType::CubicFractal; type++)
+					{
+						noise->SetNoiseType((EFNNoiseType)type);
+
+						for (int32 fractal = 0; fractal <= (int32)EFNFractalType::RigidMulti; fractal++)
+						{
+							noise->SetFractalType((EFNFractalType)fractal);
+							FString settings = FString::Printf(TEXT("SIMDLevel %d FractalSetOrder %d HashType %d Interp %d NoiseType %d FractalType %d"), level, order, hash, interp, type, fractal);
+
+							if ((EFNNoiseType)type != EFNNoiseType::Cellular)
+							{
+								TestNoiseSets(*this, *noise, settings, xPoints, yPoints, zPoints);
+								continue;
+							}
+
+							// Interpolation and fractal type do not change the cellular kernels, their distance functions and return types are tested once
+							if (interp != 0 || fractal != 0)
+								continue;
+
+							for (int32 distance = 0; distance <= (int32)EFNCellularDistanceFunction::Natural; distance++)
+							{
+								for (int32 returnType = 0; returnType <= (int32)EFNCellularReturnType::Distance2Div; returnType++)
+								{
+									noise->SetCellularDistanceFunction((EFNCellularDistanceFunction)distance);
+									noise->SetCellularReturnType((EFNCellularReturnType)returnType);
+									TestNoiseSets(*this, *noise, settings + FString::Printf(TEXT(" CellularDistanceFunction %d CellularReturnType %d"), distance, returnType), xPoints, yPoints, zPoints);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
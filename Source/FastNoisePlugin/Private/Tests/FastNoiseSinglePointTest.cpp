@@ -0,0 +1,100 @@
+// FastNoiseSinglePointTest.cpp
+//
+// Single point fractals run their octaves in SIMD lanes where that is faster, GetNoise2D/3D(...) promise the floats
+// of the scalar octave loop at each fastnoise.SIMDLevel the CPU supports, with or without a band limited fade
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "SIMD/FastNoiseSIMD.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseSinglePointTest, "FastNoise.SinglePoint", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+static const int32 PointCount = 31;
+
+// One pass of the narrowest lanes, a partial second pass and several passes of the widest
+static const int32 OctaveCounts[] = { 3, 5, 19 };
+
+// Drops the finest octaves of 19 and fades the last one kept
+static const float Footprint = 0.3f;
+
+static const EFNNoiseType NoiseTypes[] = { EFNNoiseType::ValueFractal, EFNNoiseType::PerlinFractal, EFNNoiseType::SimplexFractal };
+
+bool FFastNoiseSinglePointTest::RunTest(const FString& Parameters)
+{
+	FastNoiseTest::FScopedConsoleVariable simdLevel(*this, TEXT("fastnoise.SIMDLevel"));
+	if (!simdLevel.IsValid())
+		return false;
+
+	TArray<float> xPoints, yPoints, zPoints;
+	for (int32 i = 0; i < PointCount; i++)
+	{
+		xPoints.Add(i * 6.13f - 95.3f);
+		yPoints.Add((i * 13 % PointCount) * -4.07f + 52.9f);
+		zPoints.Add((i * 17 % PointCount) * 2.71f - 33.1f);
+	}
+
+	// Scalar values of every setting, in loop order, then compared at each level above it
+	TArray<float> expected, values;
+	values.SetNumUninitialized(PointCount);
+
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetFrequency(0.11f);
+
+	for (int32 level = FN_SIMD_LEVEL_SCALAR; level <= FastNoiseSIMD::GetSupportedLevel(); level++)
+	{
+		// The setters below recompile the noise, so it picks the level up whether or not the change callback ran
+		simdLevel.Set(level);
+		int32 offset = 0;
+
+		for (int32 hash = 0; hash <= (int32)EFNHashType::Integer; hash++)
+		{
+			noise->SetHashType((EFNHashType)hash);
+
+			for (EFNNoiseType noiseType : NoiseTypes)
+			{
+				noise->SetNoiseType(noiseType);
+
+				for (int32 fractal = 0; fractal <= (int32)EFNFractalType::RigidMulti; fractal++)
+				{
+					noise->SetFractalType((EFNFractalType)fractal);
+
+					for (int32 octaves : OctaveCounts)
+					{
+						noise->SetFractalOctaves(octaves);
+						const FString settings = FString::Printf(TEXT("SIMDLevel %d HashType %d NoiseType %d FractalType %d FractalOctaves %d"), level, hash, (int32)noiseType, fractal, octaves);
+
+						for (int32 set = 0; set < 3; set++)
+						{
+							for (int32 i = 0; i < PointCount; i++)
+							{
+								if (set == 0)
+									values[i] = noise->GetNoise2D(xPoints[i], yPoints[i]);
+								else if (set == 1)
+									values[i] = noise->GetNoise3D(xPoints[i], yPoints[i], zPoints[i]);
+								else
+									values[i] = noise->GetNoiseBandLimited3D(xPoints[i], yPoints[i], zPoints[i], Footprint);
+							}
+
+							if (level == FN_SIMD_LEVEL_SCALAR)
+								expected.Append(values);
+							else
+							{
+								static const TCHAR* const SetNames[] = { TEXT("GetNoise2D "), TEXT("GetNoise3D "), TEXT("GetNoiseBandLimited3D ") };
+								FastNoiseTest::TestValues(*this, SetNames[set] + settings, values.GetData(), expected.GetData() + offset, PointCount);
+							}
+							offset += PointCount;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
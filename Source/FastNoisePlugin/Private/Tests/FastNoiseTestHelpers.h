@@ -0,0 +1,62 @@
+// FastNoiseTestHelpers.h
+//
+// Shared by the FastNoise automation tests
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FastNoiseTest
+{
+	// Reports the first value that differs from the expected one, returns false if there was one
+	// Bit exact, the batched and threaded paths promise the same floats as the functions they stand for
+	inline bool TestValues(FAutomationTestBase& test, const FString& what, const float* values, const float* expected, int32 count)
+	{
+		for (int32 i = 0; i < count; i++)
+		{
+			// NaN never equals itself, but a set has to give NaN where the expected function does
+			if (values[i] != expected[i] && !(FMath::IsNaN(values[i]) && FMath::IsNaN(expected[i])))
+			{
+				test.AddError(FString::Printf(TEXT("%s: value %d is %.9g, expected %.9g"), *what, i, values[i], expected[i]));
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// Sets an int console variable during a test and restores its old value when the scope ends
+	class FScopedConsoleVariable
+	{
+	public:
+		FScopedConsoleVariable(FAutomationTestBase& test, const TCHAR* name)
+			: Variable(IConsoleManager::Get().FindConsoleVariable(name))
+		{
+			if (Variable)
+				OldValue = Variable->GetInt();
+			else
+				test.AddError(FString::Printf(TEXT("%s is not registered"), name));
+		}
+
+		~FScopedConsoleVariable()
+		{
+			if (Variable)
+				Variable->Set(OldValue, ECVF_SetByCode);
+		}
+
+		bool IsValid() const { return Variable != nullptr; }
+
+		// Noises compiled before the change keep their kernels until a setter or the change callback recompiles them
+		void Set(int32 value) const { Variable->Set(value, ECVF_SetByCode); }
+
+	private:
+		IConsoleVariable* Variable;
+		int32 OldValue = 0;
+	};
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,122 @@
+// FastNoiseTileCacheTest.cpp
+//
+// Hits, misses, eviction order, the byte budget and the invalidation of tiles when a noise or its lookup noise is edited
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "FastNoise.h"
+#include "FastNoiseTileCache.h"
+#include "FastNoiseTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastNoiseTileCacheTest, "FastNoise.TileCache", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+static const int32 TileResolution = 32;
+static const float TileStep = 0.5f;
+
+static void TestTile(FAutomationTestBase& test, const FString& what, const UFastNoise& noise, const FFastNoiseTileRef& tile, FIntPoint tileCoord)
+{
+	const float tileSpan = TileResolution * TileStep;
+
+	TArray<float> expected;
+	expected.SetNumUninitialized(TileResolution * TileResolution);
+	noise.GetNoiseSet2D(expected, tileCoord.X * tileSpan, tileCoord.Y * tileSpan, TileResolution, TileResolution, TileStep);
+
+	if (test.TestEqual(what + TEXT(" size"), tile->Num(), TileResolution * TileResolution))
+		FastNoiseTest::TestValues(test, what, tile->GetData(), expected.GetData(), TileResolution * TileResolution);
+}
+
+static void TestCounts(FAutomationTestBase& test, const FString& what, const FFastNoiseTileCache& cache, uint64 hits, uint64 misses, int32 tiles)
+{
+	test.TestEqual(what + TEXT(" hits"), cache.GetHitCount(), hits);
+	test.TestEqual(what + TEXT(" misses"), cache.GetMissCount(), misses);
+	test.TestEqual(what + TEXT(" tiles"), cache.GetNumTiles(), tiles);
+}
+
+bool FFastNoiseTileCacheTest::RunTest(const FString& Parameters)
+{
+	UFastNoise* lookup = NewObject<UFastNoise>();
+	lookup->SetNoiseType(EFNNoiseType::Perlin);
+	lookup->SetFrequency(0.2f);
+
+	UFastNoise* noise = NewObject<UFastNoise>();
+	noise->SetNoiseType(EFNNoiseType::Cellular);
+	noise->SetCellularReturnType(EFNCellularReturnType::NoiseLookup);
+	noise->SetCellularNoiseLookup(lookup);
+	noise->SetFrequency(0.1f);
+
+	UFastNoise* other = NewObject<UFastNoise>();
+
+	const FIntPoint tileA(0, 0), tileB(1, -2), tileC(-3, 5);
+
+	FFastNoiseTileCache cache(MAX_int64);
+
+	TestTile(*this, TEXT("First tile"), *noise, cache.GetTile2D(noise, tileA, TileResolution, TileStep), tileA);
+	TestCounts(*this, TEXT("After the first miss"), cache, 0, 1, 1);
+
+	TestTile(*this, TEXT("Cached tile"), *noise, cache.GetTile2D(noise, tileA, TileResolution, TileStep), tileA);
+	TestCounts(*this, TEXT("After the first hit"), cache, 1, 1, 1);
+
+	// Every tile of this resolution holds the same allocation
+	const int64 tileBytes = cache.GetResidentBytes();
+	TestTrue(TEXT("Resident bytes cover the tile"), tileBytes >= (int64)(TileResolution * TileResolution * sizeof(float)));
+
+	// A budget of two tiles, A is used again before C comes in so B is the least recently used
+	cache.SetMaxBytes(tileBytes * 2);
+	cache.GetTile2D(noise, tileB, TileResolution, TileStep);
+	cache.GetTile2D(noise, tileA, TileResolution, TileStep);
+	FFastNoiseTileRef heldB = cache.GetTile2D(noise, tileB, TileResolution, TileStep);
+	cache.GetTile2D(noise, tileA, TileResolution, TileStep);
+	cache.GetTile2D(noise, tileC, TileResolution, TileStep);
+	TestCounts(*this, TEXT("After evicting B"), cache, 4, 3, 2);
+	TestEqual(TEXT("Resident bytes after evicting B"), cache.GetResidentBytes(), tileBytes * 2);
+
+	cache.GetTile2D(noise, tileA, TileResolution, TileStep);
+	cache.GetTile2D(noise, tileC, TileResolution, TileStep);
+	TestCounts(*this, TEXT("A and C stay cached"), cache, 6, 3, 2);
+
+	// An evicted tile stays valid for whoever still holds it
+	TestTile(*this, TEXT("Held evicted tile"), *noise, heldB, tileB);
+
+	TestTile(*this, TEXT("Regenerated tile"), *noise, cache.GetTile2D(noise, tileB, TileResolution, TileStep), tileB);
+	TestCounts(*this, TEXT("After regenerating B"), cache, 6, 4, 2);
+	TestEqual(TEXT("Resident bytes after evicting A"), cache.GetResidentBytes(), tileBytes * 2);
+
+	cache.SetMaxBytes(tileBytes - 1);
+	TestCounts(*this, TEXT("After shrinking the budget"), cache, 6, 4, 0);
+	TestEqual(TEXT("Resident bytes after shrinking the budget"), cache.GetResidentBytes(), (int64)0);
+
+	cache.SetMaxBytes(MAX_int64);
+	cache.ResetStats();
+
+	cache.GetTile2D(noise, tileA, TileResolution, TileStep);
+	cache.GetTile2D(other, tileA, TileResolution, TileStep);
+	TestCounts(*this, TEXT("Before the edits"), cache, 0, 2, 2);
+
+	// Editing a noise the cached noise does not sample keeps its tiles
+	other->SetFrequency(0.03f);
+	TestCounts(*this, TEXT("After editing an unrelated noise"), cache, 0, 2, 1);
+
+	// Editing the lookup changes the cellular noise too, its tiles have to go
+	lookup->SetFrequency(0.3f);
+	TestCounts(*this, TEXT("After editing the lookup noise"), cache, 0, 2, 0);
+
+	TestTile(*this, TEXT("Tile after editing the lookup noise"), *noise, cache.GetTile2D(noise, tileA, TileResolution, TileStep), tileA);
+	TestCounts(*this, TEXT("After regenerating A"), cache, 0, 3, 1);
+
+	// A lookup that leads back to the noise is refused with a warning and the old lookup kept, the cache keeps hashing a finite chain
+	lookup->SetNoiseType(EFNNoiseType::Cellular);
+	lookup->SetCellularReturnType(EFNCellularReturnType::NoiseLookup);
+	lookup->SetCellularNoiseLookup(other);
+
+	AddExpectedError(TEXT("cannot be its CellularNoiseLookup"), EAutomationExpectedErrorFlags::Contains, 1);
+	lookup->SetCellularNoiseLookup(noise);
+	TestTrue(TEXT("A lookup cycle is refused"), lookup->GetCellularNoiseLookup() == other);
+
+	TestTile(*this, TEXT("Tile after refusing the cycle"), *noise, cache.GetTile2D(noise, tileA, TileResolution, TileStep), tileA);
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -32,6 +32,8 @@
 
 #include "CoreMinimal.h"
 #include "ObjectMacros.h"
+#include "Async/Future.h"
+#include "HAL/ThreadSafeBool.h"
 #include "FastNoise.generated.h"
 
 // Uncomment the line below to use doubles throughout UFastNoise instead of floats
@@ -39,6 +41,43 @@
 
 #define FN_CELLULAR_INDEX_MAX 3
 
+struct FFastNoiseSIMDKernels;
+class UFastNoise;
+class FFastNoiseAsyncRequest;
+
+typedef TSharedRef<FFastNoiseAsyncRequest, ESPMode::ThreadSafe> FFastNoiseAsyncRequestRef;
+
+// Executed on the game thread when an async noise set request finishes, unless it was cancelled
+DECLARE_DELEGATE_OneParam(FFastNoiseAsyncDelegate, const FFastNoiseAsyncRequestRef&);
+
+// Broadcast on the game thread after any property of a noise changed, its settings hash may have changed with it
+DECLARE_MULTICAST_DELEGATE_OneParam(FFastNoiseChangedDelegate, const UFastNoise*);
+
+// Handle to a noise set that is generated on a thread pool worker by UFastNoise::GetNoiseSet2DAsync(...) or GetNoiseSet3DAsync(...)
+class FASTNOISEPLUGIN_API FFastNoiseAsyncRequest
+{
+public:
+	FFastNoiseAsyncRequest() : Result(Promise.GetFuture()) {}
+
+	// Stops generating at the next tile, Result then completes with an empty array and the delegate is not executed
+	void Cancel() { bCancelled = true; }
+	bool IsCancelled() const { return bCancelled; }
+
+private:
+	TPromise<TArray<float>> Promise;
+
+public:
+	// Completes with the noise set, laid out as in UFastNoise::GetNoiseSet2D(...) or GetNoiseSet3D(...)
+	TFuture<TArray<float>> Result;
+
+private:
+	FThreadSafeBool bCancelled;
+
+	static void Complete(const FFastNoiseAsyncRequestRef& request, TArray<float>&& noiseSet, const FFastNoiseAsyncDelegate& onComplete);
+
+	friend class UFastNoise;
+};
+
 UENUM(BlueprintType)
 enum class EFNNoiseType : uint8
 {
@@ -91,6 +130,629 @@ enum class EFNCellularReturnType : uint8
 	Distance2Div UMETA(DisplayName="Distance2Div")
 };
 
+UENUM(BlueprintType)
+enum class EFNPerturbType : uint8
+{
+	Gradient UMETA(DisplayName="Gradient"),
+	Simplex	 UMETA(DisplayName="Simplex")
+};
+
+UENUM(BlueprintType)
+enum class EFNHashType : uint8
+{
+	Permutation UMETA(DisplayName="Permutation"),
+	Integer		UMETA(DisplayName="Integer")
+};
+
+// Order the grid fills of the fractal noise types evaluate octaves in, both fill the same values
+enum class EFNFractalSetOrder : uint8
+{
+	// Every octave of a sample before the next sample
+	PointMajor,
+	// One octave over the whole grid before the next, summed into the output
+	OctaveMajor
+};
+
+// Permutation tables of one seed, built once and shared by every noise and evaluator using that seed
+struct FASTNOISEPLUGIN_API FFastNoisePermutation
+{
+	int32 Perm[512];
+	int32 Perm12[512];
+
+	// Returns the tables for seed, they are only built when no noise holds them already
+	// Thread safe, the tables are freed once the last reference is released
+	static TSharedRef<const FFastNoisePermutation, ESPMode::ThreadSafe> Get(int32 seed);
+
+private:
+	explicit FFastNoisePermutation(int32 seed);
+};
+
+// Every output of one cellular search, returned by GetCellularSample2D/3D(...) whatever CellularReturnType is set to
+struct FFastNoiseCellularSample
+{
+	// Distance to the closest point, as returned by the Distance return type
+	float Distance;
+
+	// Distances to the points at CellularDistanceIndex0 and CellularDistanceIndex1, which the Distance2 return types combine
+	float Distance0;
+	float Distance1;
+
+	// Value of the closest cell, as returned by the CellValue return type
+	float CellValue;
+
+	// Lattice coordinates of the closest cell, unique to it, Z is 0 in 2D
+	FIntVector Cell;
+
+	// Jittered point of the closest cell, in the same unscaled coordinates as the sampled position
+	FVector CellPosition;
+
+	// Distance2Sub, the distance to the edge shared with the next closest cell
+	float GetEdgeDistance() const { return Distance1 - Distance0; }
+};
+
+// Structure of arrays GetCellularSamplePointSet2D/3D(...) write to, element i holds the sample of point i
+// Any array may be left empty to skip that output, the others must hold at least one element per point
+// CellZ and CellPositionZ are only written by the 3D set
+struct FFastNoiseCellularSampleSet
+{
+	TArrayView<float> Distance;
+	TArrayView<float> Distance0;
+	TArrayView<float> Distance1;
+	TArrayView<float> CellValue;
+
+	TArrayView<int32> CellX;
+	TArrayView<int32> CellY;
+	TArrayView<int32> CellZ;
+
+	TArrayView<float> CellPositionX;
+	TArrayView<float> CellPositionY;
+	TArrayView<float> CellPositionZ;
+};
+
+// Compiled settings of one noise, the plain data read by both the scalar and the vectorized kernels
+// Trivially copyable, UFastNoise keeps one up to date with its properties and FFastNoiseEvaluator holds a copy per lookup chain entry
+// Both also hold a reference to the permutation tables the copy points to
+struct FASTNOISEPLUGIN_API FFastNoiseParams
+{
+	// Tables of the shared FFastNoisePermutation for Seed, its owner keeps them alive, nullptr for the Integer hash type
+	const int32* Perm;
+	const int32* Perm12;
+
+	int32 Seed;
+	float Frequency;
+	EFNNoiseType NoiseType;
+	EFNInterp Interpolation;
+	EFNFractalType FractalType;
+
+	int32 FractalOctaves;
+	float FractalLacunarity;
+	float FractalGain;
+	float FractalBounding;
+	// Weight of the last octave, below 1 only in the copies GetBandLimited(...) returns
+	float FractalFade;
+
+	EFNCellularDistanceFunction CellularDistanceFunction;
+	EFNCellularReturnType CellularReturnType;
+	int32 CellularDistanceIndex0;
+	int32 CellularDistanceIndex1;
+	float CellularJitter;
+
+	float GradientPerturbAmp;
+	EFNPerturbType PerturbType;
+
+	EFNHashType HashType;
+
+	// Noise sampled by the Cellular NoiseLookup return type
+	const FFastNoiseParams* Lookup;
+
+	// Vectorized kernels for NoiseType at the SIMD level active when these params were compiled, nullptr for the scalar path
+	const FFastNoiseSIMDKernels* Kernels;
+
+	// Kernels of the same level for the GradientPerturb and cellular sample sets, which do not depend on NoiseType
+	const FFastNoiseSIMDKernels* PerturbKernels;
+
+	// Kernels single point fractals run their octaves in the lanes of, nullptr if the scalar octave loop is faster for HashType
+	const FFastNoiseSIMDKernels* FractalKernels;
+
+	// Octave order of the fractal noise set grids, fastnoise.FractalSetOrder when these params were compiled
+	EFNFractalSetOrder FractalSetOrder;
+
+	// Lattice cell every cell the kernels visit is offset by before it is hashed, 0 except in copies made by the large world path
+	// Only the low 32 bits reach the hashes, so a position billions of cells away hashes as the cell it is really in
+	int64 LatticeOriginX;
+	int64 LatticeOriginY;
+	int64 LatticeOriginZ;
+
+	// Offset the non fractal noise types sample with, the large world path samples octave i of a fractal as its base type with OctaveOffset(i)
+	uint8 BaseOffset;
+
+	// Offset passed to the octave kernels, Integer hashing adds the octave to the seed instead of reading Perm
+	uint8 OctaveOffset(int32 octave) const { return HashType == EFNHashType::Integer ? (uint8)octave : (uint8)Perm[octave]; }
+
+	//2D
+	float GetValue2D(float x, float y) const;
+	float GetValueFractal2D(float x, float y) const;
+
+	float GetPerlin2D(float x, float y) const;
+	float GetPerlinFractal2D(float x, float y) const;
+
+	float GetSimplex2D(float x, float y) const;
+	float GetSimplexFractal2D(float x, float y) const;
+
+	float GetCellular2D(float x, float y) const;
+
+	float GetWhiteNoise2D(float x, float y) const;
+	float GetWhiteNoiseInt2D(int32 x, int32 y) const;
+
+	float GetCubic2D(float x, float y) const;
+	float GetCubicFractal2D(float x, float y) const;
+
+	float GetNoise2D(float x, float y) const;
+
+	void GradientPerturb2D(float& x, float& y) const;
+	void GradientPerturbFractal2D(float& x, float& y) const;
+
+	//3D
+	float GetValue3D(float x, float y, float z) const;
+	float GetValueFractal3D(float x, float y, float z) const;
+
+	float GetPerlin3D(float x, float y, float z) const;
+	float GetPerlinFractal3D(float x, float y, float z) const;
+
+	float GetSimplex3D(float x, float y, float z) const;
+	float GetSimplexFractal3D(float x, float y, float z) const;
+
+	float GetCellular3D(float x, float y, float z) const;
+
+	float GetWhiteNoise3D(float x, float y, float z) const;
+	float GetWhiteNoiseInt3D(int32 x, int32 y, int32 z) const;
+
+	float GetCubic3D(float x, float y, float z) const;
+	float GetCubicFractal3D(float x, float y, float z) const;
+
+	float GetNoise3D(float x, float y, float z) const;
+
+	void GradientPerturb3D(float& x, float& y, float& z) const;
+	void GradientPerturbFractal3D(float& x, float& y, float& z) const;
+
+	//4D
+	float GetSimplex4D(float x, float y, float z, float w) const;
+
+	float GetWhiteNoise4D(float x, float y, float z, float w) const;
+	float GetWhiteNoiseInt4D(int32 x, int32 y, int32 z, int32 w) const;
+
+	// Hash of every setting that affects the output, including the lookup noise when it is sampled
+	// Stable between runs and platforms, equal settings give equal hashes whichever object holds them
+	uint64 GetSettingsHash() const;
+
+	//Derivatives
+	// Same as the functions without Derivative, gradient is set to the gradient of the returned value in the same pass
+	// The gradient is with respect to the unscaled position and includes every octave of the fractal types
+	float GetValueDerivative2D(float x, float y, FVector2D& gradient) const;
+	float GetValueFractalDerivative2D(float x, float y, FVector2D& gradient) const;
+	float GetPerlinDerivative2D(float x, float y, FVector2D& gradient) const;
+	float GetPerlinFractalDerivative2D(float x, float y, FVector2D& gradient) const;
+	float GetSimplexDerivative2D(float x, float y, FVector2D& gradient) const;
+	float GetSimplexFractalDerivative2D(float x, float y, FVector2D& gradient) const;
+
+	float GetValueDerivative3D(float x, float y, float z, FVector& gradient) const;
+	float GetValueFractalDerivative3D(float x, float y, float z, FVector& gradient) const;
+	float GetPerlinDerivative3D(float x, float y, float z, FVector& gradient) const;
+	float GetPerlinFractalDerivative3D(float x, float y, float z, FVector& gradient) const;
+	float GetSimplexDerivative3D(float x, float y, float z, FVector& gradient) const;
+	float GetSimplexFractalDerivative3D(float x, float y, float z, FVector& gradient) const;
+
+	// GetNoise2D/3D(...) and its gradient
+	// Value, Perlin and Simplex noise types are derived analytically, the others estimate the gradient with central differences
+	float GetNoiseDerivative2D(float x, float y, FVector2D& gradient) const;
+	float GetNoiseDerivative3D(float x, float y, float z, FVector& gradient) const;
+
+	// Fills noiseSet as GetNoiseSet2D/3D(...) does and gradientSet with the gradient of every sample, in the same layout
+	void GetNoiseDerivativeSet2D(TArrayView<float> noiseSet, TArrayView<FVector2D> gradientSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const;
+	void GetNoiseDerivativeSet3D(TArrayView<float> noiseSet, TArrayView<FVector> gradientSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const;
+
+	// Fills noiseSet as GetNoisePointSet2D/3D(...) does and gradientSet with the gradient at every point
+	void GetNoiseDerivativePointSet2D(TArrayView<float> noiseSet, TArrayView<FVector2D> gradientSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const;
+	void GetNoiseDerivativePointSet3D(TArrayView<float> noiseSet, TArrayView<FVector> gradientSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const;
+
+	//Heightmaps
+	// Fills a xSize * ySize heightmap laid out as in GetNoiseSet2D(...), heights are the noise scaled by heightScale
+	// normals are the unit normals of the surface z = height and slopes the angle between the normal and +Z in degrees, either may be empty to skip it
+	// Noise types with an analytic derivative use it, the others sample a one texel apron around the grid and take central differences,
+	// so the normals of adjacent tiles match without sampling each other, stepSize has to be positive
+	void GetHeightmap2D(TArrayView<float> heights, TArrayView<FVector> normals, TArrayView<float> slopes, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f, float heightScale = 1.0f) const;
+
+	//Cellular Samples
+	// One cellular search at a position with the current cellular settings, filling every output the cellular return types choose from
+	// Independent of NoiseType and CellularReturnType, CellularNoiseLookup is not sampled
+	FFastNoiseCellularSample GetCellularSample2D(float x, float y) const;
+	FFastNoiseCellularSample GetCellularSample3D(float x, float y, float z) const;
+
+	// GetCellularSample2D/3D(...) of every point, written to the arrays of sampleSet
+	// Several points are searched at a time with SIMD when the CPU supports it, skipped outputs are not computed
+	void GetCellularSamplePointSet2D(const FFastNoiseCellularSampleSet& sampleSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const;
+	void GetCellularSamplePointSet3D(const FFastNoiseCellularSampleSet& sampleSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const;
+
+	//Band Limiting
+	// Copy of these settings without the octaves too fine for samples footprint units apart, in the same unscaled units as positions
+	// An octave is dropped once the samples are half a lattice cell of it apart and fades out over the lacunarity step before that
+	// FractalBounding is kept, so the octaves left have the same amplitude as in the full fractal, at least one octave is always kept
+	// Only the fractal noise types and GradientPerturbFractal2D/3D(...) sample fewer octaves
+	FFastNoiseParams GetBandLimited(float footprint) const;
+
+	// GetNoise2D/3D(...) of a sample covering footprint units
+	float GetNoiseBandLimited2D(float x, float y, float footprint) const;
+	float GetNoiseBandLimited3D(float x, float y, float z, float footprint) const;
+
+	// GetNoiseSet2D/3D(...) without the octaves finer than stepSize resolves
+	void GetNoiseSetBandLimited2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const;
+	void GetNoiseSetBandLimited3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const;
+
+	// 1 over the summed amplitude of octaves octaves, which scales the fractal sums into [-1, 1]
+	static float CalculateFractalBounding(int32 octaves, float gain);
+
+	//Large World Coordinates
+	// GetNoise2D(...) at a double precision position, for worlds too large for float positions to resolve the noise
+	// Each octave splits its frequency scaled position into a lattice cell and a float offset inside it, the kernels only see the offset
+	// A chunk index times the chunk size plus a local offset is exact in double for any int32 chunk index
+	float GetNoiseLarge2D(double x, double y) const;
+	float GetNoiseLarge3D(double x, double y, double z) const;
+
+	// GetNoiseSet2D(...) starting at a double precision position
+	// The lattice cell is split off once per octave for the whole set, so the set keeps using the vectorized float kernels
+	void GetNoiseSetLarge2D(TArrayView<float> noiseSet, double xStart, double yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const;
+	void GetNoiseSetLarge3D(TArrayView<float> noiseSet, double xStart, double yStart, double zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const;
+
+	//Noise Sets
+	// Fills noiseSet with a xSize * ySize grid of GetNoise2D(...) samples
+	// Sample (x, y) is taken at (xStart + x * stepSize, yStart + y * stepSize) and stored at noiseSet[x + xSize * y]
+	// The noise type is resolved once per set instead of once per sample, Value, Perlin, Simplex and Cellular noise types use SIMD when the CPU supports it
+	void GetNoiseSet2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const;
+
+	// Fills noiseSet with a xSize * ySize * zSize grid of GetNoise3D(...) samples
+	// Sample (x, y, z) is taken at (xStart + x * stepSize, yStart + y * stepSize, zStart + z * stepSize) and stored at noiseSet[x + xSize * (y + ySize * z)]
+	// The noise type is resolved once per set instead of once per sample, Value, Perlin, Simplex and Cellular noise types use SIMD when the CPU supports it
+	void GetNoiseSet3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const;
+
+	// Same as GetNoiseSet2D(...), but the grid is split into tiles of whole rows that are filled on the task graph's worker threads
+	// A tile holds at least minBatchSize samples, the output is identical to GetNoiseSet2D(...) whatever the number of threads
+	void GetNoiseSetParallel2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f, int32 minBatchSize = 4096) const;
+
+	// Same as GetNoiseSet3D(...), but the grid is split into tiles of whole rows that are filled on the task graph's worker threads
+	// A tile holds at least minBatchSize samples, the output is identical to GetNoiseSet3D(...) whatever the number of threads
+	void GetNoiseSetParallel3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f, int32 minBatchSize = 4096) const;
+
+	// Fills noiseSet with GetNoise2D(xPoints[i], yPoints[i]) for every point
+	// Value, Perlin, Simplex and Cellular noise types are evaluated several points at a time with SIMD when the CPU supports it
+	void GetNoisePointSet2D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const;
+
+	// Fills noiseSet with GetNoise3D(xPoints[i], yPoints[i], zPoints[i]) for every point
+	// Value, Perlin, Simplex and Cellular noise types are evaluated several points at a time with SIMD when the CPU supports it
+	void GetNoisePointSet3D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const;
+
+	//Gradient Perturb Sets
+	// GradientPerturb2D/3D(...) or GradientPerturbFractal2D/3D(...) of every point, the coordinate arrays are warped in place
+	// Several points are warped at a time with SIMD when the CPU supports it, whatever the noise type
+	void GradientPerturbSet2D(TArrayView<float> xPoints, TArrayView<float> yPoints) const;
+	void GradientPerturbFractalSet2D(TArrayView<float> xPoints, TArrayView<float> yPoints) const;
+	void GradientPerturbSet3D(TArrayView<float> xPoints, TArrayView<float> yPoints, TArrayView<float> zPoints) const;
+	void GradientPerturbFractalSet3D(TArrayView<float> xPoints, TArrayView<float> yPoints, TArrayView<float> zPoints) const;
+
+	// Fills noiseSet with GetNoise2D/3D(...) at every point after perturb.GradientPerturb{Fractal}2D/3D(...) warped it
+	// Points are warped and sampled a small chunk at a time, the warped coordinates of the whole set are never stored
+	void GetPerturbedNoisePointSet2D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, const FFastNoiseParams& perturb, bool fractalPerturb) const;
+	void GetPerturbedNoisePointSet3D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints, const FFastNoiseParams& perturb, bool fractalPerturb) const;
+
+	// Fills a noise set grid from its frequency scaled axis coordinates, xCoords is padded by FastNoiseSIMD::MaxVectorWidth
+	void FillNoiseGrid2D(float* out, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize) const;
+	void FillNoiseGrid3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize) const;
+	// Fills rows [rowStart, rowEnd) of a 3D noise set grid, row y of slice z is numbered y + ySize * z
+	void FillNoiseGridRows3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 rowStart, int32 rowEnd) const;
+
+private:
+	// Calls fill with the scalar noise function of noiseType for the current settings, returns false if there is none
+	// Hash type, interpolation and fractal type are resolved here, so the function passed to fill does not branch on them per sample
+	template <typename FNoiseSetFunc>
+	bool DispatchNoise2D(EFNNoiseType noiseType, FNoiseSetFunc fill) const;
+	template <typename FNoiseSetFunc>
+	bool DispatchNoise3D(EFNNoiseType noiseType, FNoiseSetFunc fill) const;
+
+	// Calls fill with noiseFunc, or with its fractal for the current fractal type if fractal is set
+	template <typename FNoiseSetFunc, typename FNoiseFunc>
+	void DispatchFractal2D(FNoiseSetFunc& fill, bool fractal, FNoiseFunc noiseFunc) const;
+	template <typename FNoiseSetFunc, typename FNoiseFunc>
+	void DispatchFractal3D(FNoiseSetFunc& fill, bool fractal, FNoiseFunc noiseFunc) const;
+
+	// Calls fill with the cellular kernel for the current distance function, return type and distance index 1
+	template <typename FNoiseSetFunc>
+	void DispatchCellular2D(FNoiseSetFunc& fill) const;
+	template <typename FNoiseSetFunc>
+	void DispatchCellular3D(FNoiseSetFunc& fill) const;
+
+	// Calls func with SingleCellularSample(...) for the current distance function and distance index 1
+	template <typename FFunc>
+	void DispatchCellularSample(FFunc func) const;
+
+	// Single sample of noiseType at already frequency scaled coordinates
+	float SampleNoise2D(EFNNoiseType noiseType, float x, float y) const;
+	float SampleNoise3D(EFNNoiseType noiseType, float x, float y, float z) const;
+	bool SamplesOctavesInLanes(EFNNoiseType noiseType) const;
+
+	// Same as DispatchNoise2D/3D(...), the functions passed to fill also write the gradient, returns false for noise types without an analytic derivative
+	template <typename FNoiseSetFunc>
+	bool DispatchNoiseDerivative2D(EFNNoiseType noiseType, FNoiseSetFunc fill) const;
+	template <typename FNoiseSetFunc>
+	bool DispatchNoiseDerivative3D(EFNNoiseType noiseType, FNoiseSetFunc fill) const;
+
+	template <typename FNoiseSetFunc, typename FNoiseFunc>
+	void DispatchFractalDerivative2D(FNoiseSetFunc& fill, bool fractal, FNoiseFunc noiseFunc) const;
+	template <typename FNoiseSetFunc, typename FNoiseFunc>
+	void DispatchFractalDerivative3D(FNoiseSetFunc& fill, bool fractal, FNoiseFunc noiseFunc) const;
+
+	// Single sample of noiseType and its gradient at already frequency scaled coordinates, the gradient is not scaled by Frequency
+	float SampleNoiseDerivative2D(EFNNoiseType noiseType, float x, float y, FVector2D& gradient) const;
+	float SampleNoiseDerivative3D(EFNNoiseType noiseType, float x, float y, float z, FVector& gradient) const;
+
+	// Calls func with the single point warp selected by PerturbType and Interpolation
+	template <typename FFunc>
+	void DispatchPerturb(FFunc func) const;
+
+	// NoiseLookup return type of whole sets, the closest cell of every sample is found first and the lookup noise then samples the cells
+	void FillCellularLookupGrid2D(float* out, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize) const;
+	void FillCellularLookupGrid3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize) const;
+	void FillCellularLookupPointSet2D(float* out, const float* xPoints, const float* yPoints, int32 count) const;
+	void FillCellularLookupPointSet3D(float* out, const float* xPoints, const float* yPoints, const float* zPoints, int32 count) const;
+
+	// Lookup noise samples of count closest cells, every cell of the box around them is sampled once if the box holds at most count cells,
+	// otherwise each run of samples in the same cell samples it once
+	void SampleCellularLookup2D(float* out, const int32* xCell, const int32* yCell, int32 count) const;
+	void SampleCellularLookup3D(float* out, const int32* xCell, const int32* yCell, const int32* zCell, int32 count) const;
+
+	// Warps count points into the out arrays, which may be the point arrays themselves
+	void PerturbPoints2D(float* xOut, float* yOut, const float* xPoints, const float* yPoints, int32 count, bool fractal) const;
+	void PerturbPoints3D(float* xOut, float* yOut, float* zOut, const float* xPoints, const float* yPoints, const float* zPoints, int32 count, bool fractal) const;
+
+	//2D
+	template <EFNFractalType FractalType, typename FNoiseFunc>
+	float SingleFractal(float x, float y, FNoiseFunc noiseFunc) const;
+
+	template <typename THash, typename TInterp>
+	float SingleValue(uint8 offset, float x, float y) const;
+	template <typename THash, typename TInterp>
+	float SinglePerlin(uint8 offset, float x, float y) const;
+
+	template <typename THash>
+	float SingleSimplexFractalBlend(float x, float y) const;
+	template <typename THash>
+	float SingleSimplex(uint8 offset, float x, float y) const;
+
+	template <typename THash>
+	float SingleCubic(uint8 offset, float x, float y) const;
+
+	template <EFNFractalType FractalType, typename FNoiseFunc>
+	float SingleFractalDerivative(float x, float y, FVector2D& gradient, FNoiseFunc noiseFunc) const;
+
+	template <typename THash, typename TInterp>
+	float SingleValueDerivative(uint8 offset, float x, float y, FVector2D& gradient) const;
+	template <typename THash, typename TInterp>
+	float SinglePerlinDerivative(uint8 offset, float x, float y, FVector2D& gradient) const;
+	template <typename THash>
+	float SingleSimplexDerivative(uint8 offset, float x, float y, FVector2D& gradient) const;
+
+	// Returns the distance to the closest point and writes the coordinates of its cell
+	template <typename THash, typename TDistance>
+	float SingleCellularClosest(float x, float y, int32& xc, int32& yc) const;
+	template <typename THash, typename TDistance, EFNCellularReturnType ReturnType>
+	float SingleCellular(float x, float y) const;
+	template <typename THash, typename TDistance, EFNCellularReturnType ReturnType, int32 DistanceIndex1>
+	float SingleCellular2Edge(float x, float y) const;
+	template <typename THash, typename TDistance, int32 DistanceIndex1>
+	void SingleCellularSample(float x, float y, FFastNoiseCellularSample& sample) const;
+
+	template <typename THash, typename TInterp>
+	void SingleGradientPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y) const;
+	template <typename THash>
+	void SingleSimplexPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y) const;
+	template <typename FPerturb>
+	void SinglePerturbFractal(FPerturb& perturb, float& x, float& y) const;
+
+	//3D
+	template <EFNFractalType FractalType, typename FNoiseFunc>
+	float SingleFractal(float x, float y, float z, FNoiseFunc noiseFunc) const;
+
+	template <typename THash, typename TInterp>
+	float SingleValue(uint8 offset, float x, float y, float z) const;
+	template <typename THash, typename TInterp>
+	float SinglePerlin(uint8 offset, float x, float y, float z) const;
+
+	template <typename THash>
+	float SingleSimplex(uint8 offset, float x, float y, float z) const;
+
+	template <typename THash>
+	float SingleCubic(uint8 offset, float x, float y, float z) const;
+
+	template <EFNFractalType FractalType, typename FNoiseFunc>
+	float SingleFractalDerivative(float x, float y, float z, FVector& gradient, FNoiseFunc noiseFunc) const;
+
+	template <typename THash, typename TInterp>
+	float SingleValueDerivative(uint8 offset, float x, float y, float z, FVector& gradient) const;
+	template <typename THash, typename TInterp>
+	float SinglePerlinDerivative(uint8 offset, float x, float y, float z, FVector& gradient) const;
+	template <typename THash>
+	float SingleSimplexDerivative(uint8 offset, float x, float y, float z, FVector& gradient) const;
+
+	template <typename THash, typename TDistance>
+	float SingleCellularClosest(float x, float y, float z, int32& xc, int32& yc, int32& zc) const;
+	template <typename THash, typename TDistance, EFNCellularReturnType ReturnType>
+	float SingleCellular(float x, float y, float z) const;
+	template <typename THash, typename TDistance, EFNCellularReturnType ReturnType, int32 DistanceIndex1>
+	float SingleCellular2Edge(float x, float y, float z) const;
+	template <typename THash, typename TDistance, int32 DistanceIndex1>
+	void SingleCellularSample(float x, float y, float z, FFastNoiseCellularSample& sample) const;
+
+	template <typename THash, typename TInterp>
+	void SingleGradientPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y, float& z) const;
+	template <typename THash>
+	void SingleSimplexPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y, float& z) const;
+	template <typename FPerturb>
+	void SinglePerturbFractal(FPerturb& perturb, float& x, float& y, float& z) const;
+
+	//4D
+	template <typename THash>
+	float SingleSimplex(uint8 offset, float x, float y, float z, float w) const;
+
+	// Calls func(octave, frequency, weight) for every octave of the large world path and the octave major grids, octave samples it at positions scaled by frequency
+	// The caller sums LargeOctaveNoise(noise) * weight and returns LargeNoiseSum(sum)
+	template <typename FOctaveFunc>
+	void ForEachLargeOctave(FOctaveFunc func) const;
+	float LargeOctaveNoise(float noise) const;
+	float LargeNoiseSum(float sum) const;
+
+	// Whether GetNoiseSetLarge2D/3D(...) fall back to sampling one point at a time
+	bool SamplesLargeSetPerPoint() const;
+
+	// Hash of the settings of this layer alone followed by lookupHash, the hash of the lookup noise it samples or 0
+	uint64 GetLayerSettingsHash(uint64 lookupHash) const;
+
+	// Whether FillNoiseGrid2D/3D(...) fill the grid one octave at a time with FillNoiseGridOctaves2D/3D(...)
+	bool FillsGridByOctave() const;
+	void FillNoiseGridOctaves2D(float* out, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize) const;
+	void FillNoiseGridOctaves3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize) const;
+
+	// Scalar grid fills of Value, Perlin and Cubic noise that hash every lattice column a row crosses once and reuse it until the row enters another cell
+	// Return false for the other noise types and for grids sampled more than one lattice cell apart, which are sampled point by point
+	bool FillLatticeGrid2D(float* out, const float* xCoords, const float* yCoords, int32 xSize, int32 ySize) const;
+	bool FillLatticeGrid3D(float* out, const float* xCoords, const float* yCoords, const float* zCoords, int32 xSize, int32 ySize, int32 zSize) const;
+
+	// Moves the lattice origin to the cell holding a frequency scaled position and leaves the offset from that cell in the position
+	void MoveLatticeOrigin2D(double& x, double& y);
+	void MoveLatticeOrigin3D(double& x, double& y, double& z);
+
+	int32 LatticeX(int32 x) const { return (int32)((uint32)x + (uint32)LatticeOriginX); }
+	int32 LatticeY(int32 y) const { return (int32)((uint32)y + (uint32)LatticeOriginY); }
+	int32 LatticeZ(int32 z) const { return (int32)((uint32)z + (uint32)LatticeOriginZ); }
+
+	inline int32 Hash2D(uint8 offset, int32 x, int32 y) const;
+	inline int32 Hash3D(uint8 offset, int32 x, int32 y, int32 z) const;
+	inline int32 Hash4D(uint8 offset, int32 x, int32 y, int32 z, int32 w) const;
+
+	// THash of the functions below is the hash type policy DispatchHash(...) selected, FHashPermutation or FHashInteger
+	inline uint8 Index2D_12(uint8 offset, int32 x, int32 y) const;
+	inline uint8 Index3D_12(uint8 offset, int32 x, int32 y, int32 z) const;
+	template <typename THash>
+	inline uint8 Index4D_32(uint8 offset, int32 x, int32 y, int32 z, int32 w) const;
+	template <typename THash>
+	inline uint8 Index2D_256(uint8 offset, int32 x, int32 y) const;
+	template <typename THash>
+	inline uint8 Index3D_256(uint8 offset, int32 x, int32 y, int32 z) const;
+	template <typename THash>
+	inline uint8 Index4D_256(uint8 offset, int32 x, int32 y, int32 z, int32 w) const;
+
+	template <typename THash>
+	inline float ValCoord2DFast(uint8 offset, int32 x, int32 y) const;
+	template <typename THash>
+	inline float ValCoord3DFast(uint8 offset, int32 x, int32 y, int32 z) const;
+	template <typename THash>
+	inline float GradCoord2D(uint8 offset, int32 x, int32 y, float xd, float yd) const;
+	template <typename THash>
+	inline float GradCoord3D(uint8 offset, int32 x, int32 y, int32 z, float xd, float yd, float zd) const;
+	template <typename THash>
+	inline float GradCoord4D(uint8 offset, int32 x, int32 y, int32 z, int32 w, float xd, float yd, float zd, float wd) const;
+	// Also return the gradient vector the offset was projected on
+	template <typename THash>
+	inline float GradCoord2D(uint8 offset, int32 x, int32 y, float xd, float yd, float& xGrad, float& yGrad) const;
+	template <typename THash>
+	inline float GradCoord3D(uint8 offset, int32 x, int32 y, int32 z, float xd, float yd, float zd, float& xGrad, float& yGrad, float& zGrad) const;
+	// GradCoord2D/3D(...) split into the hash selecting a corner's gradient and its dot product with the offset from the corner
+	template <typename THash>
+	inline int32 GradHash2D(uint8 offset, int32 x, int32 y) const;
+	template <typename THash>
+	inline int32 GradHash3D(uint8 offset, int32 x, int32 y, int32 z) const;
+	template <typename THash>
+	inline float GradDot2D(int32 gradHash, float xd, float yd) const;
+	template <typename THash>
+	inline float GradDot3D(int32 gradHash, float xd, float yd, float zd) const;
+};
+
+// Immutable copy of a UFastNoise and of the lookup noises it samples, created with UFastNoise::CreateEvaluator()
+// It does not reference any UObject, so it can be copied to and used from any thread while the noise objects change
+class FASTNOISEPLUGIN_API FFastNoiseEvaluator
+{
+public:
+	FFastNoiseEvaluator(const FFastNoiseEvaluator& other);
+	FFastNoiseEvaluator& operator=(const FFastNoiseEvaluator& other);
+
+	// Settings of the compiled noise, its lookup noises follow through FFastNoiseParams::Lookup
+	const FFastNoiseParams& GetParams() const { return Layers[0]; }
+
+	uint64 GetSettingsHash() const { return Layers[0].GetSettingsHash(); }
+
+	float GetNoise2D(float x, float y) const { return Layers[0].GetNoise2D(x, y); }
+	float GetNoise3D(float x, float y, float z) const { return Layers[0].GetNoise3D(x, y, z); }
+
+	float GetNoiseDerivative2D(float x, float y, FVector2D& gradient) const { return Layers[0].GetNoiseDerivative2D(x, y, gradient); }
+	float GetNoiseDerivative3D(float x, float y, float z, FVector& gradient) const { return Layers[0].GetNoiseDerivative3D(x, y, z, gradient); }
+
+	float GetNoiseBandLimited2D(float x, float y, float footprint) const { return Layers[0].GetNoiseBandLimited2D(x, y, footprint); }
+	float GetNoiseBandLimited3D(float x, float y, float z, float footprint) const { return Layers[0].GetNoiseBandLimited3D(x, y, z, footprint); }
+
+	float GetNoiseLarge2D(double x, double y) const { return Layers[0].GetNoiseLarge2D(x, y); }
+	float GetNoiseLarge3D(double x, double y, double z) const { return Layers[0].GetNoiseLarge3D(x, y, z); }
+
+	void GradientPerturb2D(float& x, float& y) const { Layers[0].GradientPerturb2D(x, y); }
+	void GradientPerturbFractal2D(float& x, float& y) const { Layers[0].GradientPerturbFractal2D(x, y); }
+	void GradientPerturb3D(float& x, float& y, float& z) const { Layers[0].GradientPerturb3D(x, y, z); }
+	void GradientPerturbFractal3D(float& x, float& y, float& z) const { Layers[0].GradientPerturbFractal3D(x, y, z); }
+
+	void GradientPerturbSet2D(TArrayView<float> xPoints, TArrayView<float> yPoints) const { Layers[0].GradientPerturbSet2D(xPoints, yPoints); }
+	void GradientPerturbFractalSet2D(TArrayView<float> xPoints, TArrayView<float> yPoints) const { Layers[0].GradientPerturbFractalSet2D(xPoints, yPoints); }
+	void GradientPerturbSet3D(TArrayView<float> xPoints, TArrayView<float> yPoints, TArrayView<float> zPoints) const { Layers[0].GradientPerturbSet3D(xPoints, yPoints, zPoints); }
+	void GradientPerturbFractalSet3D(TArrayView<float> xPoints, TArrayView<float> yPoints, TArrayView<float> zPoints) const { Layers[0].GradientPerturbFractalSet3D(xPoints, yPoints, zPoints); }
+
+	void GetNoiseSet2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const { Layers[0].GetNoiseSet2D(noiseSet, xStart, yStart, xSize, ySize, stepSize); }
+	void GetNoiseSet3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const { Layers[0].GetNoiseSet3D(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, stepSize); }
+
+	void GetNoiseSetBandLimited2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const { Layers[0].GetNoiseSetBandLimited2D(noiseSet, xStart, yStart, xSize, ySize, stepSize); }
+	void GetNoiseSetBandLimited3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const { Layers[0].GetNoiseSetBandLimited3D(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, stepSize); }
+
+	void GetNoiseSetLarge2D(TArrayView<float> noiseSet, double xStart, double yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const { Layers[0].GetNoiseSetLarge2D(noiseSet, xStart, yStart, xSize, ySize, stepSize); }
+	void GetNoiseSetLarge3D(TArrayView<float> noiseSet, double xStart, double yStart, double zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const { Layers[0].GetNoiseSetLarge3D(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, stepSize); }
+
+	void GetNoisePointSet2D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const { Layers[0].GetNoisePointSet2D(noiseSet, xPoints, yPoints); }
+	void GetNoisePointSet3D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const { Layers[0].GetNoisePointSet3D(noiseSet, xPoints, yPoints, zPoints); }
+
+	// Warped by this noise's own GradientPerturb settings
+	void GetPerturbedNoisePointSet2D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, bool fractalPerturb = true) const { Layers[0].GetPerturbedNoisePointSet2D(noiseSet, xPoints, yPoints, Layers[0], fractalPerturb); }
+	void GetPerturbedNoisePointSet3D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints, bool fractalPerturb = true) const { Layers[0].GetPerturbedNoisePointSet3D(noiseSet, xPoints, yPoints, zPoints, Layers[0], fractalPerturb); }
+
+	void GetNoiseDerivativeSet2D(TArrayView<float> noiseSet, TArrayView<FVector2D> gradientSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const { Layers[0].GetNoiseDerivativeSet2D(noiseSet, gradientSet, xStart, yStart, xSize, ySize, stepSize); }
+	void GetNoiseDerivativeSet3D(TArrayView<float> noiseSet, TArrayView<FVector> gradientSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const { Layers[0].GetNoiseDerivativeSet3D(noiseSet, gradientSet, xStart, yStart, zStart, xSize, ySize, zSize, stepSize); }
+
+	void GetNoiseDerivativePointSet2D(TArrayView<float> noiseSet, TArrayView<FVector2D> gradientSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const { Layers[0].GetNoiseDerivativePointSet2D(noiseSet, gradientSet, xPoints, yPoints); }
+	void GetNoiseDerivativePointSet3D(TArrayView<float> noiseSet, TArrayView<FVector> gradientSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const { Layers[0].GetNoiseDerivativePointSet3D(noiseSet, gradientSet, xPoints, yPoints, zPoints); }
+
+	void GetHeightmap2D(TArrayView<float> heights, TArrayView<FVector> normals, TArrayView<float> slopes, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f, float heightScale = 1.0f) const { Layers[0].GetHeightmap2D(heights, normals, slopes, xStart, yStart, xSize, ySize, stepSize, heightScale); }
+
+	FFastNoiseCellularSample GetCellularSample2D(float x, float y) const { return Layers[0].GetCellularSample2D(x, y); }
+	FFastNoiseCellularSample GetCellularSample3D(float x, float y, float z) const { return Layers[0].GetCellularSample3D(x, y, z); }
+
+	void GetCellularSamplePointSet2D(const FFastNoiseCellularSampleSet& sampleSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const { Layers[0].GetCellularSamplePointSet2D(sampleSet, xPoints, yPoints); }
+	void GetCellularSamplePointSet3D(const FFastNoiseCellularSampleSet& sampleSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const { Layers[0].GetCellularSamplePointSet3D(sampleSet, xPoints, yPoints, zPoints); }
+
+private:
+	explicit FFastNoiseEvaluator(const UFastNoise& noise);
+
+	// Points every layer's Lookup at the next layer, after the layers were copied
+	void LinkLayers();
+
+	// The compiled noise followed by its lookup chain, Layers[i + 1] is the lookup noise of Layers[i]
+	TArray<FFastNoiseParams> Layers;
+
+	// Keep the permutation tables of Layers alive after the noises changed seed or were destroyed
+	TArray<TSharedPtr<const FFastNoisePermutation, ESPMode::ThreadSafe>> Permutations;
+
+	friend class UFastNoise;
+};
 
 UCLASS(BlueprintType, meta = (DisplayName = "FastNoise"))
 class FASTNOISEPLUGIN_API UFastNoise : public UObject
@@ -99,6 +761,11 @@ class FASTNOISEPLUGIN_API UFastNoise : public UObject
 public:
 	UFastNoise();
 
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& propertyChangedEvent) override;
+#endif
+
 private:
 	UPROPERTY(EditAnywhere, Category = "NoiseProperties", meta = (DisplayName = "Seed"), BlueprintSetter = SetSeed)
 		int32 Seed;
@@ -142,9 +809,15 @@ private:
 	UPROPERTY(EditAnywhere, Category = "NoiseProperties", meta = (DisplayName = "GradientPerturbAmp"))
 		float GradientPerturbAmp;
 
+	UPROPERTY(EditAnywhere, Category = "NoiseProperties", meta = (DisplayName = "PerturbType"))
+		EFNPerturbType PerturbType;
+
 	UPROPERTY(EditAnywhere, Category = "NoiseProperties", meta = (DisplayName = "CellularNoiseLookup"))
 		UFastNoise* CellularNoiseLookup = nullptr;
 
+	UPROPERTY(EditAnywhere, Category = "NoiseProperties", meta = (DisplayName = "HashType"))
+		EFNHashType HashType;
+
 #if WITH_EDITORONLY_DATA
 public:
 	UPROPERTY(VisibleAnywhere)
@@ -171,7 +844,7 @@ public:
 	// Sets frequency for all noise types
 	// Default: 0.01
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
-	void SetFrequency(float newFrequency) { Frequency = newFrequency; }
+	void SetFrequency(float newFrequency) { Frequency = newFrequency; UpdateParams(); }
 
 	// Returns frequency used for all noise types
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -185,7 +858,7 @@ public:
 	// Used in Value, Perlin Noise and Position Warping
 	// Default: Quintic
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
-	void SetInterp(EFNInterp newInterp) { Interpolation = newInterp; }
+	void SetInterp(EFNInterp newInterp) { Interpolation = newInterp; UpdateParams(); }
 
 	// Returns interpolation method used for supported noise types
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -194,7 +867,7 @@ public:
 	// Sets noise return type of GetNoise(...)
 	// Default: Simplex
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
-	void SetNoiseType(EFNNoiseType newNoiseType) { NoiseType = newNoiseType; }
+	void SetNoiseType(EFNNoiseType newNoiseType) { NoiseType = newNoiseType; UpdateParams(); }
 
 	// Returns the noise type used by GetNoise
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -203,7 +876,7 @@ public:
 	// Sets octave count for all fractal noise types
 	// Default: 3
 	UFUNCTION(BlueprintSetter, Category = "FastNoise")
-	void SetFractalOctaves(int32 newOctaves) { if (FractalOctaves == newOctaves) return; FractalOctaves = newOctaves; CalculateFractalBounding(); }
+	void SetFractalOctaves(int32 newOctaves) { if (FractalOctaves == newOctaves) return; FractalOctaves = newOctaves; UpdateParams(); }
 
 	// Returns octave count for all fractal noise types
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -212,7 +885,7 @@ public:
 	// Sets octave lacunarity for all fractal noise types
 	// Default: 2.0
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
-	void SetFractalLacunarity(float newLacunarity) { FractalLacunarity = newLacunarity; }
+	void SetFractalLacunarity(float newLacunarity) { FractalLacunarity = newLacunarity; UpdateParams(); }
 
 	// Returns octave lacunarity for all fractal noise types
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -221,7 +894,7 @@ public:
 	// Sets octave gain for all fractal noise types
 	// Default: 0.5
 	UFUNCTION(BlueprintSetter, Category = "FastNoise")
-	void SetFractalGain(float newGain) { if (FractalGain == newGain) return; FractalGain = newGain; CalculateFractalBounding(); }
+	void SetFractalGain(float newGain) { if (FractalGain == newGain) return; FractalGain = newGain; UpdateParams(); }
 
 	// Returns octave gain for all fractal noise types
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -230,7 +903,7 @@ public:
 	// Sets method for combining octaves in all fractal noise types
 	// Default: FBM
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
-	void SetFractalType(EFNFractalType newFractalType) { FractalType = newFractalType; }
+	void SetFractalType(EFNFractalType newFractalType) { FractalType = newFractalType; UpdateParams(); }
 
 	// Returns method for combining octaves in all fractal noise types
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -239,7 +912,7 @@ public:
 	// Sets distance function used in cellular noise calculations
 	// Default: Euclidean
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
-	void SetCellularDistanceFunction(EFNCellularDistanceFunction newCellularDistanceFunction) { CellularDistanceFunction = newCellularDistanceFunction; }
+	void SetCellularDistanceFunction(EFNCellularDistanceFunction newCellularDistanceFunction) { CellularDistanceFunction = newCellularDistanceFunction; UpdateParams(); }
 
 	// Returns the distance function used in cellular noise calculations
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -249,7 +922,7 @@ public:
 	// Note: NoiseLookup requires another UFastNoise object be set with SetCellularNoiseLookup() to function
 	// Default: CellValue
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
-	void SetCellularReturnType(EFNCellularReturnType newCellularReturnType) { CellularReturnType = newCellularReturnType; }
+	void SetCellularReturnType(EFNCellularReturnType newCellularReturnType) { CellularReturnType = newCellularReturnType; UpdateParams(); }
 
 	// Returns the return type from cellular noise calculations
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -257,8 +930,9 @@ public:
 
 	// Noise used to calculate a cell value if cellular return type is NoiseLookup
 	// The lookup value is acquired through GetNoise() so ensure you SetNoiseType() on the noise lookup, value, Perlin or simplex is recommended
+	// A lookup whose own lookups lead back to this noise is refused and the current one kept
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
-	void SetCellularNoiseLookup(UFastNoise* newCellularNoiseLookup) { CellularNoiseLookup = newCellularNoiseLookup; }
+	void SetCellularNoiseLookup(UFastNoise* newCellularNoiseLookup);
 
 	// Returns the noise used to calculate a cell value if the cellular return type is NoiseLookup
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -279,7 +953,7 @@ public:
 	// Setting this high will make artifacts more common
 	// Default: 0.45
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
-	void SetCellularJitter(float newCellularJitter) { CellularJitter = newCellularJitter; }
+	void SetCellularJitter(float newCellularJitter) { CellularJitter = newCellularJitter; UpdateParams(); }
 
 	// Returns the maximum distance a cellular point can move from its grid position
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
@@ -288,12 +962,36 @@ public:
 	// Sets the maximum warp distance from original location when using GradientPerturb{Fractal}(...)
 	// Default: 1.0
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
-	void SetGradientPerturbAmp(float newGradientPerturbAmp) { GradientPerturbAmp = newGradientPerturbAmp; }
+	void SetGradientPerturbAmp(float newGradientPerturbAmp) { GradientPerturbAmp = newGradientPerturbAmp; UpdateParams(); }
 
 	// Returns the maximum warp distance from original location when using GradientPerturb{Fractal}(...)
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
 	float GetGradientPerturbAmp() const { return GradientPerturbAmp; }
 
+	// Sets how GradientPerturb{Fractal}(...) warps a position
+	// Gradient: interpolates the random vectors of the 4 (2D) or 8 (3D) surrounding lattice corners with Interpolation
+	// Simplex: sums the random vectors of the 3 (2D) or 4 (3D) simplex corners with the simplex falloff, fewer lookups that mostly pay off in the GradientPerturb sets, a little less smooth
+	// Prefer Gradient on scalar builds (no SIMD kernels, e.g. non-x64), where the single point Simplex warp is slower
+	// Default: Gradient
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	void SetPerturbType(EFNPerturbType newPerturbType) { PerturbType = newPerturbType; UpdateParams(); }
+
+	// Returns how GradientPerturb{Fractal}(...) warps a position
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	EFNPerturbType GetPerturbType() const { return PerturbType; }
+
+	// Sets how lattice points are hashed
+	// Permutation: lookups in a seeded permutation table
+	// Integer: multiply and xorshift of the coordinates, no table is built and vectorized sets need no permutation gathers
+	// Both are stable per seed, but give different patterns
+	// Default: Permutation
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	void SetHashType(EFNHashType newHashType) { HashType = newHashType; UpdateSeed(); UpdateParams(); }
+
+	// Returns how lattice points are hashed
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	EFNHashType GetHashType() const { return HashType; }
+
 	//2D
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
 	float GetValue2D(float x, float y) const;
@@ -377,80 +1075,162 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "FastNoise")
 	float GetWhiteNoiseInt4D(int32 x, int32 y, int32 z, int32 w) const;
 
-private:
-	uint8 m_perm[512];
-	uint8 m_perm12[512];
-	float m_fractalBounding;
-
-	void UpdateSeed();
-	void CalculateFractalBounding();
-
-	//2D
-	float SingleValueFractalFBM(float x, float y) const;
-	float SingleValueFractalBillow(float x, float y) const;
-	float SingleValueFractalRigidMulti(float x, float y) const;
-	float SingleValue(uint8 offset, float x, float y) const;
-
-	float SinglePerlinFractalFBM(float x, float y) const;
-	float SinglePerlinFractalBillow(float x, float y) const;
-	float SinglePerlinFractalRigidMulti(float x, float y) const;
-	float SinglePerlin(uint8 offset, float x, float y) const;
+	//Derivatives
+	// Noise value and its gradient in a single pass, cheaper than sampling the noise again for finite differences
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetValueDerivative2D(float x, float y, FVector2D& gradient) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetValueFractalDerivative2D(float x, float y, FVector2D& gradient) const;
 
-	float SingleSimplexFractalFBM(float x, float y) const;
-	float SingleSimplexFractalBillow(float x, float y) const;
-	float SingleSimplexFractalRigidMulti(float x, float y) const;
-	float SingleSimplexFractalBlend(float x, float y) const;
-	float SingleSimplex(uint8 offset, float x, float y) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetPerlinDerivative2D(float x, float y, FVector2D& gradient) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetPerlinFractalDerivative2D(float x, float y, FVector2D& gradient) const;
 
-	float SingleCubicFractalFBM(float x, float y) const;
-	float SingleCubicFractalBillow(float x, float y) const;
-	float SingleCubicFractalRigidMulti(float x, float y) const;
-	float SingleCubic(uint8 offset, float x, float y) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetSimplexDerivative2D(float x, float y, FVector2D& gradient) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetSimplexFractalDerivative2D(float x, float y, FVector2D& gradient) const;
 
-	float SingleCellular(float x, float y) const;
-	float SingleCellular2Edge(float x, float y) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetNoiseDerivative2D(float x, float y, FVector2D& gradient) const;
 
-	void SingleGradientPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetValueDerivative3D(float x, float y, float z, FVector& gradient) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetValueFractalDerivative3D(float x, float y, float z, FVector& gradient) const;
 
-	//3D
-	float SingleValueFractalFBM(float x, float y, float z) const;
-	float SingleValueFractalBillow(float x, float y, float z) const;
-	float SingleValueFractalRigidMulti(float x, float y, float z) const;
-	float SingleValue(uint8 offset, float x, float y, float z) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetPerlinDerivative3D(float x, float y, float z, FVector& gradient) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetPerlinFractalDerivative3D(float x, float y, float z, FVector& gradient) const;
 
-	float SinglePerlinFractalFBM(float x, float y, float z) const;
-	float SinglePerlinFractalBillow(float x, float y, float z) const;
-	float SinglePerlinFractalRigidMulti(float x, float y, float z) const;
-	float SinglePerlin(uint8 offset, float x, float y, float z) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetSimplexDerivative3D(float x, float y, float z, FVector& gradient) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetSimplexFractalDerivative3D(float x, float y, float z, FVector& gradient) const;
 
-	float SingleSimplexFractalFBM(float x, float y, float z) const;
-	float SingleSimplexFractalBillow(float x, float y, float z) const;
-	float SingleSimplexFractalRigidMulti(float x, float y, float z) const;
-	float SingleSimplex(uint8 offset, float x, float y, float z) const;
+	UFUNCTION(BlueprintCallable, Category = "FastNoise")
+	float GetNoiseDerivative3D(float x, float y, float z, FVector& gradient) const;
+
+	// Returns an immutable copy of the current settings and lookup chain that any thread can sample without touching UObjects
+	FFastNoiseEvaluator CreateEvaluator() const { return FFastNoiseEvaluator(*this); }
+
+	// Hash of every property that affects the output, recursing into CellularNoiseLookup when it is sampled
+	uint64 GetSettingsHash() const { return m_params.GetSettingsHash(); }
+
+	// Broadcast on the game thread whenever a setter or a property edit changed a noise, used to drop data generated from its old settings
+	// Not broadcast while a noise is constructed or loaded, bind and unbind it on the game thread
+	static FFastNoiseChangedDelegate& OnSettingsChanged();
+
+	// Recompiles every loaded noise on the game thread, for console variables read when the settings are compiled
+	static void UpdateAllParams();
+
+	//Band Limiting
+	// GetNoise2D/3D(...) without the fractal octaves a sample covering footprint units can not resolve, for distant LODs
+	// The octaves left keep their amplitude, the last one fades out before it is dropped so the output does not pop
+	float GetNoiseBandLimited2D(float x, float y, float footprint) const;
+	float GetNoiseBandLimited3D(float x, float y, float z, float footprint) const;
+
+	// GetNoiseSet2D/3D(...) band limited to stepSize, the fewer octaves make coarse grids cheaper per sample
+	void GetNoiseSetBandLimited2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const;
+	void GetNoiseSetBandLimited3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const;
+
+	//Large World Coordinates
+	// GetNoise2D/3D(...) at double precision positions, precision does not drop with the distance from the world origin
+	float GetNoiseLarge2D(double x, double y) const;
+	float GetNoiseLarge3D(double x, double y, double z) const;
+
+	// GetNoiseSet2D/3D(...) starting at double precision positions, still vectorized
+	void GetNoiseSetLarge2D(TArrayView<float> noiseSet, double xStart, double yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const;
+	void GetNoiseSetLarge3D(TArrayView<float> noiseSet, double xStart, double yStart, double zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const;
+
+	//Noise Sets
+	// Fills noiseSet with a xSize * ySize grid of GetNoise2D(...) samples
+	// Sample (x, y) is taken at (xStart + x * stepSize, yStart + y * stepSize) and stored at noiseSet[x + xSize * y]
+	// The noise type is resolved once per set instead of once per sample, Value, Perlin, Simplex and Cellular noise types use SIMD when the CPU supports it
+	void GetNoiseSet2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const;
+
+	// Fills noiseSet with a xSize * ySize * zSize grid of GetNoise3D(...) samples
+	// Sample (x, y, z) is taken at (xStart + x * stepSize, yStart + y * stepSize, zStart + z * stepSize) and stored at noiseSet[x + xSize * (y + ySize * z)]
+	// The noise type is resolved once per set instead of once per sample, Value, Perlin, Simplex and Cellular noise types use SIMD when the CPU supports it
+	void GetNoiseSet3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const;
+
+	// Same as GetNoiseSet2D(...), but the grid is split into tiles of whole rows that are filled on the task graph's worker threads
+	// A tile holds at least minBatchSize samples, the output is identical to GetNoiseSet2D(...) whatever the number of threads
+	void GetNoiseSetParallel2D(TArrayView<float> noiseSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f, int32 minBatchSize = 4096) const;
+
+	// Same as GetNoiseSet3D(...), but the grid is split into tiles of whole rows that are filled on the task graph's worker threads
+	// A tile holds at least minBatchSize samples, the output is identical to GetNoiseSet3D(...) whatever the number of threads
+	void GetNoiseSetParallel3D(TArrayView<float> noiseSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f, int32 minBatchSize = 4096) const;
+
+	// Starts generating the same grid as GetNoiseSet2D(...) on a thread pool worker and returns without waiting for it
+	// The request works on an evaluator compiled from the current settings, so the noise may be changed or destroyed meanwhile
+	FFastNoiseAsyncRequestRef GetNoiseSet2DAsync(float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f, FFastNoiseAsyncDelegate onComplete = FFastNoiseAsyncDelegate()) const;
+
+	// Starts generating the same grid as GetNoiseSet3D(...) on a thread pool worker and returns without waiting for it
+	// The request works on an evaluator compiled from the current settings, so the noise may be changed or destroyed meanwhile
+	FFastNoiseAsyncRequestRef GetNoiseSet3DAsync(float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f, FFastNoiseAsyncDelegate onComplete = FFastNoiseAsyncDelegate()) const;
+
+	// Fills noiseSet with GetNoise2D(xPoints[i], yPoints[i]) for every point
+	// Value, Perlin, Simplex and Cellular noise types are evaluated several points at a time with SIMD when the CPU supports it
+	void GetNoisePointSet2D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const;
+
+	// Fills noiseSet with GetNoise3D(xPoints[i], yPoints[i], zPoints[i]) for every point
+	// Value, Perlin, Simplex and Cellular noise types are evaluated several points at a time with SIMD when the CPU supports it
+	void GetNoisePointSet3D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const;
+
+	// GradientPerturb{Fractal}2D/3D(...) of every point, the coordinate arrays are warped in place several points at a time with SIMD
+	void GradientPerturbSet2D(TArrayView<float> xPoints, TArrayView<float> yPoints) const;
+	void GradientPerturbFractalSet2D(TArrayView<float> xPoints, TArrayView<float> yPoints) const;
+	void GradientPerturbSet3D(TArrayView<float> xPoints, TArrayView<float> yPoints, TArrayView<float> zPoints) const;
+	void GradientPerturbFractalSet3D(TArrayView<float> xPoints, TArrayView<float> yPoints, TArrayView<float> zPoints) const;
+
+	// Fills noiseSet with this noise at every point warped by perturbNoise, or by this noise's own GradientPerturb settings if it is null
+	// Warping and sampling are done a chunk of points at a time, the warped coordinates of the whole set are never stored
+	void GetPerturbedNoisePointSet2D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, bool fractalPerturb = true, const UFastNoise* perturbNoise = nullptr) const;
+	void GetPerturbedNoisePointSet3D(TArrayView<float> noiseSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints, bool fractalPerturb = true, const UFastNoise* perturbNoise = nullptr) const;
+
+	// Fills noiseSet as GetNoiseSet2D/3D(...) does and gradientSet with the gradient of every sample, in the same layout
+	void GetNoiseDerivativeSet2D(TArrayView<float> noiseSet, TArrayView<FVector2D> gradientSet, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f) const;
+	void GetNoiseDerivativeSet3D(TArrayView<float> noiseSet, TArrayView<FVector> gradientSet, float xStart, float yStart, float zStart, int32 xSize, int32 ySize, int32 zSize, float stepSize = 1.0f) const;
+
+	// Fills noiseSet as GetNoisePointSet2D/3D(...) does and gradientSet with the gradient at every point
+	void GetNoiseDerivativePointSet2D(TArrayView<float> noiseSet, TArrayView<FVector2D> gradientSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const;
+	void GetNoiseDerivativePointSet3D(TArrayView<float> noiseSet, TArrayView<FVector> gradientSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const;
+
+	// Height, normal and slope of every texel of a heightmap tile in one pass, seamless between adjacent tiles
+	// Analytic derivatives are used when the noise type has them, otherwise a one texel apron is sampled for central differences
+	// stepSize has to be positive
+	void GetHeightmap2D(TArrayView<float> heights, TArrayView<FVector> normals, TArrayView<float> slopes, float xStart, float yStart, int32 xSize, int32 ySize, float stepSize = 1.0f, float heightScale = 1.0f) const;
+
+	// F1 and F2 distances, cell value, cell and cell position from a single cellular search, whatever the return type is
+	// One search serves what would otherwise take a noise per return type
+	FFastNoiseCellularSample GetCellularSample2D(float x, float y) const;
+	FFastNoiseCellularSample GetCellularSample3D(float x, float y, float z) const;
+
+	// Cellular samples of every point written to the arrays of sampleSet, vectorized when the CPU supports it
+	void GetCellularSamplePointSet2D(const FFastNoiseCellularSampleSet& sampleSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints) const;
+	void GetCellularSamplePointSet3D(const FFastNoiseCellularSampleSet& sampleSet, TArrayView<const float> xPoints, TArrayView<const float> yPoints, TArrayView<const float> zPoints) const;
 
-	float SingleCubicFractalFBM(float x, float y, float z) const;
-	float SingleCubicFractalBillow(float x, float y, float z) const;
-	float SingleCubicFractalRigidMulti(float x, float y, float z) const;
-	float SingleCubic(uint8 offset, float x, float y, float z) const;
+private:
+	// Compiled copy of the properties, every setter and property edit updates it
+	FFastNoiseParams m_params;
 
-	float SingleCellular(float x, float y, float z) const;
-	float SingleCellular2Edge(float x, float y, float z) const;
+	// Shared tables m_params.Perm and Perm12 point to
+	TSharedPtr<const FFastNoisePermutation, ESPMode::ThreadSafe> m_permutation;
 
-	void SingleGradientPerturb(uint8 offset, float warpAmp, float frequency, float& x, float& y, float& z) const;
+	void UpdateSeed();
+	void CalculateFractalBounding();
+	// Compiles the properties into m_params, UpdateParams() also broadcasts OnSettingsChanged()
+	void CompileParams();
+	void UpdateParams();
 
-	//4D
-	float SingleSimplex(uint8 offset, float x, float y, float z, float w) const;
+	// Returns CellularNoiseLookup if the current settings sample it
+	const UFastNoise* GetActiveNoiseLookup() const;
 
-	inline uint8 Index2D_12(uint8 offset, int32 x, int32 y) const;
-	inline uint8 Index3D_12(uint8 offset, int32 x, int32 y, int32 z) const;
-	inline uint8 Index4D_32(uint8 offset, int32 x, int32 y, int32 z, int32 w) const;
-	inline uint8 Index2D_256(uint8 offset, int32 x, int32 y) const;
-	inline uint8 Index3D_256(uint8 offset, int32 x, int32 y, int32 z) const;
-	inline uint8 Index4D_256(uint8 offset, int32 x, int32 y, int32 z, int32 w) const;
+	// True if noise is lookup or one of the lookups it leads to
+	static bool LookupChainContains(const UFastNoise* lookup, const UFastNoise* noise);
 
-	inline float ValCoord2DFast(uint8 offset, int32 x, int32 y) const;
-	inline float ValCoord3DFast(uint8 offset, int32 x, int32 y, int32 z) const;
-	inline float GradCoord2D(uint8 offset, int32 x, int32 y, float xd, float yd) const;
-	inline float GradCoord3D(uint8 offset, int32 x, int32 y, int32 z, float xd, float yd, float zd) const;
-	inline float GradCoord4D(uint8 offset, int32 x, int32 y, int32 z, int32 w, float xd, float yd, float zd, float wd) const;
+	friend class FFastNoiseEvaluator;
 };
@@ -0,0 +1,114 @@
+// FastNoiseTileCache.h
+//
+// Memory bounded least recently used cache of noise set tiles
+// Tiles are keyed on the settings hash of the noise, so every noise with the same settings shares them
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FastNoise.h"
+
+// Identifies a cached tile, SettingsHash covers the noise and the lookup noise chain it samples
+struct FFastNoiseTileKey
+{
+	uint64 SettingsHash;
+	FIntVector Tile;
+	int32 Resolution;
+	float StepSize;
+	bool bIs3D;
+
+	bool operator==(const FFastNoiseTileKey& other) const
+	{
+		return SettingsHash == other.SettingsHash && Tile == other.Tile && Resolution == other.Resolution && StepSize == other.StepSize && bIs3D == other.bIs3D;
+	}
+
+	friend uint32 GetTypeHash(const FFastNoiseTileKey& key)
+	{
+		uint32 hash = GetTypeHash(key.SettingsHash);
+		hash = HashCombine(hash, GetTypeHash(key.Tile.X));
+		hash = HashCombine(hash, GetTypeHash(key.Tile.Y));
+		hash = HashCombine(hash, GetTypeHash(key.Tile.Z));
+		hash = HashCombine(hash, GetTypeHash(key.Resolution));
+		return HashCombine(hash, GetTypeHash(key.StepSize) ^ (key.bIs3D ? 1u : 0u));
+	}
+};
+
+// Noise values of a tile, still valid after the tile was evicted or invalidated
+typedef TSharedRef<const TArray<float>, ESPMode::ThreadSafe> FFastNoiseTileRef;
+
+// Least recently used tiles are evicted once the resident noise values exceed the byte budget
+// Editing a noise, or any lookup noise it samples, drops the tiles generated from its previous settings
+// Thread safe, tiles are generated outside the lock so a miss does not hold up hits on other threads
+// Created and destroyed on the game thread, where UFastNoise::OnSettingsChanged() is bound and broadcast
+class FASTNOISEPLUGIN_API FFastNoiseTileCache
+{
+public:
+	explicit FFastNoiseTileCache(int64 maxBytes);
+	~FFastNoiseTileCache();
+
+	FFastNoiseTileCache(const FFastNoiseTileCache&) = delete;
+	FFastNoiseTileCache& operator=(const FFastNoiseTileCache&) = delete;
+
+	// Returns the resolution * resolution noise set of tile, generated on a miss with
+	// noise->GetNoiseSet2D(tile, tile.X * resolution * stepSize, tile.Y * resolution * stepSize, resolution, resolution, stepSize)
+	// Neighbouring tiles continue the same sample grid without sharing samples
+	FFastNoiseTileRef GetTile2D(const UFastNoise* noise, FIntPoint tile, int32 resolution, float stepSize = 1.0f);
+
+	// Returns the resolution * resolution * resolution noise set of tile, generated on a miss with
+	// noise->GetNoiseSet3D(tile, tile.X * resolution * stepSize, tile.Y * resolution * stepSize, tile.Z * resolution * stepSize, resolution, resolution, resolution, stepSize)
+	FFastNoiseTileRef GetTile3D(const UFastNoise* noise, FIntVector tile, int32 resolution, float stepSize = 1.0f);
+
+	// Evicts least recently used tiles until the resident bytes fit the new budget
+	void SetMaxBytes(int64 maxBytes);
+	int64 GetMaxBytes() const;
+
+	// Drops every tile, the statistics are kept
+	void Empty();
+
+	// Bytes of noise values currently held by the cache, compare with GetMaxBytes() to size it
+	int64 GetResidentBytes() const;
+	int32 GetNumTiles() const;
+
+	// Fraction of GetTile2D/3D(...) calls answered from the cache since creation or ResetStats()
+	float GetHitRate() const;
+	uint64 GetHitCount() const;
+	uint64 GetMissCount() const;
+	void ResetStats();
+
+private:
+	// Entries form a doubly linked list by index, from the most recently used at Head to the least at Tail
+	struct FEntry
+	{
+		FFastNoiseTileKey Key;
+		TSharedPtr<const TArray<float>, ESPMode::ThreadSafe> Noise;
+		int32 Prev;
+		int32 Next;
+	};
+
+	FFastNoiseTileRef GetTile(const UFastNoise* noise, const FFastNoiseEvaluator& evaluator, const FFastNoiseTileKey& key);
+
+	void LinkFront(int32 index);
+	void Unlink(int32 index);
+	void RemoveEntry(int32 index);
+	void EvictToBudget();
+
+	void OnNoiseChanged(const UFastNoise* noise);
+
+	mutable FCriticalSection Lock;
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntries;
+	TMap<FFastNoiseTileKey, int32> EntryIndices;
+	int32 Head;
+	int32 Tail;
+
+	// Settings hashes each noise contributed to, as the cached noise or as one of its lookups
+	TMap<const UFastNoise*, TArray<uint64>> NoiseSettingsHashes;
+
+	int64 MaxBytes;
+	int64 ResidentBytes;
+	uint64 Hits;
+	uint64 Misses;
+
+	FDelegateHandle SettingsChangedHandle;
+};